@@ -5,8 +5,10 @@
 #include <CesiumGltf/Model.h>
 #include <CesiumGltfReader/GltfReader.h>
 
+#include <cstddef>
 #include <optional>
 #include <span>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 struct AssetFetcher;
@@ -31,5 +33,25 @@ struct B3dmToGltfConverter {
       const std::span<const std::byte>& b3dmBinary,
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& assetFetcher);
+
+  /**
+   * @brief Converts a b3dm binary file that is no longer needed by the caller
+   * to a glTF model.
+   *
+   * The embedded glb is moved to the start of `b3dmBinary` and its binary
+   * chunk is adopted by the model rather than copied. Only the feature and
+   * batch tables in front of it are copied.
+   *
+   * @param b3dmBinary The bytes loaded for the b3dm model. Its contents are
+   * unspecified after this method returns.
+   * @param options Options for how the glTF should be loaded.
+   * @param assetFetcher The \ref AssetFetcher containing information used by
+   * loaded assets.
+   * @returns A future that resolves to a \ref GltfConverterResult.
+   */
+  static CesiumAsync::Future<GltfConverterResult> convert(
+      std::vector<std::byte>&& b3dmBinary,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& assetFetcher);
 };
 } // namespace Cesium3DTilesContent
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <span>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 struct AssetFetcher;
@@ -29,11 +30,25 @@ public:
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& assetFetcher);
 
-private:
-  static GltfConverterResult convertImmediate(
-      const std::span<const std::byte>& gltfBinary,
+  /**
+   * @brief Converts a glb binary file that is no longer needed by the caller
+   * to a glTF model.
+   *
+   * The binary chunk of the glb is adopted by the model rather than copied.
+   *
+   * @param gltfBinary The bytes loaded for the glb model. Its contents are
+   * unspecified after this method returns.
+   * @param options Options for how the glTF should be loaded.
+   * @param assetFetcher The \ref AssetFetcher containing information used by
+   * loaded assets.
+   * @returns A future that resolves to a \ref GltfConverterResult.
+   */
+  static CesiumAsync::Future<GltfConverterResult> convert(
+      std::vector<std::byte>&& gltfBinary,
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& assetFetcher);
+
+private:
   static CesiumGltfReader::GltfReader _gltfReader;
 };
 } // namespace Cesium3DTilesContent
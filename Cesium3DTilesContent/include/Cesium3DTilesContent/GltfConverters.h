@@ -11,6 +11,8 @@
 #include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 
@@ -127,6 +129,18 @@ public:
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& subprocessor);
 
+  /**
+   * @brief A function pointer that can create a {@link GltfConverterResult}
+   * from a tile binary content that it takes ownership of.
+   *
+   * Such a function may adopt large parts of the content, such as the binary
+   * chunk of a glb, rather than copying them.
+   */
+  using OwningConverterFunction = CesiumAsync::Future<GltfConverterResult> (*)(
+      std::vector<std::byte>&& content,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& subprocessor);
+
   /**
    * @brief Register the given function for the given magic header.
    *
@@ -185,6 +199,36 @@ public:
   static ConverterFunction
   getConverterByMagic(const std::span<const std::byte>& content);
 
+  /**
+   * @brief Register a function that performs the same conversion as a
+   * registered {@link ConverterFunction}, but takes ownership of the content.
+   *
+   * @param converter The converter that is registered for a magic header or
+   * file extension.
+   * @param owningConverter The equivalent converter that takes ownership of
+   * the content.
+   */
+  static void registerOwningConverter(
+      ConverterFunction converter,
+      OwningConverterFunction owningConverter);
+
+  /**
+   * @brief Retrieve the function that was registered with
+   * {@link registerOwningConverter} for the given converter. If no such
+   * function is found, nullptr will be returned.
+   *
+   * A caller that holds the only reference to the content, such as a loader
+   * that has just received it in a response, should prefer the returned
+   * function, and pass it the content from
+   * {@link CesiumAsync::IAssetRequest::takeResponseData}.
+   *
+   * @param converter The converter that was returned by
+   * {@link getConverterByMagic} or {@link getConverterByFileExtension}.
+   * @return The {@link OwningConverterFunction} for the converter.
+   */
+  static OwningConverterFunction
+  getOwningConverter(ConverterFunction converter);
+
   /**
    * @brief Creates the {@link GltfConverterResult} from the given
    * binary content.
@@ -262,5 +306,7 @@ private:
   static std::unordered_map<std::string, ConverterFunction> _loadersByMagic;
   static std::unordered_map<std::string, ConverterFunction>
       _loadersByFileExtension;
+  static std::unordered_map<ConverterFunction, OwningConverterFunction>
+      _owningLoaders;
 };
 } // namespace Cesium3DTilesContent
@@ -405,6 +405,68 @@ public:
       uint64_t relativeSubtreeMortonId,
       bool isAvailable) noexcept;
 
+  /**
+   * @brief Determines which children of a given tile in the subtree are
+   * available.
+   *
+   * The children of a tile are adjacent in the availability bitstream, so
+   * this reads them all at once, which is much faster than calling
+   * {@link isTileAvailable} for each one.
+   *
+   * @param relativeTileLevel The level of the parent tile, relative to the
+   * root of the subtree. Its children must be in this subtree, not in a child
+   * subtree.
+   * @param relativeTileMortonId The Morton ID of the parent tile. See
+   * {@link ImplicitTilingUtilities::computeRelativeMortonIndex}.
+   * @return A mask with bit `i` set if the child with Morton ID
+   * `relativeTileMortonId * childCount + i` is available, where `childCount`
+   * is 4 for a quadtree and 8 for an octree. This is the order in which
+   * {@link ImplicitTilingUtilities::getChildren} returns the children.
+   */
+  uint8_t getChildTileAvailabilityMask(
+      uint32_t relativeTileLevel,
+      uint64_t relativeTileMortonId) const noexcept;
+
+  /**
+   * @brief Determines which children of a given tile in the subtree have
+   * available content.
+   *
+   * @param relativeTileLevel The level of the parent tile, relative to the
+   * root of the subtree. Its children must be in this subtree, not in a child
+   * subtree.
+   * @param relativeTileMortonId The Morton ID of the parent tile. See
+   * {@link ImplicitTilingUtilities::computeRelativeMortonIndex}.
+   * @param contentId The ID of the content to query.
+   * @return A mask of the children with available content, in the same order
+   * as {@link getChildTileAvailabilityMask}.
+   */
+  uint8_t getChildContentAvailabilityMask(
+      uint32_t relativeTileLevel,
+      uint64_t relativeTileMortonId,
+      size_t contentId) const noexcept;
+
+  /**
+   * @brief Determines which children of a tile in the last level of this
+   * subtree are the roots of available child subtrees.
+   *
+   * @param relativeTileMortonId The Morton ID of the parent tile, which must be
+   * in the last level of this subtree. See
+   * {@link ImplicitTilingUtilities::computeRelativeMortonIndex}.
+   * @return A mask of the children whose subtrees are available, in the same
+   * order as {@link getChildTileAvailabilityMask}.
+   */
+  uint8_t
+  getChildSubtreeAvailabilityMask(uint64_t relativeTileMortonId) const noexcept;
+
+  /**
+   * @brief Counts the available tiles in a level of the subtree.
+   *
+   * @param relativeTileLevel The level, relative to the root of the subtree.
+   * @return The number of available tiles in the level.
+   */
+  uint64_t
+  computeAvailableTileCount(uint32_t relativeTileLevel) const noexcept;
+
   /**
    * @brief Gets the subtree that this instance queries and modifies.
    */
@@ -424,6 +486,11 @@ private:
       Cesium3DTiles::Availability& availability,
       bool isAvailable) noexcept;
 
+  uint8_t getChildAvailabilityMask(
+      uint32_t relativeTileLevel,
+      uint64_t relativeTileMortonId,
+      const AvailabilityView& availabilityView) const noexcept;
+
   bool isAvailableUsingBufferView(
       uint64_t numOfTilesFromRootToParentLevel,
       uint64_t relativeTileMortonId,
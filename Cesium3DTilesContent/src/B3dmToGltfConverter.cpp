@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <span>
 #include <utility>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 namespace {
@@ -123,24 +124,31 @@ void parseB3dmHeader(
   }
 }
 
+uint32_t getGlbStart(const B3dmHeader& header, uint32_t headerLength) {
+  return headerLength + header.featureTableJsonByteLength +
+         header.featureTableBinaryByteLength + header.batchTableJsonByteLength +
+         header.batchTableBinaryByteLength;
+}
+
+CesiumAsync::Future<GltfConverterResult>
+invalidGlbRange(const AssetFetcher& assetFetcher) {
+  GltfConverterResult result;
+  result.errors.emplaceError("The B3DM is invalid because the start of the "
+                             "glTF model is after the end of the entire B3DM.");
+  return assetFetcher.asyncSystem.createResolvedFuture(std::move(result));
+}
+
 CesiumAsync::Future<GltfConverterResult> convertB3dmContentToGltf(
     const std::span<const std::byte>& b3dmBinary,
     const B3dmHeader& header,
     uint32_t headerLength,
     const CesiumGltfReader::GltfReaderOptions& options,
     const AssetFetcher& assetFetcher) {
-  const uint32_t glbStart = headerLength + header.featureTableJsonByteLength +
-                            header.featureTableBinaryByteLength +
-                            header.batchTableJsonByteLength +
-                            header.batchTableBinaryByteLength;
+  const uint32_t glbStart = getGlbStart(header, headerLength);
   const uint32_t glbEnd = header.byteLength;
 
   if (glbEnd <= glbStart) {
-    GltfConverterResult result;
-    result.errors.emplaceError(
-        "The B3DM is invalid because the start of the "
-        "glTF model is after the end of the entire B3DM.");
-    return assetFetcher.asyncSystem.createResolvedFuture(std::move(result));
+    return invalidGlbRange(assetFetcher);
   }
 
   const std::span<const std::byte> glbData =
@@ -269,4 +277,49 @@ CesiumAsync::Future<GltfConverterResult> B3dmToGltfConverter::convert(
             return std::move(glbResult);
           });
 }
+
+CesiumAsync::Future<GltfConverterResult> B3dmToGltfConverter::convert(
+    std::vector<std::byte>&& b3dmBinary,
+    const CesiumGltfReader::GltfReaderOptions& options,
+    const AssetFetcher& assetFetcher) {
+  GltfConverterResult result;
+  B3dmHeader header;
+  uint32_t headerLength = 0;
+  parseB3dmHeader(b3dmBinary, header, headerLength, result);
+  if (result.errors) {
+    return assetFetcher.asyncSystem.createResolvedFuture(std::move(result));
+  }
+
+  const uint32_t glbStart = getGlbStart(header, headerLength);
+  const uint32_t glbEnd = header.byteLength;
+
+  if (glbEnd <= glbStart) {
+    return invalidGlbRange(assetFetcher);
+  }
+
+  // The header and tables in front of the glb are needed for the metadata
+  // after the glb is read, so they are copied. The glb itself, which is
+  // usually much larger, is shifted into place and adopted.
+  std::vector<std::byte> tables(
+      b3dmBinary.begin(),
+      b3dmBinary.begin() + glbStart);
+  b3dmBinary.resize(glbEnd);
+  b3dmBinary.erase(b3dmBinary.begin(), b3dmBinary.begin() + glbStart);
+
+  return BinaryToGltfConverter::convert(
+             std::move(b3dmBinary),
+             options,
+             assetFetcher)
+      .thenImmediately([tables = std::move(tables), header, headerLength](
+                           GltfConverterResult&& glbResult) {
+        if (!glbResult.errors) {
+          convertB3dmMetadataToGltfStructuralMetadata(
+              tables,
+              header,
+              headerLength,
+              glbResult);
+        }
+        return std::move(glbResult);
+      });
+}
 } // namespace Cesium3DTilesContent
@@ -9,21 +9,16 @@
 #include <span>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Cesium3DTilesContent {
-CesiumGltfReader::GltfReader BinaryToGltfConverter::_gltfReader;
-
-GltfConverterResult BinaryToGltfConverter::convertImmediate(
-    const std::span<const std::byte>& gltfBinary,
-    const CesiumGltfReader::GltfReaderOptions& options,
-    const AssetFetcher& assetFetcher) {
-  CesiumGltfReader::GltfReaderResult loadedGltf =
-      _gltfReader.readGltf(gltfBinary, options);
-
+namespace {
+GltfConverterResult toConverterResult(
+    CesiumGltfReader::GltfReaderResult&& loadedGltf,
+    CesiumGeometry::Axis upAxis) {
   if (loadedGltf.model) {
     loadedGltf.model->extras["gltfUpAxis"] =
-        static_cast<std::underlying_type_t<CesiumGeometry::Axis>>(
-            assetFetcher.upAxis);
+        static_cast<std::underlying_type_t<CesiumGeometry::Axis>>(upAxis);
   }
   GltfConverterResult result;
   result.model = std::move(loadedGltf.model);
@@ -31,12 +26,32 @@ GltfConverterResult BinaryToGltfConverter::convertImmediate(
   result.errors.warnings = std::move(loadedGltf.warnings);
   return result;
 }
+} // namespace
+
+CesiumGltfReader::GltfReader BinaryToGltfConverter::_gltfReader;
 
 CesiumAsync::Future<GltfConverterResult> BinaryToGltfConverter::convert(
     const std::span<const std::byte>& gltfBinary,
     const CesiumGltfReader::GltfReaderOptions& options,
     const AssetFetcher& assetFetcher) {
-  return assetFetcher.asyncSystem.createResolvedFuture(
-      convertImmediate(gltfBinary, options, assetFetcher));
+  return _gltfReader.readGltf(assetFetcher.asyncSystem, gltfBinary, options)
+      .thenImmediately(
+          [upAxis = assetFetcher.upAxis](
+              CesiumGltfReader::GltfReaderResult&& loadedGltf) {
+            return toConverterResult(std::move(loadedGltf), upAxis);
+          });
+}
+
+CesiumAsync::Future<GltfConverterResult> BinaryToGltfConverter::convert(
+    std::vector<std::byte>&& gltfBinary,
+    const CesiumGltfReader::GltfReaderOptions& options,
+    const AssetFetcher& assetFetcher) {
+  return _gltfReader
+      .readGltf(assetFetcher.asyncSystem, std::move(gltfBinary), options)
+      .thenImmediately(
+          [upAxis = assetFetcher.upAxis](
+              CesiumGltfReader::GltfReaderResult&& loadedGltf) {
+            return toConverterResult(std::move(loadedGltf), upAxis);
+          });
 }
 } // namespace Cesium3DTilesContent
@@ -21,6 +21,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 using namespace CesiumUtility;
 
@@ -31,6 +32,11 @@ std::unordered_map<std::string, GltfConverters::ConverterFunction>
 std::unordered_map<std::string, GltfConverters::ConverterFunction>
     GltfConverters::_loadersByFileExtension;
 
+std::unordered_map<
+    GltfConverters::ConverterFunction,
+    GltfConverters::OwningConverterFunction>
+    GltfConverters::_owningLoaders;
+
 void GltfConverters::registerMagic(
     const std::string& magic,
     ConverterFunction converter) {
@@ -57,6 +63,22 @@ GltfConverters::getConverterByMagic(const std::span<const std::byte>& content) {
   return getConverterByMagic(content, magic);
 }
 
+void GltfConverters::registerOwningConverter(
+    ConverterFunction converter,
+    OwningConverterFunction owningConverter) {
+  _owningLoaders[converter] = owningConverter;
+}
+
+GltfConverters::OwningConverterFunction
+GltfConverters::getOwningConverter(ConverterFunction converter) {
+  auto it = _owningLoaders.find(converter);
+  if (it != _owningLoaders.end()) {
+    return it->second;
+  }
+
+  return nullptr;
+}
+
 CesiumAsync::Future<GltfConverterResult> GltfConverters::convert(
     const std::string& filePath,
     const std::span<const std::byte>& content,
@@ -18,8 +18,10 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <span>
@@ -84,6 +86,55 @@ std::optional<SubtreeAvailability::AvailabilityView> parseAvailabilityView(
   return std::nullopt;
 }
 
+// Reads `count` consecutive bits, at most eight, starting at the given bit
+// index. Bits past the end of the bitstream read as zero.
+uint8_t readBits(
+    std::span<const std::byte> bitstream,
+    uint64_t bitIndex,
+    uint32_t count) noexcept {
+  const size_t byteIndex = size_t(bitIndex / 8);
+  if (byteIndex >= bitstream.size()) {
+    return 0;
+  }
+
+  // The bits may straddle two bytes.
+  uint32_t window = std::to_integer<uint32_t>(bitstream[byteIndex]);
+  if (byteIndex + 1 < bitstream.size()) {
+    window |= std::to_integer<uint32_t>(bitstream[byteIndex + 1]) << 8;
+  }
+
+  const uint32_t mask = (uint32_t(1) << count) - 1U;
+  return uint8_t((window >> (bitIndex % 8)) & mask);
+}
+
+// Counts the set bits in the range [begin, end) of a bitstream. Bits past the
+// end of the bitstream count as unset.
+uint64_t countBits(
+    std::span<const std::byte> bitstream,
+    uint64_t begin,
+    uint64_t end) noexcept {
+  end = std::min(end, uint64_t(bitstream.size()) * 8);
+
+  uint64_t count = 0;
+  while (begin < end && begin % 8 != 0) {
+    count += readBits(bitstream, begin++, 1);
+  }
+
+  // Count whole 64-bit words with a single popcount each.
+  while (begin + 64 <= end) {
+    uint64_t word;
+    std::memcpy(&word, bitstream.data() + begin / 8, sizeof(word));
+    count += uint64_t(std::popcount(word));
+    begin += 64;
+  }
+
+  while (begin < end) {
+    count += readBits(bitstream, begin++, 1);
+  }
+
+  return count;
+}
+
 } // namespace
 
 /*static*/ std::optional<SubtreeAvailability> SubtreeAvailability::fromSubtree(
@@ -437,6 +488,119 @@ void SubtreeAvailability::setSubtreeAvailable(
       isAvailable);
 }
 
+uint8_t SubtreeAvailability::getChildTileAvailabilityMask(
+    uint32_t relativeTileLevel,
+    uint64_t relativeTileMortonId) const noexcept {
+  return this->getChildAvailabilityMask(
+      relativeTileLevel,
+      relativeTileMortonId,
+      this->_tileAvailability);
+}
+
+uint8_t SubtreeAvailability::getChildContentAvailabilityMask(
+    uint32_t relativeTileLevel,
+    uint64_t relativeTileMortonId,
+    size_t contentId) const noexcept {
+  if (contentId >= this->_contentAvailability.size())
+    return 0;
+  return this->getChildAvailabilityMask(
+      relativeTileLevel,
+      relativeTileMortonId,
+      this->_contentAvailability[contentId]);
+}
+
+uint8_t SubtreeAvailability::getChildSubtreeAvailabilityMask(
+    uint64_t relativeTileMortonId) const noexcept {
+  if (this->_levelsInSubtree == 0) {
+    return 0;
+  }
+
+  uint64_t numOfTilesInLastLevel =
+      uint64_t(1) << (this->_powerOf2 * (this->_levelsInSubtree - 1));
+  if (relativeTileMortonId >= numOfTilesInLastLevel) {
+    return 0;
+  }
+
+  const SubtreeConstantAvailability* constantAvailability =
+      std::get_if<SubtreeConstantAvailability>(&this->_subtreeAvailability);
+  if (constantAvailability) {
+    return constantAvailability->constant
+               ? uint8_t((1U << this->_childCount) - 1U)
+               : uint8_t(0);
+  }
+
+  // The child subtree bitstream only has the level below this subtree.
+  const SubtreeBufferViewAvailability* pBufferViewAvailability =
+      std::get_if<SubtreeBufferViewAvailability>(&this->_subtreeAvailability);
+  return readBits(
+      pBufferViewAvailability->view,
+      relativeTileMortonId * this->_childCount,
+      this->_childCount);
+}
+
+uint64_t SubtreeAvailability::computeAvailableTileCount(
+    uint32_t relativeTileLevel) const noexcept {
+  if (relativeTileLevel >= this->_levelsInSubtree) {
+    return 0;
+  }
+
+  uint64_t numOfTilesInLevel = uint64_t(1)
+                               << (this->_powerOf2 * relativeTileLevel);
+
+  const SubtreeConstantAvailability* constantAvailability =
+      std::get_if<SubtreeConstantAvailability>(&this->_tileAvailability);
+  if (constantAvailability) {
+    return constantAvailability->constant ? numOfTilesInLevel : 0;
+  }
+
+  uint64_t numOfTilesFromRootToParentLevel =
+      (numOfTilesInLevel - 1U) / (this->_childCount - 1U);
+
+  const SubtreeBufferViewAvailability* pBufferViewAvailability =
+      std::get_if<SubtreeBufferViewAvailability>(&this->_tileAvailability);
+  return countBits(
+      pBufferViewAvailability->view,
+      numOfTilesFromRootToParentLevel,
+      numOfTilesFromRootToParentLevel + numOfTilesInLevel);
+}
+
+uint8_t SubtreeAvailability::getChildAvailabilityMask(
+    uint32_t relativeTileLevel,
+    uint64_t relativeTileMortonId,
+    const AvailabilityView& availabilityView) const noexcept {
+  if (relativeTileLevel + 1 >= this->_levelsInSubtree) {
+    // The children are in child subtrees.
+    return 0;
+  }
+
+  uint64_t numOfTilesInLevel = uint64_t(1)
+                               << (this->_powerOf2 * relativeTileLevel);
+  if (relativeTileMortonId >= numOfTilesInLevel) {
+    return 0;
+  }
+
+  const SubtreeConstantAvailability* constantAvailability =
+      std::get_if<SubtreeConstantAvailability>(&availabilityView);
+  if (constantAvailability) {
+    return constantAvailability->constant
+               ? uint8_t((1U << this->_childCount) - 1U)
+               : uint8_t(0);
+  }
+
+  // The children are adjacent in the level below, which follows every tile
+  // of this level and the levels above it.
+  uint64_t numOfTilesFromRootToChildLevel =
+      (numOfTilesInLevel * this->_childCount - 1U) / (this->_childCount - 1U);
+
+  const SubtreeBufferViewAvailability* pBufferViewAvailability =
+      std::get_if<SubtreeBufferViewAvailability>(&availabilityView);
+  return readBits(
+      pBufferViewAvailability->view,
+      numOfTilesFromRootToChildLevel +
+          relativeTileMortonId * this->_childCount,
+      this->_childCount);
+}
+
 bool SubtreeAvailability::isAvailable(
     uint32_t relativeTileLevel,
     uint64_t relativeTileMortonId,
@@ -19,6 +19,13 @@ void registerAllTileContentTypes() {
       ".gltf",
       BinaryToGltfConverter::convert);
   GltfConverters::registerFileExtension(".glb", BinaryToGltfConverter::convert);
+
+  GltfConverters::registerOwningConverter(
+      BinaryToGltfConverter::convert,
+      BinaryToGltfConverter::convert);
+  GltfConverters::registerOwningConverter(
+      B3dmToGltfConverter::convert,
+      B3dmToGltfConverter::convert);
 }
 
 } // namespace Cesium3DTilesContent
@@ -563,6 +563,51 @@ TEST_CASE("Test SubtreeAvailability methods") {
             libmorton::morton2D_64_encode(subtreeID.x, subtreeID.y)));
       }
     }
+
+    SUBCASE("child availability masks match individual queries") {
+      const uint32_t levels = uint32_t(maxSubtreeLevels);
+      for (uint32_t level = 0; level < levels; ++level) {
+        const uint64_t tilesInLevel = uint64_t(1) << (2 * level);
+        for (uint64_t morton = 0; morton < tilesInLevel; ++morton) {
+          const uint8_t tileMask =
+              quadtreeAvailability.getChildTileAvailabilityMask(level, morton);
+          const uint8_t contentMask =
+              quadtreeAvailability.getChildContentAvailabilityMask(
+                  level,
+                  morton,
+                  0);
+          const uint8_t subtreeMask =
+              level + 1 == levels
+                  ? quadtreeAvailability.getChildSubtreeAvailabilityMask(
+                        morton)
+                  : uint8_t(0);
+
+          for (uint32_t i = 0; i < 4; ++i) {
+            const uint64_t child = morton * 4 + i;
+            const bool inSubtree = level + 1 < levels;
+            CHECK(
+                bool(tileMask & (1U << i)) ==
+                (inSubtree &&
+                 quadtreeAvailability.isTileAvailable(level + 1, child)));
+            CHECK(
+                bool(contentMask & (1U << i)) ==
+                (inSubtree &&
+                 quadtreeAvailability.isContentAvailable(level + 1, child, 0)));
+            CHECK(
+                bool(subtreeMask & (1U << i)) ==
+                (!inSubtree && quadtreeAvailability.isSubtreeAvailable(child)));
+          }
+        }
+      }
+    }
+
+    SUBCASE("computeAvailableTileCount()") {
+      CHECK(quadtreeAvailability.computeAvailableTileCount(0) == 1);
+      CHECK(quadtreeAvailability.computeAvailableTileCount(1) == 1);
+      CHECK(quadtreeAvailability.computeAvailableTileCount(2) == 2);
+      CHECK(quadtreeAvailability.computeAvailableTileCount(3) == 0);
+      CHECK(quadtreeAvailability.computeAvailableTileCount(5) == 0);
+    }
   }
 }
 
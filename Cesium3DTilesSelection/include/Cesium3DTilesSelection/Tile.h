@@ -11,6 +11,7 @@
 #include <CesiumUtility/IntrusivePointer.h>
 
 #include <glm/common.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
 
 #include <atomic>
 #include <limits>
@@ -313,7 +314,7 @@ public:
    * @return The viewer request volume, or an empty optional.
    */
   const std::optional<BoundingVolume>& getViewerRequestVolume() const noexcept {
-    return this->_viewerRequestVolume;
+    return this->getColdProperties().viewerRequestVolume;
   }
 
   /**
@@ -323,9 +324,10 @@ public:
    *
    * @param value The viewer request volume.
    */
-  void
-  setViewerRequestVolume(const std::optional<BoundingVolume>& value) noexcept {
-    this->_viewerRequestVolume = value;
+  void setViewerRequestVolume(const std::optional<BoundingVolume>& value) {
+    if (this->_pColdProperties || value) {
+      this->getOrCreateColdProperties().viewerRequestVolume = value;
+    }
   }
 
   /**
@@ -419,7 +421,9 @@ public:
    *
    * @return The transform matrix.
    */
-  const glm::dmat4x4& getTransform() const noexcept { return this->_transform; }
+  const glm::dmat4x4& getTransform() const noexcept {
+    return this->getColdProperties().transform;
+  }
 
   /**
    * @brief Set the transformation matrix for this tile.
@@ -428,8 +432,10 @@ public:
    *
    * @param value The transform matrix.
    */
-  void setTransform(const glm::dmat4x4& value) noexcept {
-    this->_transform = value;
+  void setTransform(const glm::dmat4x4& value) {
+    if (this->_pColdProperties || value != glm::dmat4x4(1.0)) {
+      this->getOrCreateColdProperties().transform = value;
+    }
   }
 
   /**
@@ -463,7 +469,7 @@ public:
    */
   const std::optional<BoundingVolume>&
   getContentBoundingVolume() const noexcept {
-    return this->_contentBoundingVolume;
+    return this->getColdProperties().contentBoundingVolume;
   }
 
   /**
@@ -474,9 +480,10 @@ public:
    *
    * @param value The content bounding volume
    */
-  void setContentBoundingVolume(
-      const std::optional<BoundingVolume>& value) noexcept {
-    this->_contentBoundingVolume = value;
+  void setContentBoundingVolume(const std::optional<BoundingVolume>& value) {
+    if (this->_pColdProperties || value) {
+      this->getOrCreateColdProperties().contentBoundingVolume = value;
+    }
   }
 
   /**
@@ -683,31 +690,58 @@ private:
 
   void setMightHaveLatentChildren(bool mightHaveLatentChildren) noexcept;
 
+  /**
+   * @brief Properties that are not needed to select tiles, and that usually
+   * have their default values.
+   *
+   * They are stored outside of the `Tile` so that the properties that are
+   * accessed for every tile visited during selection are packed into fewer
+   * cache lines. A tile whose cold properties all have their default values
+   * does not allocate them at all.
+   */
+  struct ColdProperties {
+    std::optional<BoundingVolume> viewerRequestVolume{};
+    std::optional<BoundingVolume> contentBoundingVolume{};
+    glm::dmat4x4 transform{1.0};
+  };
+
+  static const ColdProperties DEFAULT_COLD_PROPERTIES;
+
+  const ColdProperties& getColdProperties() const noexcept {
+    return this->_pColdProperties ? *this->_pColdProperties
+                                  : DEFAULT_COLD_PROPERTIES;
+  }
+
+  ColdProperties& getOrCreateColdProperties();
+
+  // Properties used during selection, ordered roughly by how often they are
+  // accessed while traversing the tile hierarchy.
+
   // Position in bounding-volume hierarchy.
   Tile* _pParent;
   std::vector<Tile> _children;
 
   // Properties from tileset.json.
   // These are immutable after the tile leaves TileState::Unloaded.
-  TileID _id;
   BoundingVolume _boundingVolume;
-  std::optional<BoundingVolume> _viewerRequestVolume;
-  std::optional<BoundingVolume> _contentBoundingVolume;
   double _geometricError;
   TileRefine _refine;
-  glm::dmat4x4 _transform;
 
-  // tile content
-  CesiumUtility::DoublyLinkedListPointers<Tile> _unusedTilesLinks;
-  TileContent _content;
-  TilesetContentLoader* _pLoader;
   TileLoadState _loadState;
   bool _mightHaveLatentChildren;
+  mutable int32_t _referenceCount;
+  TileID _id;
+
+  // tile content
+  TilesetContentLoader* _pLoader;
+  TileContent _content;
 
   // mapped raster overlay
   std::vector<RasterMappedTo3DTile> _rasterTiles;
 
-  mutable int32_t _referenceCount;
+  // Properties that are rarely used during selection.
+  CesiumUtility::DoublyLinkedListPointers<Tile> _unusedTilesLinks;
+  std::unique_ptr<ColdProperties> _pColdProperties;
 
   friend class TilesetContentManager;
   friend class MockTilesetContentManagerTestFixture;
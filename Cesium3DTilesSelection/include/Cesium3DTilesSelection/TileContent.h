@@ -13,6 +13,10 @@
 #include <variant>
 #include <vector>
 
+namespace CesiumGltfContent {
+class GltfTriangleBvh;
+}
+
 namespace Cesium3DTilesSelection {
 /**
  * @brief A content tag that indicates the {@link TilesetContentLoader} does not
@@ -251,6 +255,26 @@ public:
    */
   void replaceWithModifiedModel() noexcept;
 
+  /**
+   * @brief Gets the bounding volume hierarchy over the triangles of the model,
+   * or nullptr if it has not been built.
+   *
+   * @see getOrCreateTriangleBvh
+   */
+  const CesiumGltfContent::GltfTriangleBvh* getTriangleBvh() const noexcept;
+
+  /**
+   * @brief Gets the bounding volume hierarchy over the triangles of the model,
+   * building it first if necessary.
+   *
+   * The BVH speeds up intersecting rays with the model, such as for height
+   * queries. It is discarded when the model is replaced with
+   * {@link setModel} or {@link replaceWithModifiedModel}. If the geometry of
+   * the model is modified in place, call {@link setModel} afterward so that
+   * the BVH is rebuilt.
+   */
+  const CesiumGltfContent::GltfTriangleBvh& getOrCreateTriangleBvh();
+
 private:
   CesiumGltf::Model _model;
   void* _pRenderResources;
@@ -262,6 +286,7 @@ private:
   CesiumRasterOverlays::RasterOverlayDetails _rasterOverlayDetails;
   std::vector<CesiumUtility::Credit> _credits;
   float _lodTransitionFadePercentage;
+  std::shared_ptr<const CesiumGltfContent::GltfTriangleBvh> _pTriangleBvh;
 };
 
 /**
@@ -14,12 +14,15 @@
 #include <Cesium3DTilesSelection/ViewState.h>
 #include <Cesium3DTilesSelection/ViewUpdateResult.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGeometry/PackedBoundingVolumes.h>
 #include <CesiumUtility/IntrusivePointer.h>
 
 #include <rapidjson/fwd.h>
 
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -541,6 +544,7 @@ private:
       const Tile& tile,
       const TilesetFrameState& frameState,
       bool cullWithChildrenBounds,
+      bool isInFrustum,
       CullResult& cullResult);
   void _fogCull(
       const TilesetFrameState& frameState,
@@ -557,7 +561,20 @@ private:
       uint32_t depth,
       bool ancestorMeetsSse,
       Tile& tile,
+      bool isInFrustum,
       ViewUpdateResult& result);
+  /**
+   * @brief Determines whether each of the given tiles is at least partially
+   * inside any of the frustums, and pushes the results onto
+   * `_frustumVisibility`.
+   *
+   * The bounding volumes of the tiles are packed and culled together, which is
+   * much faster than culling them one at a time.
+   */
+  void _computeFrustumVisibility(
+      const std::vector<ViewState>& frustums,
+      std::span<const Tile> tiles);
+
   TraversalDetails _visitVisibleChildrenNearToFar(
       const TilesetFrameState& frameState,
       uint32_t depth,
@@ -589,6 +606,12 @@ private:
 
   void _unloadCachedTiles(double timeBudget) noexcept;
 
+  /**
+   * @brief Runs the tasks queued for the main thread, within what remains of
+   * this frame's {@link TilesetOptions::mainThreadTaskTimeLimit}.
+   */
+  void _dispatchMainThreadTasks();
+
   void _updateLodTransitions(
       const TilesetFrameState& frameState,
       float deltaTime,
@@ -607,6 +630,19 @@ private:
   // scratch variable so that it can allocate only when growing bigger.
   std::vector<const TileOcclusionRendererProxy*> _childOcclusionProxies;
 
+  // Holds the bounding volumes of sibling tiles while they are frustum culled
+  // together, so that it can allocate only when growing bigger.
+  CesiumGeometry::PackedBoundingVolumes _packedBoundingVolumes;
+
+  // A stack of the frustum visibility of sibling tiles. Each level of the
+  // traversal pushes the visibility of a tile's children, and pops it once
+  // they have been visited.
+  std::vector<uint8_t> _frustumVisibility;
+
+  // The time, in milliseconds, spent running main-thread tasks since the last
+  // call to loadTiles.
+  double _mainThreadTaskTimeThisFrame = 0.0;
+
   CesiumUtility::IntrusivePointer<TilesetContentManager>
       _pTilesetContentManager;
 
@@ -7,8 +7,10 @@
 #include <Cesium3DTilesSelection/TileLoadResult.h>
 #include <Cesium3DTilesSelection/TilesetOptions.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGltf/Model.h>
@@ -41,6 +43,10 @@ struct CESIUM3DTILESSELECTION_API TileLoadInput {
    * @param requestHeaders The request headers that will be attached to the
    * request.
    * @param ellipsoid The {@link CesiumGeospatial::Ellipsoid}.
+   * @param cancellationToken The token that signals that the tile's content
+   * is no longer needed.
+   * @param priority The priority of the worker thread tasks that process the
+   * tile's content.
    */
   TileLoadInput(
       const Tile& tile,
@@ -49,7 +55,9 @@ struct CESIUM3DTILESSELECTION_API TileLoadInput {
       const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
       const std::shared_ptr<spdlog::logger>& pLogger,
       const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders,
-      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID,
+      const CesiumAsync::CancellationToken& cancellationToken = {},
+      CesiumAsync::TaskPriority priority = CesiumAsync::TaskPriority::Normal);
 
   /**
    * @brief The tile that the {@link TilesetContentLoader} will request the server for the content.
@@ -86,6 +94,31 @@ struct CESIUM3DTILESSELECTION_API TileLoadInput {
    * @brief The ellipsoid that this tileset uses.
    */
   const CesiumGeospatial::Ellipsoid& ellipsoid;
+
+  /**
+   * @brief The token that signals that the tile's content is no longer
+   * needed, because the tile dropped out of every load queue.
+   *
+   * Loaders should pass this token to
+   * {@link CesiumAsync::IAssetAccessor::getCancelable}, and should skip
+   * expensive processing, such as decoding, once it has been canceled. A load
+   * that stops early because of cancellation returns a
+   * {@link TileLoadResultState::RetryLater} result or a rejected future, and
+   * the tile may be loaded again later.
+   */
+  CesiumAsync::CancellationToken cancellationToken;
+
+  /**
+   * @brief The priority of the worker thread tasks that process the tile's
+   * content.
+   *
+   * Loaders should pass this priority to
+   * {@link CesiumAsync::Future::thenInWorkerThread} when they decode the
+   * content. Tiles needed by the current view have
+   * {@link CesiumAsync::TaskPriority::High} priority and preloaded tiles have
+   * {@link CesiumAsync::TaskPriority::Low} priority.
+   */
+  CesiumAsync::TaskPriority priority;
 };
 
 /**
@@ -4,8 +4,10 @@
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGltf/Ktx2TranscodeTargets.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <any>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -48,6 +50,35 @@ struct CESIUM3DTILESSELECTION_API TilesetContentOptions {
    */
   CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets;
 
+  /**
+   * @brief The gpu-compressed pixel format to compress the decoded images of
+   * each tile's glTF into, or GpuCompressedPixelFormat::NONE to leave them
+   * uncompressed.
+   *
+   * @see CesiumGltfReader::GltfReaderOptions::imageCompressionFormat
+   */
+  CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat =
+      CesiumGltf::GpuCompressedPixelFormat::NONE;
+
+  /**
+   * @brief The largest width or height, in pixels, of the decoded images of
+   * each tile's glTF, or 0 to decode them at their full size.
+   *
+   * @see CesiumGltfReader::GltfReaderOptions::maximumImageDimension
+   */
+  int32_t maximumImageDimension = 0;
+
+  /**
+   * @brief The pool to allocate the image pixel data and buffer data of each
+   * tile's glTF from, or nullptr to allocate them normally.
+   *
+   * The storage is returned to the pool when the tile's content is unloaded,
+   * so that the content of the next tiles to load can reuse it.
+   *
+   * @see CesiumGltfReader::GltfReaderOptions::pByteBufferPool
+   */
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pByteBufferPool;
+
   /**
    * @brief Whether or not to transform texture coordinates during load when
    * textures have the `KHR_texture_transform` extension. Set this to false if
@@ -55,6 +86,17 @@ struct CESIUM3DTILESSELECTION_API TilesetContentOptions {
    * shader.
    */
   bool applyTextureTransform = true;
+
+  /**
+   * @brief Whether the embedded images and Draco-compressed primitives of each
+   * tile's glTF are decoded in parallel on the worker threads.
+   *
+   * This helps most when tiles are large and few tiles load at once, so that
+   * the worker threads would otherwise sit idle.
+   *
+   * @see CesiumGltfReader::GltfReaderOptions::parallelPostprocessing
+   */
+  bool parallelGltfPostprocessing = false;
 };
 
 /**
@@ -102,6 +144,24 @@ struct CESIUM3DTILESSELECTION_API TilesetOptions {
    */
   uint32_t maximumSimultaneousTileLoads = 20;
 
+  /**
+   * @brief Whether to cancel the loads of tiles that have dropped out of the
+   * load queue of every {@link TilesetViewGroup}.
+   *
+   * A tile's load is canceled when a view group asked for the tile while it
+   * was loading, but no view group or height query asked for it during the
+   * most recent update. Its network request is aborted if the
+   * {@link CesiumAsync::IAssetAccessor} supports that, its content is not
+   * decoded, and the tile may be loaded again later. This frees bandwidth and
+   * worker threads for the tiles that are still needed during fast camera
+   * movement.
+   *
+   * Disable this if view groups are not updated before every call to
+   * {@link Tileset::loadTiles}, because the tiles that they still need would
+   * be canceled.
+   */
+  bool cancelStaleTileLoads = true;
+
   /**
    * @brief Indicates whether the ancestors of rendered tiles should be
    * preloaded. Setting this to true optimizes the zoom-out experience and
@@ -301,6 +361,21 @@ struct CESIUM3DTILESSELECTION_API TilesetOptions {
    */
   double mainThreadLoadingTimeLimit = 0.0;
 
+  /**
+   * @brief A soft limit on how long (in milliseconds) to spend running the
+   * tasks queued for the main thread of the tileset's
+   * {@link CesiumAsync::AsyncSystem} each frame, such as the continuations of
+   * tile loads. A value of 0.0 indicates that all waiting tasks should be run.
+   *
+   * The limit is shared by the calls to {@link Tileset::updateViewGroup} and
+   * {@link Tileset::loadTiles} in a frame, and is separate from
+   * {@link mainThreadLoadingTimeLimit}. Tasks that are not run in one frame
+   * are run in a later one, highest priority first. Because an `AsyncSystem`
+   * may be shared by many tilesets, these tasks may belong to other tilesets
+   * as well.
+   */
+  double mainThreadTaskTimeLimit = 0.0;
+
   /**
    * @brief A soft limit on how long (in milliseconds) to spend unloading
    * cached tiles each frame (each call to {@link Tileset::loadTiles}). A value
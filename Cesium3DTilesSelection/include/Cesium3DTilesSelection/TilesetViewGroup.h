@@ -220,6 +220,16 @@ public:
   /** @inheritdoc */
   const Tile* getNextTileToLoadInWorkerThread() override;
 
+  /**
+   * @brief Gets the priority group of the tile most recently returned by
+   * {@link getNextTileToLoadInWorkerThread}.
+   *
+   * The tileset uses this to choose the priority of the worker thread tasks
+   * that load the tile's content, so that tiles needed by the current view
+   * are decoded before preloaded ones.
+   */
+  TileLoadPriorityGroup getLastWorkerThreadLoadPriorityGroup() const noexcept;
+
   /** @inheritdoc */
   bool hasMoreTilesToLoadInMainThread() const override;
   /** @inheritdoc */
@@ -229,6 +239,8 @@ private:
   double _weight = 1.0;
   std::vector<TileLoadTask> _mainThreadLoadQueue;
   std::vector<TileLoadTask> _workerThreadLoadQueue;
+  TileLoadPriorityGroup _lastWorkerThreadLoadPriorityGroup =
+      TileLoadPriorityGroup::Normal;
   size_t _tilesAlreadyLoadingOrUnloading = 0;
   float _loadProgressPercentage = 0.0f;
   ViewUpdateResult _updateResult;
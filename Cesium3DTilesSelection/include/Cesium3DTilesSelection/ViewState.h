@@ -176,6 +176,16 @@ public:
     return this->_projectionMatrix;
   }
 
+  /**
+   * @brief Gets the culling volume of the view frustum.
+   *
+   * This can be used to cull many bounding volumes at once with
+   * {@link CesiumGeometry::PackedBoundingVolumes::computeVisibility}.
+   */
+  const CesiumGeometry::CullingVolume& getCullingVolume() const noexcept {
+    return this->_cullingVolume;
+  }
+
   /**
    * @brief Returns whether the given {@link BoundingVolume} is visible for this
    * camera
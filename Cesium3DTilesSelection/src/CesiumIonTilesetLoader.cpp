@@ -372,7 +372,9 @@ CesiumIonTilesetLoader::loadTileContent(const TileLoadInput& loadInput) {
       this->_pIonAccessor,
       this->_pLogger,
       loadInput.requestHeaders,
-      loadInput.ellipsoid);
+      loadInput.ellipsoid,
+      loadInput.cancellationToken,
+      loadInput.priority);
 
   return this->_pAggregatedLoader->loadTileContent(aggregatedInput);
 }
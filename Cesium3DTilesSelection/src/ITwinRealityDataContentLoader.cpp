@@ -415,7 +415,9 @@ ITwinRealityDataContentLoader::loadTileContent(const TileLoadInput& loadInput) {
       this->_pRealityDataAccessor,
       this->_pLogger,
       loadInput.requestHeaders,
-      loadInput.ellipsoid);
+      loadInput.ellipsoid,
+      loadInput.cancellationToken,
+      loadInput.priority);
 
   return this->_pAggregatedLoader->loadTileContent(aggregatedInput);
 }
@@ -12,16 +12,19 @@
 #include <Cesium3DTilesSelection/TileLoadResult.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/OctreeTileID.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumUtility/Assert.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <glm/ext/matrix_double4x4.hpp>
 #include <spdlog/logger.h>
@@ -88,18 +91,37 @@ std::vector<Tile> populateSubtree(
 
   OctreeChildren childIDs = ImplicitTilingUtilities::getChildren(octreeID);
 
+  // Look up the availability of all of the children at once. Bit `i` of each
+  // mask is the availability of the `i`th child returned by getChildren.
+  const uint64_t relativeTileMortonID =
+      ImplicitTilingUtilities::computeRelativeMortonIndex(
+          subtreeRootID,
+          octreeID);
+  const uint32_t relativeChildLevel = relativeTileLevel + 1;
+  uint8_t childSubtreeMask = 0;
+  uint8_t childTileMask = 0;
+  uint8_t childContentMask = 0;
+  if (relativeChildLevel == subtreeLevels) {
+    childSubtreeMask = subtreeAvailability.getChildSubtreeAvailabilityMask(
+        relativeTileMortonID);
+  } else {
+    childTileMask = subtreeAvailability.getChildTileAvailabilityMask(
+        relativeTileLevel,
+        relativeTileMortonID);
+    childContentMask = subtreeAvailability.getChildContentAvailabilityMask(
+        relativeTileLevel,
+        relativeTileMortonID,
+        0);
+  }
+
   std::vector<Tile> children;
   children.reserve(childIDs.size());
 
+  uint32_t childIndex = 0;
   for (const CesiumGeometry::OctreeTileID& childID : childIDs) {
-    uint64_t relativeChildMortonID =
-        ImplicitTilingUtilities::computeRelativeMortonIndex(
-            subtreeRootID,
-            childID);
-
-    uint32_t relativeChildLevel = relativeTileLevel + 1;
+    const uint32_t childBit = 1U << childIndex++;
     if (relativeChildLevel == subtreeLevels) {
-      if (subtreeAvailability.isSubtreeAvailable(relativeChildMortonID)) {
+      if (childSubtreeMask & childBit) {
         Tile& child = children.emplace_back(&loader);
         child.setTransform(tile.getTransform());
         child.setBoundingVolume(subdivideBoundingVolume(
@@ -111,13 +133,8 @@ std::vector<Tile> populateSubtree(
         child.setTileID(childID);
       }
     } else {
-      if (subtreeAvailability.isTileAvailable(
-              relativeChildLevel,
-              relativeChildMortonID)) {
-        if (subtreeAvailability.isContentAvailable(
-                relativeChildLevel,
-                relativeChildMortonID,
-                0)) {
+      if (childTileMask & childBit) {
+        if (childContentMask & childBit) {
           children.emplace_back(&loader, childID);
         } else {
           children.emplace_back(&loader, childID, TileEmptyContent{});
@@ -144,19 +161,31 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
     const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
     const std::string& tileUrl,
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders,
+    const CesiumAsync::CancellationToken& cancellationToken,
+    CesiumAsync::TaskPriority priority,
     CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets,
+    CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat,
+    int32_t maximumImageDimension,
+    const std::shared_ptr<CesiumUtility::ByteBufferPool>& pByteBufferPool,
     bool applyTextureTransform,
+    bool parallelGltfPostprocessing,
     const glm::dmat4& tileTransform,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  return pAssetAccessor->get(asyncSystem, tileUrl, requestHeaders)
+  return pAssetAccessor
+      ->getCancelable(asyncSystem, tileUrl, requestHeaders, cancellationToken)
       .thenInWorkerThread(
           [pLogger,
            ktx2TranscodeTargets,
+           imageCompressionFormat,
+           maximumImageDimension,
+           pByteBufferPool,
            applyTextureTransform,
+           parallelGltfPostprocessing,
            &asyncSystem,
            pAssetAccessor = pAssetAccessor,
            tileTransform,
            requestHeaders,
+           cancellationToken,
            ellipsoid](std::shared_ptr<CesiumAsync::IAssetRequest>&&
                           pCompletedRequest) mutable {
             const CesiumAsync::IAssetResponse* pResponse =
@@ -167,6 +196,14 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
                       std::move(pAssetAccessor),
                       std::move(pCompletedRequest)));
             };
+            if (cancellationToken.isCanceled()) {
+              // The tile is no longer needed, so don't spend time decoding it.
+              return asyncSystem.createResolvedFuture(
+                  TileLoadResult::createRetryLaterResult(
+                      std::move(pAssetAccessor),
+                      std::move(pCompletedRequest)));
+            }
+
             const std::string& tileUrl = pCompletedRequest->url();
             if (!pResponse) {
               SPDLOG_LOGGER_ERROR(
@@ -198,7 +235,11 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
               // Convert to gltf
               CesiumGltfReader::GltfReaderOptions gltfOptions;
               gltfOptions.ktx2TranscodeTargets = ktx2TranscodeTargets;
+              gltfOptions.imageCompressionFormat = imageCompressionFormat;
+              gltfOptions.maximumImageDimension = maximumImageDimension;
+              gltfOptions.pByteBufferPool = pByteBufferPool;
               gltfOptions.applyTextureTransform = applyTextureTransform;
+              gltfOptions.parallelPostprocessing = parallelGltfPostprocessing;
               AssetFetcher assetFetcher{
                   asyncSystem,
                   pAssetAccessor,
@@ -206,7 +247,16 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
                   tileTransform,
                   requestHeaders,
                   CesiumGeometry::Axis::Y};
-              return converter(responseData, gltfOptions, assetFetcher)
+              auto owningConverter =
+                  GltfConverters::getOwningConverter(converter);
+              CesiumAsync::Future<GltfConverterResult> futureConverted =
+                  owningConverter
+                      ? owningConverter(
+                            pCompletedRequest->takeResponseData(),
+                            gltfOptions,
+                            assetFetcher)
+                      : converter(responseData, gltfOptions, assetFetcher);
+              return std::move(futureConverted)
                   .thenImmediately(
                       [pAssetAccessor = std::move(pAssetAccessor),
                        pLogger,
@@ -236,7 +286,8 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
             }
             // content type is not supported
             return fail();
-          });
+          },
+          priority);
 }
 } // namespace
 
@@ -333,8 +384,14 @@ ImplicitOctreeLoader::loadTileContent(const TileLoadInput& loadInput) {
       pAssetAccessor,
       tileUrl,
       requestHeaders,
+      loadInput.cancellationToken,
+      loadInput.priority,
       contentOptions.ktx2TranscodeTargets,
+      contentOptions.imageCompressionFormat,
+      contentOptions.maximumImageDimension,
+      contentOptions.pByteBufferPool,
       contentOptions.applyTextureTransform,
+      contentOptions.parallelGltfPostprocessing,
       tile.getTransform(),
       ellipsoid);
 }
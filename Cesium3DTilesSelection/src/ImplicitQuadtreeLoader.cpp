@@ -12,16 +12,19 @@
 #include <Cesium3DTilesSelection/TileLoadResult.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumUtility/Assert.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <glm/ext/matrix_double4x4.hpp>
 #include <spdlog/logger.h>
@@ -98,18 +101,37 @@ std::vector<Tile> populateSubtree(
 
   QuadtreeChildren childIDs = ImplicitTilingUtilities::getChildren(quadtreeID);
 
+  // Look up the availability of all of the children at once. Bit `i` of each
+  // mask is the availability of the `i`th child returned by getChildren.
+  const uint64_t relativeTileMortonID =
+      ImplicitTilingUtilities::computeRelativeMortonIndex(
+          subtreeRootID,
+          quadtreeID);
+  const uint32_t relativeChildLevel = relativeTileLevel + 1;
+  uint8_t childSubtreeMask = 0;
+  uint8_t childTileMask = 0;
+  uint8_t childContentMask = 0;
+  if (relativeChildLevel == subtreeLevels) {
+    childSubtreeMask = subtreeAvailability.getChildSubtreeAvailabilityMask(
+        relativeTileMortonID);
+  } else {
+    childTileMask = subtreeAvailability.getChildTileAvailabilityMask(
+        relativeTileLevel,
+        relativeTileMortonID);
+    childContentMask = subtreeAvailability.getChildContentAvailabilityMask(
+        relativeTileLevel,
+        relativeTileMortonID,
+        0);
+  }
+
   std::vector<Tile> children;
   children.reserve(childIDs.size());
 
+  uint32_t childIndex = 0;
   for (const CesiumGeometry::QuadtreeTileID& childID : childIDs) {
-    uint64_t relativeChildMortonID =
-        ImplicitTilingUtilities::computeRelativeMortonIndex(
-            subtreeRootID,
-            childID);
-
-    uint32_t relativeChildLevel = relativeTileLevel + 1;
+    const uint32_t childBit = 1U << childIndex++;
     if (relativeChildLevel == subtreeLevels) {
-      if (subtreeAvailability.isSubtreeAvailable(relativeChildMortonID)) {
+      if (childSubtreeMask & childBit) {
         Tile& child = children.emplace_back(&loader);
         child.setTransform(tile.getTransform());
         child.setBoundingVolume(subdivideBoundingVolume(
@@ -121,13 +143,8 @@ std::vector<Tile> populateSubtree(
         child.setTileID(childID);
       }
     } else {
-      if (subtreeAvailability.isTileAvailable(
-              relativeChildLevel,
-              relativeChildMortonID)) {
-        if (subtreeAvailability.isContentAvailable(
-                relativeChildLevel,
-                relativeChildMortonID,
-                0)) {
+      if (childTileMask & childBit) {
+        if (childContentMask & childBit) {
           children.emplace_back(&loader, childID);
         } else {
           children.emplace_back(&loader, childID, TileEmptyContent{});
@@ -154,99 +171,134 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
     const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
     const std::string& tileUrl,
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders,
+    const CesiumAsync::CancellationToken& cancellationToken,
+    CesiumAsync::TaskPriority priority,
     CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets,
+    CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat,
+    int32_t maximumImageDimension,
+    const std::shared_ptr<CesiumUtility::ByteBufferPool>& pByteBufferPool,
     bool applyTextureTransform,
+    bool parallelGltfPostprocessing,
     const glm::dmat4& tileTransform,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  return pAssetAccessor->get(asyncSystem, tileUrl, requestHeaders)
-      .thenInWorkerThread([ellipsoid,
-                           pLogger,
-                           ktx2TranscodeTargets,
-                           applyTextureTransform,
-                           &asyncSystem,
-                           pAssetAccessor,
-                           tileTransform,
-                           requestHeaders](
-                              std::shared_ptr<CesiumAsync::IAssetRequest>&&
+  return pAssetAccessor
+      ->getCancelable(asyncSystem, tileUrl, requestHeaders, cancellationToken)
+      .thenInWorkerThread(
+          [ellipsoid,
+           pLogger,
+           ktx2TranscodeTargets,
+           imageCompressionFormat,
+           maximumImageDimension,
+           pByteBufferPool,
+           applyTextureTransform,
+           parallelGltfPostprocessing,
+           &asyncSystem,
+           pAssetAccessor,
+           tileTransform,
+           requestHeaders,
+           cancellationToken](std::shared_ptr<CesiumAsync::IAssetRequest>&&
                                   pCompletedRequest) mutable {
-        const CesiumAsync::IAssetResponse* pResponse =
-            pCompletedRequest->response();
-        auto fail = [&]() {
-          return asyncSystem.createResolvedFuture(
-              TileLoadResult::createFailedResult(
+            const CesiumAsync::IAssetResponse* pResponse =
+                pCompletedRequest->response();
+            auto fail = [&]() {
+              return asyncSystem.createResolvedFuture(
+                  TileLoadResult::createFailedResult(
+                      pAssetAccessor,
+                      std::move(pCompletedRequest)));
+            };
+            if (cancellationToken.isCanceled()) {
+              // The tile is no longer needed, so don't spend time decoding it.
+              return asyncSystem.createResolvedFuture(
+                  TileLoadResult::createRetryLaterResult(
+                      pAssetAccessor,
+                      std::move(pCompletedRequest)));
+            }
+
+            const std::string& tileUrl = pCompletedRequest->url();
+            if (!pResponse) {
+              SPDLOG_LOGGER_ERROR(
+                  pLogger,
+                  "Did not receive a valid response for tile content {}",
+                  tileUrl);
+              return fail();
+            }
+
+            uint16_t statusCode = pResponse->statusCode();
+            if (statusCode != 0 && (statusCode < 200 || statusCode >= 300)) {
+              SPDLOG_LOGGER_ERROR(
+                  pLogger,
+                  "Received status code {} for tile content {}",
+                  statusCode,
+                  tileUrl);
+              return fail();
+            }
+
+            // find gltf converter
+            const auto& responseData = pResponse->data();
+            auto converter = GltfConverters::getConverterByMagic(responseData);
+            if (!converter) {
+              converter = GltfConverters::getConverterByFileExtension(
+                  pCompletedRequest->url());
+            }
+
+            if (converter) {
+              // Convert to gltf
+              CesiumGltfReader::GltfReaderOptions gltfOptions;
+              gltfOptions.ktx2TranscodeTargets = ktx2TranscodeTargets;
+              gltfOptions.imageCompressionFormat = imageCompressionFormat;
+              gltfOptions.maximumImageDimension = maximumImageDimension;
+              gltfOptions.pByteBufferPool = pByteBufferPool;
+              gltfOptions.applyTextureTransform = applyTextureTransform;
+              gltfOptions.parallelPostprocessing = parallelGltfPostprocessing;
+              AssetFetcher assetFetcher{
+                  asyncSystem,
                   pAssetAccessor,
-                  std::move(pCompletedRequest)));
-        };
-        const std::string& tileUrl = pCompletedRequest->url();
-        if (!pResponse) {
-          SPDLOG_LOGGER_ERROR(
-              pLogger,
-              "Did not receive a valid response for tile content {}",
-              tileUrl);
-          return fail();
-        }
-
-        uint16_t statusCode = pResponse->statusCode();
-        if (statusCode != 0 && (statusCode < 200 || statusCode >= 300)) {
-          SPDLOG_LOGGER_ERROR(
-              pLogger,
-              "Received status code {} for tile content {}",
-              statusCode,
-              tileUrl);
-          return fail();
-        }
-
-        // find gltf converter
-        const auto& responseData = pResponse->data();
-        auto converter = GltfConverters::getConverterByMagic(responseData);
-        if (!converter) {
-          converter = GltfConverters::getConverterByFileExtension(
-              pCompletedRequest->url());
-        }
-
-        if (converter) {
-          // Convert to gltf
-          CesiumGltfReader::GltfReaderOptions gltfOptions;
-          gltfOptions.ktx2TranscodeTargets = ktx2TranscodeTargets;
-          gltfOptions.applyTextureTransform = applyTextureTransform;
-          AssetFetcher assetFetcher{
-              asyncSystem,
-              pAssetAccessor,
-              tileUrl,
-              tileTransform,
-              requestHeaders,
-              CesiumGeometry::Axis::Y};
-          return converter(responseData, gltfOptions, assetFetcher)
-              .thenImmediately(
-                  [ellipsoid,
-                   pLogger,
-                   tileUrl,
-                   pAssetAccessor,
-                   pCompletedRequest](GltfConverterResult&& result) mutable {
-                    // Report any errors if there are any
-                    logTileLoadResult(pLogger, tileUrl, result.errors);
-                    if (result.errors || !result.model) {
-                      return TileLoadResult::createFailedResult(
-                          pAssetAccessor,
-                          std::move(pCompletedRequest));
-                    }
-
-                    return TileLoadResult{
-                        std::move(*result.model),
-                        CesiumGeometry::Axis::Y,
-                        std::nullopt,
-                        std::nullopt,
-                        std::nullopt,
-                        pAssetAccessor,
-                        std::move(pCompletedRequest),
-                        {},
-                        TileLoadResultState::Success,
-                        ellipsoid};
-                  });
-        }
-        // content type is not supported
-        return fail();
-      });
+                  tileUrl,
+                  tileTransform,
+                  requestHeaders,
+                  CesiumGeometry::Axis::Y};
+              auto owningConverter =
+                  GltfConverters::getOwningConverter(converter);
+              CesiumAsync::Future<GltfConverterResult> futureConverted =
+                  owningConverter
+                      ? owningConverter(
+                            pCompletedRequest->takeResponseData(),
+                            gltfOptions,
+                            assetFetcher)
+                      : converter(responseData, gltfOptions, assetFetcher);
+              return std::move(futureConverted)
+                  .thenImmediately(
+                      [ellipsoid,
+                       pLogger,
+                       tileUrl,
+                       pAssetAccessor,
+                       pCompletedRequest](
+                          GltfConverterResult&& result) mutable {
+                        // Report any errors if there are any
+                        logTileLoadResult(pLogger, tileUrl, result.errors);
+                        if (result.errors || !result.model) {
+                          return TileLoadResult::createFailedResult(
+                              pAssetAccessor,
+                              std::move(pCompletedRequest));
+                        }
+
+                        return TileLoadResult{
+                            std::move(*result.model),
+                            CesiumGeometry::Axis::Y,
+                            std::nullopt,
+                            std::nullopt,
+                            std::nullopt,
+                            pAssetAccessor,
+                            std::move(pCompletedRequest),
+                            {},
+                            TileLoadResultState::Success,
+                            ellipsoid};
+                      });
+            }
+            // content type is not supported
+            return fail();
+          },
+          priority);
 }
 } // namespace
 
@@ -374,8 +426,14 @@ ImplicitQuadtreeLoader::loadTileContent(const TileLoadInput& loadInput) {
       pAssetAccessor,
       tileUrl,
       requestHeaders,
+      loadInput.cancellationToken,
+      loadInput.priority,
       contentOptions.ktx2TranscodeTargets,
+      contentOptions.imageCompressionFormat,
+      contentOptions.maximumImageDimension,
+      contentOptions.pByteBufferPool,
       contentOptions.applyTextureTransform,
+      contentOptions.parallelGltfPostprocessing,
       tile.getTransform(),
       ellipsoid);
 }
@@ -9,9 +9,11 @@
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <Cesium3DTilesSelection/TilesetOptions.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeometry/QuadtreeTileRectangularRange.h>
@@ -706,46 +708,51 @@ Future<QuantizedMeshLoadResult> requestTileContent(
     const BoundingRegion& boundingRegion,
     const LayerJsonTerrainLoader::Layer& layer,
     const std::vector<IAssetAccessor::THeader>& requestHeaders,
+    const CancellationToken& cancellationToken,
+    TaskPriority priority,
     bool enableWaterMask,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   std::string url = resolveTileUrl(tileID, layer);
-  return pAssetAccessor->get(asyncSystem, url, requestHeaders)
-      .thenInWorkerThread([ellipsoid,
-                           asyncSystem,
-                           pLogger,
-                           tileID,
-                           boundingRegion,
-                           enableWaterMask](
-                              std::shared_ptr<IAssetRequest>&& pRequest) {
-        const IAssetResponse* pResponse = pRequest->response();
-        if (!pResponse) {
-          QuantizedMeshLoadResult result;
-          result.errors.emplaceError(fmt::format(
-              "Did not receive a valid response for tile content {}",
-              pRequest->url()));
-          result.pRequest = std::move(pRequest);
-          return result;
-        }
+  return pAssetAccessor
+      ->getCancelable(asyncSystem, url, requestHeaders, cancellationToken)
+      .thenInWorkerThread(
+          [ellipsoid,
+           asyncSystem,
+           pLogger,
+           tileID,
+           boundingRegion,
+           enableWaterMask](std::shared_ptr<IAssetRequest>&& pRequest) {
+            const IAssetResponse* pResponse = pRequest->response();
+            if (!pResponse) {
+              QuantizedMeshLoadResult result;
+              result.errors.emplaceError(fmt::format(
+                  "Did not receive a valid response for tile content {}",
+                  pRequest->url()));
+              result.pRequest = std::move(pRequest);
+              return result;
+            }
 
-        if (pResponse->statusCode() != 0 &&
-            (pResponse->statusCode() < 200 || pResponse->statusCode() >= 300)) {
-          QuantizedMeshLoadResult result;
-          result.errors.emplaceError(fmt::format(
-              "Received status code {} for tile content {}",
-              pResponse->statusCode(),
-              pRequest->url()));
-          result.pRequest = std::move(pRequest);
-          return result;
-        }
+            if (pResponse->statusCode() != 0 &&
+                (pResponse->statusCode() < 200 ||
+                 pResponse->statusCode() >= 300)) {
+              QuantizedMeshLoadResult result;
+              result.errors.emplaceError(fmt::format(
+                  "Received status code {} for tile content {}",
+                  pResponse->statusCode(),
+                  pRequest->url()));
+              result.pRequest = std::move(pRequest);
+              return result;
+            }
 
-        return QuantizedMeshLoader::load(
-            tileID,
-            boundingRegion,
-            pRequest->url(),
-            pResponse->data(),
-            enableWaterMask,
-            ellipsoid);
-      });
+            return QuantizedMeshLoader::load(
+                tileID,
+                boundingRegion,
+                pRequest->url(),
+                pResponse->data(),
+                enableWaterMask,
+                ellipsoid);
+          },
+          priority);
 }
 
 Future<int> loadTileAvailability(
@@ -871,6 +878,8 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
       *pRegion,
       currentLayer,
       requestHeaders,
+      loadInput.cancellationToken,
+      loadInput.priority,
       contentOptions.enableWaterMask,
       ellipsoid);
 
@@ -6,6 +6,7 @@
 #include <Cesium3DTilesSelection/TileLoadResult.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <CesiumAsync/Future.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/Ellipsoid.h>
@@ -85,14 +86,16 @@ RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
        transform = loadInput.tile.getTransform(),
        textureCoordinateIndex = index,
        tileID = *pTileID,
-       pAssetAccessor = loadInput.pAssetAccessor]() mutable {
+       pAssetAccessor = loadInput.pAssetAccessor,
+       pByteBufferPool = loadInput.contentOptions.pByteBufferPool]() mutable {
         auto model = RasterOverlayUtilities::upsampleGltfForRasterOverlays(
             parentModel,
             tileID,
             false,
             RasterOverlayUtilities::DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
             static_cast<int32_t>(textureCoordinateIndex),
-            ellipsoid);
+            ellipsoid,
+            pByteBufferPool);
         if (!model) {
           return TileLoadResult::createFailedResult(pAssetAccessor, nullptr);
         }
@@ -119,7 +122,8 @@ RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
             {},
             TileLoadResultState::Success,
             ellipsoid};
-      });
+      },
+      loadInput.priority);
 }
 
 TileChildrenResult RasterOverlayUpsampler::createTileChildren(
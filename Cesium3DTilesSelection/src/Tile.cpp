@@ -12,6 +12,7 @@
 #include <CesiumGltf/BufferView.h>
 #include <CesiumGltf/Image.h>
 #include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
@@ -56,6 +57,8 @@ void TileReferenceCountTracker::addEntry(
 }
 #endif
 
+/*static*/ const Tile::ColdProperties Tile::DEFAULT_COLD_PROPERTIES{};
+
 Tile::Tile(TilesetContentLoader* pLoader, const TileID& tileID) noexcept
     : Tile(TileConstructorImpl{}, TileLoadState::Unloaded, pLoader, tileID) {}
 
@@ -90,20 +93,18 @@ Tile::Tile(
     TileContentArgs&&... args)
     : _pParent(nullptr),
       _children(),
-      _id(tileID),
       _boundingVolume(OrientedBoundingBox(glm::dvec3(), glm::dmat3())),
-      _viewerRequestVolume(),
-      _contentBoundingVolume(),
       _geometricError(0.0),
       _refine(TileRefine::Replace),
-      _transform(1.0),
-      _unusedTilesLinks(),
-      _content{std::forward<TileContentArgs>(args)...},
-      _pLoader{pLoader},
       _loadState{loadState},
       _mightHaveLatentChildren{true},
+      _referenceCount(0),
+      _id(tileID),
+      _pLoader{pLoader},
+      _content{std::forward<TileContentArgs>(args)...},
       _rasterTiles(),
-      _referenceCount(0) {
+      _unusedTilesLinks(),
+      _pColdProperties() {
   if (this->hasReferencingContent()) {
     // Add a reference for the loaded content.
     this->addReference("Constructor with content");
@@ -113,20 +114,18 @@ Tile::Tile(
 Tile::Tile(Tile&& rhs) noexcept
     : _pParent(nullptr),
       _children(std::move(rhs._children)),
-      _id(std::move(rhs._id)),
       _boundingVolume(rhs._boundingVolume),
-      _viewerRequestVolume(rhs._viewerRequestVolume),
-      _contentBoundingVolume(rhs._contentBoundingVolume),
       _geometricError(rhs._geometricError),
       _refine(rhs._refine),
-      _transform(rhs._transform),
-      _unusedTilesLinks(),
-      _content(std::move(rhs._content)),
-      _pLoader{rhs._pLoader},
       _loadState{rhs._loadState},
       _mightHaveLatentChildren{rhs._mightHaveLatentChildren},
+      _referenceCount(0),
+      _id(std::move(rhs._id)),
+      _pLoader{rhs._pLoader},
+      _content(std::move(rhs._content)),
       _rasterTiles(std::move(rhs._rasterTiles)),
-      _referenceCount(0) {
+      _unusedTilesLinks(),
+      _pColdProperties(std::move(rhs._pColdProperties)) {
   if (this->hasReferencingContent()) {
     this->addReference("Move constructor with content");
     rhs.releaseReference("RHS passed to move constructor");
@@ -210,6 +209,12 @@ int64_t Tile::computeByteSize() const noexcept {
         bytes += image.pAsset->sizeBytes;
       }
     }
+
+    const CesiumGltfContent::GltfTriangleBvh* pTriangleBvh =
+        pRenderContent->getTriangleBvh();
+    if (pTriangleBvh) {
+      bytes += pTriangleBvh->getSizeBytes();
+    }
   }
 
   return bytes;
@@ -330,6 +335,13 @@ void Tile::setParent(Tile* pParent) noexcept {
 
 void Tile::setState(TileLoadState state) noexcept { this->_loadState = state; }
 
+Tile::ColdProperties& Tile::getOrCreateColdProperties() {
+  if (!this->_pColdProperties) {
+    this->_pColdProperties = std::make_unique<ColdProperties>();
+  }
+  return *this->_pColdProperties;
+}
+
 bool Tile::getMightHaveLatentChildren() const noexcept {
   return this->_mightHaveLatentChildren;
 }
@@ -1,6 +1,7 @@
 #include <Cesium3DTilesSelection/GltfModifierState.h>
 #include <Cesium3DTilesSelection/TileContent.h>
 #include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/CreditSystem.h>
 
@@ -22,7 +23,8 @@ TileRenderContent::TileRenderContent(CesiumGltf::Model&& model)
       _pModifiedRenderResources(nullptr),
       _rasterOverlayDetails{},
       _credits{},
-      _lodTransitionFadePercentage{0.0f} {}
+      _lodTransitionFadePercentage{0.0f},
+      _pTriangleBvh{} {}
 
 const CesiumGltf::Model& TileRenderContent::getModel() const noexcept {
   return this->_model;
@@ -34,10 +36,12 @@ CesiumGltf::Model& TileRenderContent::getModel() noexcept {
 
 void TileRenderContent::setModel(const CesiumGltf::Model& model) {
   this->_model = model;
+  this->_pTriangleBvh.reset();
 }
 
 void TileRenderContent::setModel(CesiumGltf::Model&& model) {
   this->_model = std::move(model);
+  this->_pTriangleBvh.reset();
 }
 
 GltfModifierState TileRenderContent::getGltfModifierState() const noexcept {
@@ -74,6 +78,7 @@ void TileRenderContent::replaceWithModifiedModel() noexcept {
   CESIUM_ASSERT(this->_modifiedModel);
   if (this->_modifiedModel) {
     this->_model = std::move(*this->_modifiedModel);
+    this->_pTriangleBvh.reset();
     // reset after move because this is tested for nullopt in
     // Tile::needsWorkerThreadLoading:
     this->_modifiedModel.reset();
@@ -134,6 +139,21 @@ void TileRenderContent::setLodTransitionFadePercentage(
   this->_lodTransitionFadePercentage = percentage;
 }
 
+const CesiumGltfContent::GltfTriangleBvh*
+TileRenderContent::getTriangleBvh() const noexcept {
+  return this->_pTriangleBvh.get();
+}
+
+const CesiumGltfContent::GltfTriangleBvh&
+TileRenderContent::getOrCreateTriangleBvh() {
+  if (!this->_pTriangleBvh) {
+    this->_pTriangleBvh =
+        std::make_shared<const CesiumGltfContent::GltfTriangleBvh>(
+            this->_model);
+  }
+  return *this->_pTriangleBvh;
+}
+
 TileContent::TileContent() : _contentKind{TileUnknownContent{}} {}
 
 TileContent::TileContent(TileEmptyContent content) : _contentKind{content} {}
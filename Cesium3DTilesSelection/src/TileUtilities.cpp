@@ -2,6 +2,7 @@
 
 #include <Cesium3DTilesSelection/BoundingVolume.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 
@@ -46,6 +47,34 @@ bool outsidePolygons(
       cartographicPolygons);
 }
 
+bool withinPolygons(
+    const BoundingVolume& boundingVolume,
+    const CartographicPolygonIndex& polygonIndex,
+    const Ellipsoid& ellipsoid) noexcept {
+
+  std::optional<GlobeRectangle> maybeRectangle =
+      estimateGlobeRectangle(boundingVolume, ellipsoid);
+  if (!maybeRectangle) {
+    return false;
+  }
+
+  return polygonIndex.rectangleIsWithinPolygons(*maybeRectangle);
+}
+
+bool outsidePolygons(
+    const BoundingVolume& boundingVolume,
+    const CartographicPolygonIndex& polygonIndex,
+    const Ellipsoid& ellipsoid) noexcept {
+
+  std::optional<GlobeRectangle> maybeRectangle =
+      estimateGlobeRectangle(boundingVolume, ellipsoid);
+  if (!maybeRectangle) {
+    return false;
+  }
+
+  return polygonIndex.rectangleIsOutsidePolygons(*maybeRectangle);
+}
+
 } // namespace CesiumImpl
 
 } // namespace Cesium3DTilesSelection
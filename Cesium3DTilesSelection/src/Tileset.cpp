@@ -25,6 +25,12 @@
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/Promise.h>
 #include <CesiumAsync/SharedFuture.h>
+#include <CesiumGeometry/BoundingCylinderRegion.h>
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumGeometry/OrientedBoundingBox.h>
+#include <CesiumGeometry/PackedBoundingVolumes.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/BoundingRegionWithLooseFittingHeights.h>
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
@@ -71,6 +77,8 @@ Tileset::Tileset(
       _options(options),
       _distances(),
       _childOcclusionProxies(),
+      _packedBoundingVolumes(),
+      _frustumVisibility(),
       _pTilesetContentManager{
           new TilesetContentManager(
               _externals,
@@ -90,6 +98,8 @@ Tileset::Tileset(
       _options(options),
       _distances(),
       _childOcclusionProxies(),
+      _packedBoundingVolumes(),
+      _frustumVisibility(),
       _pTilesetContentManager{
           new TilesetContentManager(this->_externals, this->_options, url),
       },
@@ -107,6 +117,8 @@ Tileset::Tileset(
       _options(options),
       _distances(),
       _childOcclusionProxies(),
+      _packedBoundingVolumes(),
+      _frustumVisibility(),
       _pTilesetContentManager{new TilesetContentManager(
           this->_externals,
           this->_options,
@@ -125,6 +137,8 @@ Tileset::Tileset(
       _options(options),
       _distances(),
       _childOcclusionProxies(),
+      _packedBoundingVolumes(),
+      _frustumVisibility(),
       _pTilesetContentManager{new TilesetContentManager(
           _externals,
           _options,
@@ -390,7 +404,7 @@ const ViewUpdateResult& Tileset::updateViewGroup(
   _options.enableFogCulling =
       _options.enableFogCulling && !_options.enableLodTransitionPeriod;
 
-  this->_asyncSystem.dispatchMainThreadTasks();
+  this->_dispatchMainThreadTasks();
 
   ViewUpdateResult& result = viewGroup.getViewUpdateResult();
 
@@ -418,7 +432,20 @@ const ViewUpdateResult& Tileset::updateViewGroup(
 
   if (!frustums.empty()) {
     viewGroup.startNewFrame(*this, frameState);
-    this->_visitTileIfNeeded(frameState, 0, false, *pRootTile, result);
+    this->_frustumVisibility.clear();
+    this->_computeFrustumVisibility(
+        frustums,
+        std::span<const Tile>(pRootTile, 1));
+    const bool isRootInFrustum = this->_frustumVisibility.front() != 0;
+    this->_frustumVisibility.clear();
+
+    this->_visitTileIfNeeded(
+        frameState,
+        0,
+        false,
+        *pRootTile,
+        isRootInFrustum,
+        result);
     viewGroup.finishFrame(*this, frameState);
   } else {
     result = ViewUpdateResult();
@@ -438,7 +465,8 @@ const ViewUpdateResult& Tileset::updateViewGroup(
 void Tileset::loadTiles() {
   CESIUM_TRACE("Tileset::loadTiles");
 
-  this->_asyncSystem.dispatchMainThreadTasks();
+  this->_dispatchMainThreadTasks();
+  this->_mainThreadTaskTimeThisFrame = 0.0;
 
   Tile* pRootTile = this->_pTilesetContentManager->getRootTile();
   if (!pRootTile) {
@@ -462,11 +490,31 @@ void Tileset::loadTiles() {
   this->_pTilesetContentManager->unloadCachedBytes(
       this->_options.maximumCachedBytes,
       this->_options.tileCacheUnloadTimeLimit);
+  if (this->_options.cancelStaleTileLoads) {
+    this->_pTilesetContentManager->cancelStaleTileLoads();
+  }
   this->_pTilesetContentManager->processWorkerThreadLoadRequests(
       this->_options);
   this->_pTilesetContentManager->processMainThreadLoadRequests(this->_options);
 }
 
+void Tileset::_dispatchMainThreadTasks() {
+  const double timeLimit = this->_options.mainThreadTaskTimeLimit;
+  if (timeLimit <= 0.0) {
+    this->_asyncSystem.dispatchMainThreadTasks();
+    return;
+  }
+
+  const double remaining = timeLimit - this->_mainThreadTaskTimeThisFrame;
+  if (remaining <= 0.0) {
+    return;
+  }
+
+  const MainThreadDispatchStatistics statistics =
+      this->_asyncSystem.dispatchMainThreadTasks(remaining);
+  this->_mainThreadTaskTimeThisFrame += statistics.elapsedMilliseconds;
+}
+
 void Tileset::registerLoadRequester(TileLoadRequester& requester) {
   this->_pTilesetContentManager->registerTileRequester(requester);
 }
@@ -645,41 +693,81 @@ void addCurrentTileAndDescendantsToTilesFadingOutIfPreviouslyRendered(
 }
 
 /**
- * @brief Returns whether a tile with the given bounding volume is visible for
- * the camera.
+ * @brief Returns whether the camera of any of the given frustums is directly
+ * above or below a tile with the given bounding volume.
  *
- * @param viewState The {@link ViewState}
- * @param boundingVolume The bounding volume of the tile
- * @param forceRenderTilesUnderCamera Whether tiles under the camera should
- * always be considered visible and rendered (see
- * {@link Cesium3DTilesSelection::TilesetOptions}).
- * @return Whether the tile is visible according to the current camera
- * configuration
+ * This is used to keep tiles under the camera visible when
+ * {@link Cesium3DTilesSelection::TilesetOptions::renderTilesUnderCamera} is
+ * enabled.
  */
-bool isVisibleFromCamera(
-    const ViewState& viewState,
+bool isUnderCamera(
+    const std::vector<ViewState>& frustums,
     const BoundingVolume& boundingVolume,
-    const Ellipsoid& ellipsoid,
-    bool forceRenderTilesUnderCamera) {
-  if (viewState.isBoundingVolumeVisible(boundingVolume)) {
-    return true;
-  }
-  if (!forceRenderTilesUnderCamera) {
-    return false;
-  }
-
-  const std::optional<CesiumGeospatial::Cartographic>& position =
-      viewState.getPositionCartographic();
-
+    const Ellipsoid& ellipsoid) {
   // TODO: it would be better to test a line pointing down (and up?) from the
   // camera against the bounding volume itself, rather than transforming the
   // bounding volume to a region.
-  std::optional<GlobeRectangle> maybeRectangle =
+  const std::optional<GlobeRectangle> maybeRectangle =
       estimateGlobeRectangle(boundingVolume, ellipsoid);
-  if (position && maybeRectangle) {
-    return maybeRectangle->contains(position.value());
+  if (!maybeRectangle) {
+    return false;
   }
-  return false;
+
+  return std::any_of(
+      frustums.begin(),
+      frustums.end(),
+      [&rectangle = *maybeRectangle](const ViewState& frustum) {
+        const std::optional<CesiumGeospatial::Cartographic>& position =
+            frustum.getPositionCartographic();
+        return position && rectangle.contains(*position);
+      });
+}
+
+/**
+ * @brief Adds a bounding volume to a set of packed bounding volumes, if it
+ * can be represented there.
+ *
+ * @return Whether the bounding volume was added.
+ */
+bool packBoundingVolume(
+    const BoundingVolume& boundingVolume,
+    PackedBoundingVolumes& packed) {
+  struct Operation {
+    PackedBoundingVolumes& packed;
+
+    bool operator()(const OrientedBoundingBox& boundingBox) {
+      packed.addOrientedBox(boundingBox);
+      return true;
+    }
+
+    bool operator()(const BoundingRegion& boundingRegion) {
+      packed.addOrientedBox(boundingRegion.getBoundingBox());
+      return true;
+    }
+
+    bool operator()(const BoundingSphere& boundingSphere) {
+      packed.addSphere(boundingSphere);
+      return true;
+    }
+
+    bool
+    operator()(const BoundingRegionWithLooseFittingHeights& boundingRegion) {
+      packed.addOrientedBox(boundingRegion.getBoundingRegion().getBoundingBox());
+      return true;
+    }
+
+    bool operator()(const S2CellBoundingVolume& /* s2Cell */) {
+      // S2 cells are culled using their vertices rather than a box.
+      return false;
+    }
+
+    bool operator()(const BoundingCylinderRegion& boundingCylinderRegion) {
+      packed.addOrientedBox(boundingCylinderRegion.toOrientedBoundingBox());
+      return true;
+    }
+  };
+
+  return std::visit(Operation{packed}, boundingVolume);
 }
 
 /**
@@ -703,6 +791,7 @@ void Tileset::_frustumCull(
     const Tile& tile,
     const TilesetFrameState& frameState,
     bool cullWithChildrenBounds,
+    bool isInFrustum,
     CullResult& cullResult) {
 
   if (!cullResult.shouldVisit || cullResult.culled) {
@@ -712,45 +801,39 @@ void Tileset::_frustumCull(
   const CesiumGeospatial::Ellipsoid& ellipsoid = this->getEllipsoid();
 
   const std::vector<ViewState>& frustums = frameState.frustums;
+  const bool renderTilesUnderCamera = this->_options.renderTilesUnderCamera;
+
   // Frustum cull using the children's bounds.
   if (cullWithChildrenBounds) {
-    if (std::any_of(
-            frustums.begin(),
-            frustums.end(),
-            [&ellipsoid,
-             children = tile.getChildren(),
-             renderTilesUnderCamera = this->_options.renderTilesUnderCamera](
-                const ViewState& frustum) {
-              for (const Tile& child : children) {
-                if (isVisibleFromCamera(
-                        frustum,
-                        child.getBoundingVolume(),
-                        ellipsoid,
-                        renderTilesUnderCamera)) {
-                  return true;
-                }
-              }
-
-              return false;
-            })) {
+    const std::span<const Tile> children = tile.getChildren();
+
+    const size_t first = this->_frustumVisibility.size();
+    this->_computeFrustumVisibility(frustums, children);
+    const bool isAnyChildInFrustum = std::any_of(
+        this->_frustumVisibility.begin() + std::ptrdiff_t(first),
+        this->_frustumVisibility.end(),
+        [](uint8_t visible) { return visible != 0; });
+    this->_frustumVisibility.resize(first);
+
+    if (isAnyChildInFrustum ||
+        (renderTilesUnderCamera &&
+         std::any_of(
+             children.begin(),
+             children.end(),
+             [&frustums, &ellipsoid](const Tile& child) {
+               return isUnderCamera(
+                   frustums,
+                   child.getBoundingVolume(),
+                   ellipsoid);
+             }))) {
       // At least one child is visible in at least one frustum, so don't cull.
       return;
     }
     // Frustum cull based on the actual tile's bounds.
-  } else if (std::any_of(
-                 frustums.begin(),
-                 frustums.end(),
-                 [&ellipsoid,
-                  &boundingVolume = tile.getBoundingVolume(),
-                  renderTilesUnderCamera =
-                      this->_options.renderTilesUnderCamera](
-                     const ViewState& frustum) {
-                   return isVisibleFromCamera(
-                       frustum,
-                       boundingVolume,
-                       ellipsoid,
-                       renderTilesUnderCamera);
-                 })) {
+  } else if (
+      isInFrustum ||
+      (renderTilesUnderCamera &&
+       isUnderCamera(frustums, tile.getBoundingVolume(), ellipsoid))) {
     // The tile is visible in at least one frustum, so don't cull.
     return;
   }
@@ -841,7 +924,7 @@ void computeDistances(
       frustums.begin(),
       frustums.end(),
       distances.begin(),
-      [boundingVolume](const ViewState& frustum) -> double {
+      [&boundingVolume](const ViewState& frustum) -> double {
         return glm::sqrt(glm::max(
             frustum.computeDistanceSquaredToBoundingVolume(boundingVolume),
             0.0));
@@ -886,6 +969,7 @@ Tileset::TraversalDetails Tileset::_visitTileIfNeeded(
     uint32_t depth,
     bool ancestorMeetsSse,
     Tile& tile,
+    bool isInFrustum,
     ViewUpdateResult& result) {
   TilesetViewGroup::TraversalState& traversalState =
       frameState.viewGroup.getTraversalState();
@@ -923,7 +1007,12 @@ Tileset::TraversalDetails Tileset::_visitTileIfNeeded(
   }
 
   // TODO: abstract culling stages into composable interface?
-  this->_frustumCull(tile, frameState, cullWithChildrenBounds, cullResult);
+  this->_frustumCull(
+      tile,
+      frameState,
+      cullWithChildrenBounds,
+      isInFrustum,
+      cullResult);
   this->_fogCull(frameState, distances, cullResult);
 
   if (!cullResult.shouldVisit && tile.getUnconditionallyRefine()) {
@@ -1496,12 +1585,20 @@ Tileset::TraversalDetails Tileset::_visitVisibleChildrenNearToFar(
 
   // TODO: actually visit near-to-far, rather than in order of occurrence.
   std::span<Tile> children = tile.getChildren();
-  for (Tile& child : children) {
+
+  // Frustum cull all the children at once. Visiting a child pushes and pops
+  // the visibility of its own children, so the elements for these children
+  // stay at the same indices.
+  const size_t first = this->_frustumVisibility.size();
+  this->_computeFrustumVisibility(frameState.frustums, children);
+
+  for (size_t i = 0; i < children.size(); ++i) {
     const TraversalDetails childTraversal = this->_visitTileIfNeeded(
         frameState,
         depth + 1,
         ancestorMeetsSse,
-        child,
+        children[i],
+        this->_frustumVisibility[first + i] != 0,
         result);
 
     traversalDetails.allAreRenderable &= childTraversal.allAreRenderable;
@@ -1511,14 +1608,56 @@ Tileset::TraversalDetails Tileset::_visitVisibleChildrenNearToFar(
         childTraversal.notYetRenderableCount;
   }
 
+  this->_frustumVisibility.resize(first);
+
   return traversalDetails;
 }
 
+void Tileset::_computeFrustumVisibility(
+    const std::vector<ViewState>& frustums,
+    std::span<const Tile> tiles) {
+  const size_t first = this->_frustumVisibility.size();
+  this->_frustumVisibility.resize(first + tiles.size(), uint8_t(0));
+  const std::span<uint8_t> visible =
+      std::span<uint8_t>(this->_frustumVisibility).subspan(first);
+
+  PackedBoundingVolumes& packed = this->_packedBoundingVolumes;
+  packed.clear();
+  for (const Tile& tile : tiles) {
+    if (!packBoundingVolume(tile.getBoundingVolume(), packed)) {
+      break;
+    }
+  }
+
+  if (packed.size() == tiles.size()) {
+    for (const ViewState& frustum : frustums) {
+      packed.computeVisibility(frustum.getCullingVolume(), visible);
+    }
+    return;
+  }
+
+  // Some bounding volumes can't be packed, so cull each tile individually.
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    const BoundingVolume& boundingVolume = tiles[i].getBoundingVolume();
+    visible[i] = uint8_t(std::any_of(
+        frustums.begin(),
+        frustums.end(),
+        [&boundingVolume](const ViewState& frustum) {
+          return frustum.isBoundingVolumeVisible(boundingVolume);
+        }));
+  }
+}
+
 void Tileset::addTileToLoadQueue(
     const TilesetFrameState& frameState,
     Tile& tile,
     TileLoadPriorityGroup priorityGroup,
     double priority) {
+  if (tile.getState() == TileLoadState::ContentLoading) {
+    // Keep the tile's load from being canceled as stale.
+    this->_pTilesetContentManager->markTileLoadRequested(tile);
+  }
+
   frameState.viewGroup.addToLoadQueue(
       TileLoadTask{&tile, priorityGroup, priority},
       this->_externals.pGltfModifier);
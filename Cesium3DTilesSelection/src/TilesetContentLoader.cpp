@@ -5,8 +5,10 @@
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <Cesium3DTilesSelection/TilesetOptions.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 
@@ -25,14 +27,18 @@ TileLoadInput::TileLoadInput(
     const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor_,
     const std::shared_ptr<spdlog::logger>& pLogger_,
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders_,
-    const CesiumGeospatial::Ellipsoid& ellipsoid_)
+    const CesiumGeospatial::Ellipsoid& ellipsoid_,
+    const CesiumAsync::CancellationToken& cancellationToken_,
+    CesiumAsync::TaskPriority priority_)
     : tile{tile_},
       contentOptions{contentOptions_},
       asyncSystem{asyncSystem_},
       pAssetAccessor{pAssetAccessor_},
       pLogger{pLogger_},
       requestHeaders{requestHeaders_},
-      ellipsoid(ellipsoid_) {}
+      ellipsoid(ellipsoid_),
+      cancellationToken(cancellationToken_),
+      priority(priority_) {}
 
 TileLoadResult TileLoadResult::createFailedResult(
     std::shared_ptr<CesiumAsync::IAssetAccessor> pAssetAccessor,
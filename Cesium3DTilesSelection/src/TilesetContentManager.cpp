@@ -17,6 +17,7 @@
 #include <Cesium3DTilesSelection/TileID.h>
 #include <Cesium3DTilesSelection/TileLoadRequester.h>
 #include <Cesium3DTilesSelection/TileLoadResult.h>
+#include <Cesium3DTilesSelection/TileLoadTask.h>
 #include <Cesium3DTilesSelection/TileRefine.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <Cesium3DTilesSelection/TilesetContentLoaderFactory.h>
@@ -24,11 +25,14 @@
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <Cesium3DTilesSelection/TilesetLoadFailureDetails.h>
 #include <Cesium3DTilesSelection/TilesetOptions.h>
+#include <Cesium3DTilesSelection/TilesetViewGroup.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/HttpHeaders.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumAsync/SharedFuture.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
@@ -39,6 +43,7 @@
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumGltf/Image.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumRasterOverlays/ActivatedRasterOverlay.h>
@@ -452,7 +457,8 @@ void calcRasterOverlayDetailsInWorkerThread(
           std::move(projections),
           false,
           RasterOverlayUtilities::DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
-          firstRasterOverlayTexCoord);
+          firstRasterOverlayTexCoord,
+          tileLoadInfo.contentOptions.pByteBufferPool);
 
   if (pRegion && overlayDetails) {
     // If the original bounding region was wrong, report it.
@@ -580,6 +586,11 @@ postProcessContentInWorkerThread(
   CesiumGltfReader::GltfReaderOptions gltfOptions;
   gltfOptions.ktx2TranscodeTargets =
       tileLoadInfo.contentOptions.ktx2TranscodeTargets;
+  gltfOptions.imageCompressionFormat =
+      tileLoadInfo.contentOptions.imageCompressionFormat;
+  gltfOptions.maximumImageDimension =
+      tileLoadInfo.contentOptions.maximumImageDimension;
+  gltfOptions.pByteBufferPool = tileLoadInfo.contentOptions.pByteBufferPool;
   gltfOptions.applyTextureTransform =
       tileLoadInfo.contentOptions.applyTextureTransform;
   if (tileLoadInfo.pSharedAssetSystem) {
@@ -713,6 +724,12 @@ postProcessContentInWorkerThread(
       });
 }
 
+int64_t getTriangleBvhSizeBytes(const TileRenderContent& renderContent) {
+  const CesiumGltfContent::GltfTriangleBvh* pTriangleBvh =
+      renderContent.getTriangleBvh();
+  return pTriangleBvh ? pTriangleBvh->getSizeBytes() : 0;
+}
+
 } // namespace
 
 TilesetContentManager::TilesetContentManager(
@@ -1189,6 +1206,8 @@ void TilesetContentManager::reapplyGltfModifier(
                 pRenderContent->getRenderResources(),
                 nullptr);
           }
+          // Replacing the model discards its triangle BVH.
+          this->_tilesDataUsed -= getTriangleBvhSizeBytes(*pRenderContent);
           pRenderContent->setModel(
               std::move(std::get<CesiumGltf::Model>(pair.result.contentKind)));
           pRenderContent->setRenderResources(pair.pRenderResources);
@@ -1242,7 +1261,8 @@ void TilesetContentManager::reapplyGltfModifier(
 
 void TilesetContentManager::loadTileContent(
     Tile& tile,
-    const TilesetOptions& tilesetOptions) {
+    const TilesetOptions& tilesetOptions,
+    CesiumAsync::TaskPriority priority) {
   CESIUM_TRACE("TilesetContentManager::loadTileContent");
 
   if (this->_externals.pGltfModifier &&
@@ -1287,7 +1307,7 @@ void TilesetContentManager::loadTileContent(
     Tile* pParentTile = tile.getParent();
     if (pParentTile) {
       if (pParentTile->getState() != TileLoadState::Done) {
-        loadTileContent(*pParentTile, tilesetOptions);
+        loadTileContent(*pParentTile, tilesetOptions, priority);
 
         // Finalize the parent if necessary, otherwise it may never reach the
         // Done state. Also double check that we have render content in ensure
@@ -1317,6 +1337,13 @@ void TilesetContentManager::loadTileContent(
   notifyTileStartLoading(&tile);
   tile.setState(TileLoadState::ContentLoading);
 
+  CesiumAsync::CancellationSource cancellationSource;
+  CesiumAsync::CancellationToken cancellationToken =
+      cancellationSource.getToken();
+  this->_loadingTiles.insert_or_assign(
+      &tile,
+      TileLoadInProgress{std::move(cancellationSource)});
+
   TileContentLoadInfo tileLoadInfo{
       this->_externals.asyncSystem,
       this->_externals.pAssetAccessor,
@@ -1340,7 +1367,9 @@ void TilesetContentManager::loadTileContent(
       this->_externals.pAssetAccessor,
       this->_externals.pLogger,
       this->_requestHeaders,
-      tilesetOptions.ellipsoid};
+      tilesetOptions.ellipsoid,
+      cancellationToken,
+      priority};
 
   // Keep the manager alive while the load is in progress.
   CesiumUtility::IntrusivePointer<TilesetContentManager> thiz = this;
@@ -1352,8 +1381,9 @@ void TilesetContentManager::loadTileContent(
                         tileLoadInfo = std::move(tileLoadInfo),
                         projections = std::move(projections),
                         rendererOptions = tilesetOptions.rendererOptions,
-                        pGltfModifier = _externals.pGltfModifier](
-                           TileLoadResult&& result) mutable {
+                        pGltfModifier = _externals.pGltfModifier,
+                        cancellationToken,
+                        priority](TileLoadResult&& result) mutable {
         // the reason we run immediate continuation, instead of in the
         // worker thread, is that the loader may run the task in the main
         // thread. And most often than not, those main thread task is very
@@ -1363,6 +1393,17 @@ void TilesetContentManager::loadTileContent(
         // worker thread if the content is a render content
         if (result.state == TileLoadResultState::Success) {
           if (std::holds_alternative<CesiumGltf::Model>(result.contentKind)) {
+            if (cancellationToken.isCanceled()) {
+              // The tile is no longer needed, so don't spend time preparing
+              // its renderer resources. It can be loaded again later.
+              return asyncSystem
+                  .createResolvedFuture<TileLoadResultAndRenderResources>(
+                      {TileLoadResult::createRetryLaterResult(
+                           std::move(result.pAssetAccessor),
+                           std::move(result.pCompletedRequest)),
+                       nullptr});
+            }
+
             return asyncSystem.runInWorkerThread(
                 [result = std::move(result),
                  projections = std::move(projections),
@@ -1375,7 +1416,8 @@ void TilesetContentManager::loadTileContent(
                       std::move(tileLoadInfo),
                       rendererOptions,
                       pGltfModifier);
-                });
+                },
+                priority);
           }
         }
 
@@ -1383,26 +1425,43 @@ void TilesetContentManager::loadTileContent(
             .createResolvedFuture<TileLoadResultAndRenderResources>(
                 {std::move(result), nullptr});
       })
-      .thenInMainThread([pTile, thiz](TileLoadResultAndRenderResources&& pair) {
-        setTileContent(*pTile, std::move(pair.result), pair.pRenderResources);
-        thiz->notifyTileDoneLoading(pTile.get());
-
-        if (thiz->_externals.pGltfModifier) {
-          const TileRenderContent* pRenderContent =
-              pTile->getContent().getRenderContent();
-          CESIUM_ASSERT(!pRenderContent || !pRenderContent->getModifiedModel());
-          if (pRenderContent &&
-              GltfModifierVersionExtension::getVersion(
-                  pRenderContent->getModel()) !=
-                  thiz->_externals.pGltfModifier->getCurrentVersion()) {
-            thiz->_externals.pGltfModifier->onOldVersionContentLoadingComplete(
-                *pTile);
-          }
-        }
-      })
+      // Finishing the load of a tile that a view needs now is more urgent than
+      // other main thread work, so it runs at the priority of the load.
+      .thenInMainThread(
+          [pTile, thiz](TileLoadResultAndRenderResources&& pair) {
+            thiz->finishTrackingTileLoad(pTile.get());
+            setTileContent(
+                *pTile,
+                std::move(pair.result),
+                pair.pRenderResources);
+            thiz->notifyTileDoneLoading(pTile.get());
+
+            if (thiz->_externals.pGltfModifier) {
+              const TileRenderContent* pRenderContent =
+                  pTile->getContent().getRenderContent();
+              CESIUM_ASSERT(
+                  !pRenderContent || !pRenderContent->getModifiedModel());
+              if (pRenderContent &&
+                  GltfModifierVersionExtension::getVersion(
+                      pRenderContent->getModel()) !=
+                      thiz->_externals.pGltfModifier->getCurrentVersion()) {
+                thiz->_externals.pGltfModifier
+                    ->onOldVersionContentLoadingComplete(*pTile);
+              }
+            }
+          },
+          priority)
       .catchInMainThread([pLogger = this->_externals.pLogger, pTile, thiz](
                              std::exception&& e) {
         pTile->getMappedRasterTiles().clear();
+        if (thiz->finishTrackingTileLoad(pTile.get())) {
+          // The load was abandoned because the tile is no longer needed, so
+          // allow it to be loaded again later.
+          pTile->setState(TileLoadState::FailedTemporarily);
+          thiz->notifyTileDoneLoading(pTile.get());
+          return;
+        }
+
         pTile->setState(TileLoadState::Failed);
         thiz->notifyTileDoneLoading(pTile.get());
         SPDLOG_LOGGER_ERROR(
@@ -1683,6 +1742,7 @@ void TilesetContentManager::finishLoading(
 
     // Replace model and render resources with the newly modified versions,
     // discarding the old ones
+    this->_tilesDataUsed -= getTriangleBvhSizeBytes(*pRenderContent);
     pRenderContent->replaceWithModifiedModel();
 
     // Run the main thread part of loading.
@@ -1743,6 +1803,18 @@ void TilesetContentManager::markTileIneligibleForContentUnloading(Tile& tile) {
   this->_tilesEligibleForContentUnloading.remove(tile);
 }
 
+const CesiumGltfContent::GltfTriangleBvh&
+TilesetContentManager::getOrCreateTriangleBvh(
+    TileRenderContent& renderContent) {
+  const CesiumGltfContent::GltfTriangleBvh* pTriangleBvh =
+      renderContent.getTriangleBvh();
+  if (!pTriangleBvh) {
+    pTriangleBvh = &renderContent.getOrCreateTriangleBvh();
+    this->_tilesDataUsed += pTriangleBvh->getSizeBytes();
+  }
+  return *pTriangleBvh;
+}
+
 void TilesetContentManager::markTileEligibleForContentUnloading(Tile& tile) {
   // If the tile is not yet in the list, add it to the end (most recently used).
   if (!this->_tilesEligibleForContentUnloading.contains(tile)) {
@@ -1902,6 +1974,7 @@ public:
       return nullptr;
 
     TileLoadRequester& requester = *this->_requestersWithRequests[index];
+    this->_pLastRequester = &requester;
 
     const Tile* pToLoad = std::invoke(this->_getNextTileToLoad, requester);
     CESIUM_ASSERT(pToLoad);
@@ -1917,6 +1990,14 @@ public:
     return const_cast<Tile*>(pToLoad);
   }
 
+  /**
+   * @brief Gets the requester of the tile last returned by
+   * {@link getNextTileToLoad}.
+   */
+  TileLoadRequester* getLastRequester() const noexcept {
+    return this->_pLastRequester;
+  }
+
 private:
   /**
    * @brief Recompute the fractions for each requester to affect the frequency
@@ -1964,6 +2045,7 @@ private:
   std::vector<double>& _fractions;
   HasMoreTilesToLoad _hasMoreTilesToLoad;
   GetNextTileToLoad _getNextTileToLoad;
+  TileLoadRequester* _pLastRequester = nullptr;
 };
 
 } // namespace
@@ -1996,7 +2078,28 @@ void TilesetContentManager::processWorkerThreadLoadRequests(
     if (pToLoad->_referenceCount == 0)
       continue;
 
-    this->loadTileContent(*pToLoad, options);
+    const TilesetViewGroup* pViewGroup =
+        dynamic_cast<const TilesetViewGroup*>(wrr.getLastRequester());
+
+    // Tiles that a view needs now are processed ahead of other worker thread
+    // work, such as cache writes, and preloaded tiles are processed after it.
+    CesiumAsync::TaskPriority priority = CesiumAsync::TaskPriority::Normal;
+    if (pViewGroup) {
+      priority = pViewGroup->getLastWorkerThreadLoadPriorityGroup() ==
+                         TileLoadPriorityGroup::Preload
+                     ? CesiumAsync::TaskPriority::Low
+                     : CesiumAsync::TaskPriority::High;
+    }
+
+    this->loadTileContent(*pToLoad, options, priority);
+
+    // A view group requests the tiles it still needs every frame, so a load
+    // it started can be canceled as soon as it stops requesting it. Other
+    // requesters may not, so their loads are only canceled once they have
+    // requested them again while loading.
+    if (pViewGroup) {
+      this->markTileLoadRequested(*pToLoad);
+    }
   }
 }
 
@@ -2036,6 +2139,23 @@ void TilesetContentManager::processMainThreadLoadRequests(
   }
 }
 
+void TilesetContentManager::markTileLoadRequested(const Tile& tile) noexcept {
+  auto it = this->_loadingTiles.find(&tile);
+  if (it != this->_loadingTiles.end()) {
+    it->second.requestedRecently = true;
+    it->second.requestedEver = true;
+  }
+}
+
+void TilesetContentManager::cancelStaleTileLoads() noexcept {
+  for (auto& [pTile, load] : this->_loadingTiles) {
+    if (load.requestedEver && !load.requestedRecently) {
+      load.cancellationSource.cancel();
+    }
+    load.requestedRecently = false;
+  }
+}
+
 void TilesetContentManager::markTilesetDestroyed() noexcept {
   this->_tilesetDestroyed = true;
 
@@ -2257,6 +2377,17 @@ void TilesetContentManager::notifyTileStartLoading(
   ++this->_tileLoadsInProgress;
 }
 
+bool TilesetContentManager::finishTrackingTileLoad(const Tile* pTile) noexcept {
+  auto it = this->_loadingTiles.find(pTile);
+  if (it == this->_loadingTiles.end()) {
+    return false;
+  }
+
+  const bool canceled = it->second.cancellationSource.isCanceled();
+  this->_loadingTiles.erase(it);
+  return canceled;
+}
+
 void TilesetContentManager::notifyTileDoneLoading(const Tile* pTile) noexcept {
   CESIUM_ASSERT(
       this->_tileLoadsInProgress > 0 &&
@@ -12,10 +12,13 @@
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <Cesium3DTilesSelection/TilesetLoadFailureDetails.h>
 #include <Cesium3DTilesSelection/TilesetOptions.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumUtility/CreditSystem.h>
 #include <CesiumUtility/ReferenceCounted.h>
 
+#include <unordered_map>
 #include <vector>
 
 namespace Cesium3DTilesSelection {
@@ -86,7 +89,10 @@ public:
 
   ~TilesetContentManager() noexcept;
 
-  void loadTileContent(Tile& tile, const TilesetOptions& tilesetOptions);
+  void loadTileContent(
+      Tile& tile,
+      const TilesetOptions& tilesetOptions,
+      CesiumAsync::TaskPriority priority = CesiumAsync::TaskPriority::Normal);
 
   void updateTileContent(Tile& tile, const TilesetOptions& tilesetOptions);
 
@@ -154,6 +160,11 @@ public:
   void finishLoading(Tile& tile, const TilesetOptions& tilesetOptions);
 
   void markTileIneligibleForContentUnloading(Tile& tile);
+
+  // Gets the triangle BVH of loaded render content, building it first if
+  // necessary, and counts it in the total data used.
+  const CesiumGltfContent::GltfTriangleBvh&
+  getOrCreateTriangleBvh(TileRenderContent& renderContent);
   void markTileEligibleForContentUnloading(Tile& tile);
 
   /**
@@ -177,6 +188,27 @@ public:
   void processWorkerThreadLoadRequests(const TilesetOptions& options);
   void processMainThreadLoadRequests(const TilesetOptions& options);
 
+  /**
+   * @brief Records that a tile whose content is loading is still needed. This
+   * does nothing if the tile's content is not loading.
+   *
+   * View groups call this for each tile that they would add to their load
+   * queues if it were not already loading. Other requesters call it for the
+   * loading tiles that they are waiting for.
+   */
+  void markTileLoadRequested(const Tile& tile) noexcept;
+
+  /**
+   * @brief Cancels the content loads of tiles that were requested at some
+   * point while they were loading, but not since the last call to this method.
+   *
+   * Loads that were never requested while they were loading, such as those
+   * started by other requesters, are not canceled. A canceled tile returns to
+   * the {@link TileLoadState::FailedTemporarily} state, or finishes loading if
+   * it was too late to stop it.
+   */
+  void cancelStaleTileLoads() noexcept;
+
   void markTilesetDestroyed() noexcept;
   void releaseReference() const;
 
@@ -204,6 +236,10 @@ private:
 
   void notifyTileUnloading(const Tile* pTile) noexcept;
 
+  // Stops tracking the load of the given tile, and returns whether the load
+  // was canceled.
+  bool finishTrackingTileLoad(const Tile* pTile) noexcept;
+
   void reapplyGltfModifier(
       Tile& tile,
       const TilesetOptions& tilesetOptions,
@@ -245,6 +281,17 @@ private:
   // the tail are the most recently used.
   Tile::UnusedLinkedList _tilesEligibleForContentUnloading;
 
+  // The cancellation state of each tile that is loading content.
+  struct TileLoadInProgress {
+    CesiumAsync::CancellationSource cancellationSource;
+    // Whether the tile has been requested since the last call to
+    // cancelStaleTileLoads.
+    bool requestedRecently = false;
+    // Whether the tile has been requested at all since its load started.
+    bool requestedEver = false;
+  };
+  std::unordered_map<const Tile*, TileLoadInProgress> _loadingTiles;
+
   std::vector<TileLoadRequester*> _requesters;
   double _roundRobinValueWorker;
   double _roundRobinValueMain;
@@ -10,22 +10,28 @@
 #include <Cesium3DTilesSelection/TileRefine.h>
 #include <CesiumAsync/Promise.h>
 #include <CesiumGeometry/BoundingCylinderRegion.h>
+#include <CesiumGeometry/BoundingSphere.h>
 #include <CesiumGeometry/IntersectionTests.h>
+#include <CesiumGeometry/OrientedBoundingBox.h>
+#include <CesiumGeometry/Ray.h>
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/BoundingRegionWithLooseFittingHeights.h>
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/S2CellBoundingVolume.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 
 #include <glm/exponential.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <list>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <utility>
 #include <variant>
@@ -38,52 +44,175 @@ using namespace CesiumUtility;
 using namespace CesiumAsync;
 
 namespace {
-bool boundingVolumeContainsCoordinate(
-    const BoundingVolume& boundingVolume,
-    const Ray& ray,
-    const Cartographic& coordinate,
-    const Ellipsoid& ellipsoid) {
-  struct Operation {
-    const Ray& ray;
-    const Cartographic& coordinate;
+// A tile bounding volume in the form that's quickest to test against the rays
+// of many height queries. Volumes that are tested by the position of the query
+// on the globe are reduced to a rectangle once, instead of once per query.
+class HeightQueryVolume {
+public:
+  HeightQueryVolume(
+      const BoundingVolume& boundingVolume,
+      const Ellipsoid& ellipsoid)
+      : _volume(std::visit(Prepare{ellipsoid}, boundingVolume)) {}
+
+  bool contains(const TilesetHeightQuery& query) const {
+    return std::visit(Contains{query}, this->_volume);
+  }
+
+private:
+  using Volume =
+      std::variant<OrientedBoundingBox, BoundingSphere, GlobeRectangle>;
+
+  struct Prepare {
     const Ellipsoid& ellipsoid;
 
+    Volume operator()(const OrientedBoundingBox& boundingBox) {
+      return boundingBox;
+    }
+
+    Volume operator()(const BoundingRegion& boundingRegion) {
+      return boundingRegion.getRectangle();
+    }
+
+    Volume operator()(const BoundingSphere& boundingSphere) {
+      return boundingSphere;
+    }
+
+    Volume
+    operator()(const BoundingRegionWithLooseFittingHeights& boundingRegion) {
+      return boundingRegion.getBoundingRegion().getRectangle();
+    }
+
+    Volume operator()(const S2CellBoundingVolume& s2Cell) {
+      return s2Cell.computeBoundingRegion(ellipsoid).getRectangle();
+    }
+
+    Volume operator()(const BoundingCylinderRegion& cylinderRegion) {
+      return cylinderRegion.toOrientedBoundingBox();
+    }
+  };
+
+  struct Contains {
+    const TilesetHeightQuery& query;
+
     bool operator()(const OrientedBoundingBox& boundingBox) noexcept {
       std::optional<double> t =
-          IntersectionTests::rayOBBParametric(ray, boundingBox);
+          IntersectionTests::rayOBBParametric(query.ray, boundingBox);
       return t && t.value() >= 0;
     }
 
-    bool operator()(const BoundingRegion& boundingRegion) noexcept {
-      return boundingRegion.getRectangle().contains(coordinate);
-    }
-
     bool operator()(const BoundingSphere& boundingSphere) noexcept {
       std::optional<double> t =
-          IntersectionTests::raySphereParametric(ray, boundingSphere);
+          IntersectionTests::raySphereParametric(query.ray, boundingSphere);
       return t && t.value() >= 0;
     }
 
-    bool operator()(
-        const BoundingRegionWithLooseFittingHeights& boundingRegion) noexcept {
-      return boundingRegion.getBoundingRegion().getRectangle().contains(
-          coordinate);
+    bool operator()(const GlobeRectangle& rectangle) noexcept {
+      return rectangle.contains(query.inputPosition);
     }
+  };
+
+  Volume _volume;
+};
 
-    bool operator()(const S2CellBoundingVolume& s2Cell) noexcept {
-      return s2Cell.computeBoundingRegion(ellipsoid).getRectangle().contains(
-          coordinate);
+// Finds the candidate tiles of queries[begin, end), all of which have rays
+// that intersect the bounding volume of pTile. The queries of each child are
+// appended to `queries` while it is traversed, and removed afterward, so the
+// whole traversal shares one list.
+void findCandidateTilesRecursive(
+    Tile* pTile,
+    std::vector<TilesetHeightQuery*>& queries,
+    size_t begin,
+    size_t end,
+    const Ellipsoid& ellipsoid,
+    std::vector<std::string>& warnings) {
+  // If tile failed to load, this means we can't complete the intersection
+  if (pTile->getState() == TileLoadState::Failed) {
+    for (size_t i = begin; i < end; ++i) {
+      warnings.emplace_back("Tile load failed during query. Ignoring.");
     }
+    return;
+  }
 
-    bool operator()(const BoundingCylinderRegion& cylinderRegion) noexcept {
-      std::optional<double> t = IntersectionTests::rayOBBParametric(
-          ray,
-          cylinderRegion.toOrientedBoundingBox());
-      return t && t.value() >= 0;
+  const std::optional<BoundingVolume>& contentBoundingVolume =
+      pTile->getContentBoundingVolume();
+
+  // If optional content bounding volume exists, test against it
+  const auto findQueriesInContent = [&]() {
+    std::vector<TilesetHeightQuery*> result;
+    if (contentBoundingVolume) {
+      HeightQueryVolume volume(*contentBoundingVolume, ellipsoid);
+      for (size_t i = begin; i < end; ++i) {
+        if (volume.contains(*queries[i]))
+          result.emplace_back(queries[i]);
+      }
+    } else {
+      result.assign(
+          queries.begin() + ptrdiff_t(begin),
+          queries.begin() + ptrdiff_t(end));
     }
+    return result;
   };
 
-  return std::visit(Operation{ray, coordinate, ellipsoid}, boundingVolume);
+  if (pTile->getChildren().empty()) {
+    // This is a leaf node, it's a candidate
+    for (TilesetHeightQuery* pQuery : findQueriesInContent()) {
+      pQuery->candidateTiles.emplace_back(pTile);
+    }
+    return;
+  }
+
+  // We have children
+
+  // If additive refinement, add parent to the list with children
+  if (pTile->getRefine() == TileRefine::Add) {
+    for (TilesetHeightQuery* pQuery : findQueriesInContent()) {
+      pQuery->additiveCandidateTiles.emplace_back(pTile);
+    }
+  }
+
+  // Traverse children
+  for (Tile& child : pTile->getChildren()) {
+    // Only the queries whose rays intersect the child's bounding volume need
+    // to traverse it.
+    HeightQueryVolume volume(child.getBoundingVolume(), ellipsoid);
+    const size_t childBegin = queries.size();
+    for (size_t i = begin; i < end; ++i) {
+      TilesetHeightQuery* pQuery = queries[i];
+      if (volume.contains(*pQuery)) {
+        queries.emplace_back(pQuery);
+      }
+    }
+
+    const size_t childEnd = queries.size();
+    if (childBegin != childEnd) {
+      findCandidateTilesRecursive(
+          &child,
+          queries,
+          childBegin,
+          childEnd,
+          ellipsoid,
+          warnings);
+    }
+
+    queries.resize(childBegin);
+  }
+}
+
+// Calls `callback` once for each tile in `pairs`, which must be sorted, with
+// all of the queries paired with that tile. `queries` is scratch space.
+template <typename Callback>
+void forEachTileGroup(
+    const std::vector<std::pair<Tile*, TilesetHeightQuery*>>& pairs,
+    std::vector<TilesetHeightQuery*>& queries,
+    Callback&& callback) {
+  for (auto it = pairs.begin(); it != pairs.end();) {
+    Tile* pTile = it->first;
+    queries.clear();
+    for (; it != pairs.end() && it->first == pTile; ++it) {
+      queries.emplace_back(it->second);
+    }
+    callback(pTile, std::span<TilesetHeightQuery* const>(queries));
+  }
 }
 
 // The ray for height queries starts at this fraction of the ellipsoid max
@@ -120,100 +249,77 @@ TilesetHeightQuery::TilesetHeightQuery(
 
 Cesium3DTilesSelection::TilesetHeightQuery::~TilesetHeightQuery() = default;
 
-void TilesetHeightQuery::intersectVisibleTile(
-    Tile* pTile,
+void TilesetHeightQuery::addIntersection(
+    CesiumGltfContent::GltfUtilities::IntersectResult&& result,
     std::vector<std::string>& outWarnings) {
-  TileRenderContent* pRenderContent = pTile->getContent().getRenderContent();
-  if (!pRenderContent)
-    return;
-
-  auto gltfIntersectResult =
-      CesiumGltfContent::GltfUtilities::intersectRayGltfModel(
-          this->ray,
-          pRenderContent->getModel(),
-          true,
-          pTile->getTransform());
-
-  if (!gltfIntersectResult.warnings.empty()) {
+  if (!result.warnings.empty()) {
     outWarnings.insert(
         outWarnings.end(),
-        std::make_move_iterator(gltfIntersectResult.warnings.begin()),
-        std::make_move_iterator(gltfIntersectResult.warnings.end()));
+        std::make_move_iterator(result.warnings.begin()),
+        std::make_move_iterator(result.warnings.end()));
   }
 
   // Set ray info to this hit if closer, or the first hit
   if (!this->intersection.has_value()) {
-    this->intersection = std::move(gltfIntersectResult.hit);
-  } else if (gltfIntersectResult.hit) {
+    this->intersection = std::move(result.hit);
+  } else if (result.hit) {
     double prevDistSq = this->intersection->rayToWorldPointDistanceSq;
-    double thisDistSq = gltfIntersectResult.hit->rayToWorldPointDistanceSq;
+    double thisDistSq = result.hit->rayToWorldPointDistanceSq;
     if (thisDistSq < prevDistSq)
-      this->intersection = std::move(gltfIntersectResult.hit);
+      this->intersection = std::move(result.hit);
   }
 }
 
-void TilesetHeightQuery::findCandidateTiles(
+/*static*/ void TilesetHeightQuery::intersectVisibleTile(
     Tile* pTile,
-    std::vector<std::string>& warnings) {
-  // If tile failed to load, this means we can't complete the intersection
-  if (pTile->getState() == TileLoadState::Failed) {
-    warnings.emplace_back("Tile load failed during query. Ignoring.");
+    std::span<TilesetHeightQuery* const> queries,
+    TilesetContentManager& contentManager,
+    std::vector<std::string>& outWarnings) {
+  TileRenderContent* pRenderContent = pTile->getContent().getRenderContent();
+  if (!pRenderContent)
     return;
-  }
 
-  const std::optional<BoundingVolume>& contentBoundingVolume =
-      pTile->getContentBoundingVolume();
+  // Tiles are usually queried many times while they're loaded, so building a
+  // BVH once is much cheaper than testing every triangle for each query.
+  const CesiumGltfContent::GltfTriangleBvh& triangleBvh =
+      contentManager.getOrCreateTriangleBvh(*pRenderContent);
 
-  if (pTile->getChildren().empty()) {
-    // This is a leaf node, it's a candidate
+  std::vector<Ray> rays;
+  rays.reserve(queries.size());
+  for (const TilesetHeightQuery* pQuery : queries) {
+    rays.emplace_back(pQuery->ray);
+  }
 
-    // If optional content bounding volume exists, test against it
-    if (contentBoundingVolume) {
-      if (boundingVolumeContainsCoordinate(
-              *contentBoundingVolume,
-              this->ray,
-              this->inputPosition,
-              this->ellipsoid)) {
-        this->candidateTiles.emplace_back(pTile);
-      }
-    } else {
-      this->candidateTiles.emplace_back(pTile);
-    }
-  } else {
-    // We have children
-
-    // If additive refinement, add parent to the list with children
-    if (pTile->getRefine() == TileRefine::Add) {
-      // If optional content bounding volume exists, test against it
-      if (contentBoundingVolume) {
-        if (boundingVolumeContainsCoordinate(
-                *contentBoundingVolume,
-                this->ray,
-                this->inputPosition,
-                this->ellipsoid)) {
-          this->additiveCandidateTiles.emplace_back(pTile);
-        }
-      } else {
-        this->additiveCandidateTiles.emplace_back(pTile);
-      }
-    }
+  std::vector<CesiumGltfContent::GltfUtilities::IntersectResult> results =
+      CesiumGltfContent::GltfUtilities::intersectRaysGltfModel(
+          rays,
+          pRenderContent->getModel(),
+          true,
+          pTile->getTransform(),
+          &triangleBvh);
 
-    // Traverse children
-    for (Tile& child : pTile->getChildren()) {
-      // if bounding volume doesn't intersect this ray, we can skip it
-      if (!boundingVolumeContainsCoordinate(
-              child.getBoundingVolume(),
-              this->ray,
-              this->inputPosition,
-              this->ellipsoid))
-        continue;
-
-      // Child is a candidate, traverse it and its children
-      findCandidateTiles(&child, warnings);
-    }
+  for (size_t i = 0; i < queries.size(); ++i) {
+    queries[i]->addIntersection(std::move(results[i]), outWarnings);
   }
 }
 
+/*static*/ void TilesetHeightQuery::findCandidateTiles(
+    Tile* pTile,
+    std::span<TilesetHeightQuery* const> queries,
+    const Ellipsoid& ellipsoid,
+    std::vector<std::string>& outWarnings) {
+  std::vector<TilesetHeightQuery*> traversalQueries(
+      queries.begin(),
+      queries.end());
+  findCandidateTilesRecursive(
+      pTile,
+      traversalQueries,
+      0,
+      traversalQueries.size(),
+      ellipsoid,
+      outWarnings);
+}
+
 TilesetHeightRequest::TilesetHeightRequest(
     std::vector<TilesetHeightQuery>&& queries_,
     const CesiumAsync::Promise<SampleHeightResult>& promise_) noexcept
@@ -325,69 +431,110 @@ bool TilesetHeightRequest::tryCompleteHeightRequest(
   // No direct height query possible, so download and sample tiles.
   bool tileStillNeedsLoading = false;
   std::vector<std::string> warnings;
+
+  // Queries without any candidates yet find their initial set of tiles whose
+  // bounding volume is intersected by their ray. The others refine their
+  // current set of candidate tiles, in case further tiles from implicit
+  // tiling, external tilesets, etc. have been loaded since last frame. Either
+  // way, queries that start from the same tile traverse the tree together.
+  std::vector<std::pair<Tile*, TilesetHeightQuery*>> traversals;
   for (TilesetHeightQuery& query : this->queries) {
     if (query.candidateTiles.empty() && query.additiveCandidateTiles.empty()) {
-      // Find the initial set of tiles whose bounding volume is intersected by
-      // the query ray.
-      query.findCandidateTiles(contentManager.getRootTile(), warnings);
-    } else {
-      // Refine the current set of candidate tiles, in case further tiles from
-      // implicit tiling, external tilesets, etc. having been loaded since last
-      // frame.
-      std::swap(query.candidateTiles, query.previousCandidateTiles);
-
-      query.candidateTiles.clear();
-
-      for (const Tile::Pointer& pCandidate : query.previousCandidateTiles) {
-        TileLoadState loadState = pCandidate->getState();
-        if (!pCandidate->getChildren().empty() &&
-            loadState >= TileLoadState::ContentLoaded) {
-          query.findCandidateTiles(pCandidate.get(), warnings);
-        } else {
-          // Check again next frame to see if this tile has children.
-          query.candidateTiles.emplace_back(pCandidate);
-        }
+      traversals.emplace_back(contentManager.getRootTile(), &query);
+      continue;
+    }
+
+    std::swap(query.candidateTiles, query.previousCandidateTiles);
+
+    query.candidateTiles.clear();
+
+    for (const Tile::Pointer& pCandidate : query.previousCandidateTiles) {
+      TileLoadState loadState = pCandidate->getState();
+      if (!pCandidate->getChildren().empty() &&
+          loadState >= TileLoadState::ContentLoaded) {
+        traversals.emplace_back(pCandidate.get(), &query);
+      } else {
+        // Check again next frame to see if this tile has children.
+        query.candidateTiles.emplace_back(pCandidate);
       }
     }
+  }
 
-    auto checkTile =
-        [this, &contentManager, &options, &tileStillNeedsLoading](Tile* pTile) {
-          contentManager.createLatentChildrenIfNecessary(*pTile, options);
-
-          TileLoadState state = pTile->getState();
-          if (state == TileLoadState::Unloading) {
-            // This tile is in the process of unloading, which must complete
-            // before we can load it again.
-            contentManager.unloadTileContent(*pTile);
-            tileStillNeedsLoading = true;
-          } else if (state <= TileLoadState::ContentLoading) {
-            this->tilesToLoad.insert(pTile);
-            tileStillNeedsLoading = true;
+  std::sort(traversals.begin(), traversals.end());
+
+  std::vector<TilesetHeightQuery*> tileQueries;
+  forEachTileGroup(
+      traversals,
+      tileQueries,
+      [&options, &warnings](
+          Tile* pTile,
+          std::span<TilesetHeightQuery* const> queries) {
+        TilesetHeightQuery::findCandidateTiles(
+            pTile,
+            queries,
+            options.ellipsoid,
+            warnings);
+      });
+
+  auto checkTile =
+      [this, &contentManager, &options, &tileStillNeedsLoading](Tile* pTile) {
+        contentManager.createLatentChildrenIfNecessary(*pTile, options);
+
+        TileLoadState state = pTile->getState();
+        if (state == TileLoadState::Unloading) {
+          // This tile is in the process of unloading, which must complete
+          // before we can load it again.
+          contentManager.unloadTileContent(*pTile);
+          tileStillNeedsLoading = true;
+        } else if (state <= TileLoadState::ContentLoading) {
+          if (state == TileLoadState::ContentLoading) {
+            contentManager.markTileLoadRequested(*pTile);
           }
-        };
+          this->tilesToLoad.insert(pTile);
+          tileStillNeedsLoading = true;
+        }
+      };
 
-    // If any candidates need loading, add to return set
+  // Gather the candidates of all queries by tile, so that each tile is only
+  // checked once, and all of the rays that may hit it are intersected with it
+  // together.
+  std::vector<std::pair<Tile*, TilesetHeightQuery*>> candidates;
+  for (TilesetHeightQuery& query : this->queries) {
     for (const Tile::Pointer& pTile : query.additiveCandidateTiles) {
-      checkTile(pTile.get());
+      candidates.emplace_back(pTile.get(), &query);
     }
     for (const Tile::Pointer& pTile : query.candidateTiles) {
-      checkTile(pTile.get());
+      candidates.emplace_back(pTile.get(), &query);
     }
   }
 
+  std::sort(candidates.begin(), candidates.end());
+
+  // If any candidates need loading, add to return set
+  forEachTileGroup(
+      candidates,
+      tileQueries,
+      [&checkTile](Tile* pTile, std::span<TilesetHeightQuery* const>) {
+        checkTile(pTile);
+      });
+
   // Bail if we're waiting on tiles to load
   if (tileStillNeedsLoading)
     return false;
 
   // Do the intersect tests
-  for (TilesetHeightQuery& query : this->queries) {
-    for (const Tile::Pointer& pTile : query.additiveCandidateTiles) {
-      query.intersectVisibleTile(pTile.get(), warnings);
-    }
-    for (const Tile::Pointer& pTile : query.candidateTiles) {
-      query.intersectVisibleTile(pTile.get(), warnings);
-    }
-  }
+  forEachTileGroup(
+      candidates,
+      tileQueries,
+      [&contentManager, &warnings](
+          Tile* pTile,
+          std::span<TilesetHeightQuery* const> queries) {
+        TilesetHeightQuery::intersectVisibleTile(
+            pTile,
+            queries,
+            contentManager,
+            warnings);
+      });
 
   // All rays are done, create results
   SampleHeightResult results;
@@ -11,6 +11,7 @@
 
 #include <list>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -78,31 +79,59 @@ public:
   std::vector<Tile::Pointer> previousCandidateTiles;
 
   /**
-   * @brief Find the intersection of the ray with the given tile. If there is
-   * one, and if it's closer to the ray's origin than the previous best-known
-   * intersection, then {@link TilesetHeightQuery::intersection} will be
-   * updated.
+   * @brief Updates {@link TilesetHeightQuery::intersection} with the result of
+   * intersecting the ray with a tile, if the tile's hit is closer to the ray's
+   * origin than the previous best-known intersection.
    *
-   * @param pTile The tile to test for intersection with the ray.
+   * @param result The result of intersecting this query's ray with a tile.
+   * @param outWarnings On return, reports any warnings in the result.
+   */
+  void addIntersection(
+      CesiumGltfContent::GltfUtilities::IntersectResult&& result,
+      std::vector<std::string>& outWarnings);
+
+  /**
+   * @brief Find the intersections of the rays of many queries with the given
+   * tile, and update each query's {@link TilesetHeightQuery::intersection}.
+   *
+   * All of the rays are intersected with the tile's model together, so the
+   * model's scene graph is only traversed once.
+   *
+   * @param pTile The tile to test for intersection with the rays.
+   * @param queries The queries whose rays are to be intersected with the tile.
+   * @param contentManager The content manager that owns the tile, which
+   * builds and keeps track of the triangle BVH used for the intersection.
    * @param outWarnings On return, reports any warnings that occurred while
-   * attempting to intersect the ray with the tile.
+   * attempting to intersect the rays with the tile.
    */
-  void intersectVisibleTile(Tile* pTile, std::vector<std::string>& outWarnings);
+  static void intersectVisibleTile(
+      Tile* pTile,
+      std::span<TilesetHeightQuery* const> queries,
+      TilesetContentManager& contentManager,
+      std::vector<std::string>& outWarnings);
 
   /**
-   * @brief Find candidate tiles for the height query by traversing the tile
-   * tree, starting with the given tile.
+   * @brief Find candidate tiles for many height queries by traversing the tile
+   * tree once, starting with the given tile.
    *
-   * Any tile whose bounding volume intersects the ray will be added to the
+   * Each tile is visited once for all of the queries whose rays intersect its
+   * parent's bounding volume, rather than once per query. Any tile whose
+   * bounding volume intersects a query's ray will be added to that query's
    * {@link TilesetHeightQuery::candidateTiles} vector. Non-leaf tiles that are
    * additively-refined will be added to
    * {@link TilesetHeightQuery::additiveCandidateTiles}.
    *
    * @param pTile The tile at which to start traversal.
+   * @param queries The queries for which to find candidate tiles.
+   * @param ellipsoid The ellipsoid on which the queries are defined.
    * @param outWarnings On return, reports any warnings that occurred during
    * candidate search.
    */
-  void findCandidateTiles(Tile* pTile, std::vector<std::string>& outWarnings);
+  static void findCandidateTiles(
+      Tile* pTile,
+      std::span<TilesetHeightQuery* const> queries,
+      const CesiumGeospatial::Ellipsoid& ellipsoid,
+      std::vector<std::string>& outWarnings);
 };
 
 /**
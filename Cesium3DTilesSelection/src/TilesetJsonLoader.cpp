@@ -24,10 +24,13 @@
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <Cesium3DTilesSelection/TilesetMetadata.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
+#include <CesiumAsync/Future.h>
 #include <CesiumAsync/HttpHeaders.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/BoundingSphere.h>
 #include <CesiumGeometry/OrientedBoundingBox.h>
@@ -461,12 +464,23 @@ void parseImplicitTileset(
   }
 }
 
+/**
+ * @brief Creates a tile, and the tiles below it, from its JSON.
+ *
+ * Only {@link TilesetJsonLoader::LevelsCreatedAtOnce} levels are created. A
+ * tile on the last level that has children is given a loader of its own, added
+ * to `currentLoader`, that creates them later from a copy of their JSON.
+ *
+ * @param level The level of the tile below the first tile that was created
+ * from this document in this pass.
+ */
 std::optional<Tile> parseTileJsonRecursively(
     const std::shared_ptr<spdlog::logger>& pLogger,
     const rapidjson::Value& tileJson,
     const glm::dmat4& parentTransform,
     TileRefine parentRefine,
     double parentGeometricError,
+    uint32_t level,
     TilesetJsonLoader& currentLoader,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   if (!tileJson.IsObject()) {
@@ -635,30 +649,47 @@ std::optional<Tile> parseTileJsonRecursively(
     }
   }
 
-  // parse tile's children
+  // parse tile's children, or leave them for a loader of their own if this
+  // tile is on the last level created in this pass
   std::vector<Tile> childTiles;
+  TilesetJsonLoader* pTileLoader = &currentLoader;
   const auto childrenIt = tileJson.FindMember("children");
   if (childrenIt != tileJson.MemberEnd() && childrenIt->value.IsArray()) {
     const auto& childrenJson = childrenIt->value;
-    childTiles.reserve(childrenJson.Size());
-    for (rapidjson::SizeType i = 0; i < childrenJson.Size(); ++i) {
-      const auto& childJson = childrenJson[i];
-      auto maybeChild = parseTileJsonRecursively(
-          pLogger,
-          childJson,
-          tileTransform,
-          tileRefine,
-          tileGeometricError,
-          currentLoader,
-          ellipsoid);
+    if (level + 1 >= TilesetJsonLoader::LevelsCreatedAtOnce &&
+        !childrenJson.Empty()) {
+      // Copy the children into a document of their own, so that the rest of
+      // the JSON can be freed once parsing is done.
+      auto pChildrenJson = std::make_shared<rapidjson::Document>();
+      pChildrenJson->CopyFrom(childrenJson, pChildrenJson->GetAllocator());
+      std::unique_ptr<TilesetJsonLoader> pDeferredLoader =
+          currentLoader.createDeferredChildrenLoader(
+              pLogger,
+              std::move(pChildrenJson));
+      pTileLoader = pDeferredLoader.get();
+      currentLoader.addChildLoader(std::move(pDeferredLoader));
+    } else {
+      childTiles.reserve(childrenJson.Size());
+      for (rapidjson::SizeType i = 0; i < childrenJson.Size(); ++i) {
+        const auto& childJson = childrenJson[i];
+        auto maybeChild = parseTileJsonRecursively(
+            pLogger,
+            childJson,
+            tileTransform,
+            tileRefine,
+            tileGeometricError,
+            level + 1,
+            currentLoader,
+            ellipsoid);
 
-      if (maybeChild) {
-        childTiles.emplace_back(std::move(*maybeChild));
+        if (maybeChild) {
+          childTiles.emplace_back(std::move(*maybeChild));
+        }
       }
     }
   }
 
-  Tile tile{&currentLoader};
+  Tile tile{pTileLoader};
   tile.setTileID(contentUri ? contentUri : std::string{});
   tile.setTransform(tileTransform);
   tile.setBoundingVolume(tileBoundingVolume);
@@ -694,6 +725,7 @@ TilesetContentLoaderResult<TilesetJsonLoader> parseTilesetJson(
         parentTransform,
         parentRefine,
         10000000.0,
+        0,
         *pLoader,
         ellipsoid);
 
@@ -1039,6 +1071,7 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
   const auto& pLogger = loadInput.pLogger;
   const auto& requestHeaders = loadInput.requestHeaders;
   const auto& contentOptions = loadInput.contentOptions;
+  const auto& cancellationToken = loadInput.cancellationToken;
 
   // If the URL is empty, this tile is empty content and we don't need to make a
   // web request to complete the loading process (in fact, a web request would
@@ -1060,7 +1093,12 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
 
   std::string resolvedUrl =
       CesiumUtility::Uri::resolve(this->_baseUrl, *url, true);
-  return pAssetAccessor->get(asyncSystem, resolvedUrl, requestHeaders)
+  return pAssetAccessor
+      ->getCancelable(
+          asyncSystem,
+          resolvedUrl,
+          requestHeaders,
+          cancellationToken)
       .thenInWorkerThread(
           [pLogger,
            contentOptions,
@@ -1071,8 +1109,17 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
            externalContentInitializer = std::move(externalContentInitializer),
            pAssetAccessor,
            asyncSystem,
-           requestHeaders](std::shared_ptr<CesiumAsync::IAssetRequest>&&
-                               pCompletedRequest) mutable {
+           requestHeaders,
+           cancellationToken](std::shared_ptr<CesiumAsync::IAssetRequest>&&
+                                  pCompletedRequest) mutable {
+            if (cancellationToken.isCanceled()) {
+              // The tile is no longer needed, so don't spend time decoding it.
+              return asyncSystem.createResolvedFuture(
+                  TileLoadResult::createRetryLaterResult(
+                      pAssetAccessor,
+                      std::move(pCompletedRequest)));
+            }
+
             auto pResponse = pCompletedRequest->response();
             const std::string& tileUrl = pCompletedRequest->url();
             if (!pResponse) {
@@ -1118,9 +1165,27 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
               CesiumGltfReader::GltfReaderOptions gltfOptions;
               gltfOptions.ktx2TranscodeTargets =
                   contentOptions.ktx2TranscodeTargets;
+              gltfOptions.imageCompressionFormat =
+                  contentOptions.imageCompressionFormat;
+              gltfOptions.maximumImageDimension =
+                  contentOptions.maximumImageDimension;
+              gltfOptions.pByteBufferPool = contentOptions.pByteBufferPool;
               gltfOptions.applyTextureTransform =
                   contentOptions.applyTextureTransform;
-              return converter(responseData, gltfOptions, assetFetcher)
+              gltfOptions.parallelPostprocessing =
+                  contentOptions.parallelGltfPostprocessing;
+              // Let the converter adopt the response data when it can, rather
+              // than copying the parts of it that end up in the model.
+              auto owningConverter =
+                  GltfConverters::getOwningConverter(converter);
+              CesiumAsync::Future<GltfConverterResult> futureConverted =
+                  owningConverter
+                      ? owningConverter(
+                            pCompletedRequest->takeResponseData(),
+                            gltfOptions,
+                            assetFetcher)
+                      : converter(responseData, gltfOptions, assetFetcher);
+              return std::move(futureConverted)
                   .thenImmediately(
                       [ellipsoid,
                        pLogger,
@@ -1160,7 +1225,8 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
                       std::move(externalContentInitializer),
                       ellipsoid));
             }
-          });
+          },
+          loadInput.priority);
 }
 
 TileChildrenResult TilesetJsonLoader::createTileChildren(
@@ -1171,7 +1237,37 @@ TileChildrenResult TilesetJsonLoader::createTileChildren(
     return pLoader->createTileChildren(tile, ellipsoid);
   }
 
-  return {{}, TileLoadResultState::Failed};
+  // The tiles created from the deferred children use this loader too, but only
+  // the tile this loader was created for has children left to create, and
+  // only until it has created them.
+  const Tile* pParent = tile.getParent();
+  if (!this->_pDeferredChildrenJson ||
+      (pParent && pParent->getLoader() == this)) {
+    return {{}, TileLoadResultState::Failed};
+  }
+
+  const rapidjson::Value& childrenJson = *this->_pDeferredChildrenJson;
+  std::vector<Tile> children;
+  children.reserve(childrenJson.Size());
+  for (rapidjson::SizeType i = 0; i < childrenJson.Size(); ++i) {
+    std::optional<Tile> maybeChild = parseTileJsonRecursively(
+        this->_pLogger,
+        childrenJson[i],
+        tile.getTransform(),
+        tile.getRefine(),
+        tile.getGeometricError(),
+        0,
+        *this,
+        ellipsoid);
+    if (maybeChild) {
+      children.emplace_back(std::move(*maybeChild));
+    }
+  }
+
+  // The children are only created once, so their JSON isn't needed anymore.
+  this->_pDeferredChildrenJson.reset();
+
+  return {std::move(children), TileLoadResultState::Success};
 }
 
 const std::string& TilesetJsonLoader::getBaseUrl() const noexcept {
@@ -1191,6 +1287,19 @@ void TilesetJsonLoader::addChildLoader(
   this->_children.emplace_back(std::move(pLoader));
 }
 
+std::unique_ptr<TilesetJsonLoader>
+TilesetJsonLoader::createDeferredChildrenLoader(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    std::shared_ptr<const rapidjson::Document>&& pChildrenJson) const {
+  auto pLoader = std::make_unique<TilesetJsonLoader>(
+      this->_baseUrl,
+      this->_upAxis,
+      this->_ellipsoid);
+  pLoader->_pLogger = pLogger;
+  pLoader->_pDeferredChildrenJson = std::move(pChildrenJson);
+  return pLoader;
+}
+
 void TilesetJsonLoader::setOwnerOfNestedLoaders(
     TilesetContentManager& owner) noexcept {
   for (const std::unique_ptr<TilesetContentLoader>& pLoader : this->_children) {
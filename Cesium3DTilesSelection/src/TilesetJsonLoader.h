@@ -9,6 +9,7 @@
 
 #include <rapidjson/fwd.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,6 +17,16 @@
 namespace Cesium3DTilesSelection {
 class TilesetJsonLoader : public TilesetContentLoader {
 public:
+  /**
+   * @brief The number of levels of the tile tree that are created from the
+   * tileset.json at once.
+   *
+   * The children of tiles on the last of these levels are created from the
+   * JSON the first time they are needed, so that a huge tileset.json does not
+   * have to be turned into tiles all at once.
+   */
+  static constexpr uint32_t LevelsCreatedAtOnce = 4;
+
   TilesetJsonLoader(
       const std::string& baseUrl,
       CesiumGeometry::Axis upAxis,
@@ -35,6 +46,20 @@ public:
 
   void addChildLoader(std::unique_ptr<TilesetContentLoader> pLoader);
 
+  /**
+   * @brief Creates a loader for a tile whose children will be created later,
+   * by {@link createTileChildren}, from the given JSON array.
+   *
+   * @param pLogger The logger to report invalid child tiles to.
+   * @param pChildrenJson A document holding a copy of the tile's `children`
+   * array. The loader releases it once the children have been created.
+   * @return The loader, which must be added to this one with
+   * {@link addChildLoader}.
+   */
+  std::unique_ptr<TilesetJsonLoader> createDeferredChildrenLoader(
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      std::shared_ptr<const rapidjson::Document>&& pChildrenJson) const;
+
   static CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
   createLoader(
       const TilesetExternals& externals,
@@ -73,5 +98,10 @@ private:
   CesiumGeometry::Axis _upAxis;
 
   std::vector<std::unique_ptr<TilesetContentLoader>> _children;
+
+  // The JSON of the children that createTileChildren creates for the tile
+  // that uses this loader, until they have been created.
+  std::shared_ptr<spdlog::logger> _pLogger;
+  std::shared_ptr<const rapidjson::Document> _pDeferredChildrenJson;
 };
 } // namespace Cesium3DTilesSelection
@@ -240,11 +240,18 @@ const Tile* TilesetViewGroup::getNextTileToLoadInWorkerThread() {
   if (this->_workerThreadLoadQueue.empty())
     return nullptr;
 
-  Tile* pResult = this->_workerThreadLoadQueue.back().pTile;
+  const TileLoadTask& task = this->_workerThreadLoadQueue.back();
+  Tile* pResult = task.pTile;
+  this->_lastWorkerThreadLoadPriorityGroup = task.group;
   this->_workerThreadLoadQueue.pop_back();
   return pResult;
 }
 
+TileLoadPriorityGroup
+TilesetViewGroup::getLastWorkerThreadLoadPriorityGroup() const noexcept {
+  return this->_lastWorkerThreadLoadPriorityGroup;
+}
+
 bool TilesetViewGroup::hasMoreTilesToLoadInMainThread() const {
   return !this->_mainThreadLoadQueue.empty();
 }
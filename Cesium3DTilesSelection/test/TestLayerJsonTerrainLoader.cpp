@@ -16,23 +16,33 @@
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumGeospatial/WebMercatorProjection.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 #include <CesiumNativeTests/SimpleAssetRequest.h>
 #include <CesiumNativeTests/SimpleAssetResponse.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
 #include <CesiumNativeTests/readFile.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
+#include <CesiumRasterOverlays/RasterOverlayDetails.h>
+#include <CesiumRasterOverlays/RasterOverlayUtilities.h>
 #include <CesiumUtility/CreditSystem.h>
 #include <CesiumUtility/Math.h>
 
 #include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
 #include <spdlog/sinks/ringbuffer_sink.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -45,6 +55,7 @@ using namespace CesiumGeometry;
 using namespace CesiumAsync;
 using namespace CesiumUtility;
 using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
 
 namespace {
 std::filesystem::path testDataPath = Cesium3DTilesSelection_TEST_DATA_DIR;
@@ -1225,3 +1236,73 @@ TEST_CASE("Test creating tile children for layer json") {
     CHECK(upsampleID_2_3_1.tileID == QuadtreeTileID(2, 3, 1));
   }
 }
+
+TEST_CASE(
+    "Test creating raster overlay texture coordinates for a terrain tile "
+    "benchmark" *
+    doctest::skip()) {
+  const size_t iterations = 1000;
+
+  GeographicProjection projection(Ellipsoid::WGS84);
+  QuadtreeTilingScheme tilingScheme{
+      projection.project(GeographicProjection::MAXIMUM_GLOBE_RECTANGLE),
+      2,
+      1};
+
+  // A level 9 tile from a real terrain layer, over the Himalayas.
+  const QuadtreeTileID tileID(9, 759, 335);
+  const GlobeRectangle tileRectangle =
+      projection.unproject(tilingScheme.tileToRectangle(tileID));
+  const BoundingRegion tileBoundingVolume(
+      tileRectangle,
+      -1000.0,
+      9000.0,
+      Ellipsoid::WGS84);
+
+  const std::vector<std::byte> data = readFile(
+      testDataPath / "CesiumTerrainTileJson" / "9_759_335" /
+      "9_759_335.terrain");
+  CesiumQuantizedMeshTerrain::QuantizedMeshLoadResult loadResult =
+      CesiumQuantizedMeshTerrain::QuantizedMeshLoader::load(
+          tileID,
+          tileBoundingVolume,
+          "9_759_335.terrain",
+          data,
+          false);
+  REQUIRE(loadResult.model);
+
+  // One projection, two different ones, and four with only two distinct.
+  const std::vector<std::vector<Projection>> projectionSets{
+      {GeographicProjection(Ellipsoid::WGS84)},
+      {GeographicProjection(Ellipsoid::WGS84),
+       WebMercatorProjection(Ellipsoid::WGS84)},
+      {GeographicProjection(Ellipsoid::WGS84),
+       WebMercatorProjection(Ellipsoid::WGS84),
+       GeographicProjection(Ellipsoid::WGS84),
+       WebMercatorProjection(Ellipsoid::WGS84)}};
+
+  for (const std::vector<Projection>& projections : projectionSets) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      // Texture coordinates are added to the model, so each iteration needs
+      // a fresh copy. The time includes the copy.
+      CesiumGltf::Model model = *loadResult.model;
+      std::optional<RasterOverlayDetails> details =
+          RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+              model,
+              glm::dmat4(1.0),
+              tileRectangle,
+              std::vector<Projection>(projections),
+              false);
+      REQUIRE(details);
+    }
+    const auto time = std::chrono::steady_clock::now() - start;
+
+    MESSAGE(
+        projections.size()
+        << " projections: "
+        << std::chrono::duration_cast<std::chrono::microseconds>(time).count() /
+               int64_t(iterations)
+        << "us per tile");
+  }
+}
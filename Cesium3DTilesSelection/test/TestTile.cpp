@@ -0,0 +1,191 @@
+#include <Cesium3DTilesSelection/BoundingVolume.h>
+#include <Cesium3DTilesSelection/Tile.h>
+#include <Cesium3DTilesSelection/TileRefine.h>
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_double2.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/geometric.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace Cesium3DTilesSelection;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace {
+
+// Creates a complete quadtree of tiles with bounding spheres laid out on a
+// plane tangent to the ellipsoid, similar to a quadtree terrain tileset.
+void createQuadtree(
+    Tile& tile,
+    const glm::dvec3& center,
+    double radius,
+    double geometricError,
+    size_t depth,
+    const glm::dvec3& east,
+    const glm::dvec3& north) {
+  tile.setBoundingVolume(BoundingSphere(center, radius));
+  tile.setGeometricError(geometricError);
+  tile.setRefine(TileRefine::Replace);
+
+  if (depth == 0) {
+    return;
+  }
+
+  std::vector<Tile> children;
+  children.reserve(4);
+  for (size_t i = 0; i < 4; ++i) {
+    children.emplace_back(nullptr);
+  }
+
+  tile.createChildTiles(std::move(children));
+
+  const double offset = 0.5 * radius / glm::sqrt(2.0);
+  const glm::dvec3 offsets[] = {
+      -offset * east - offset * north,
+      offset * east - offset * north,
+      -offset * east + offset * north,
+      offset * east + offset * north};
+
+  for (size_t i = 0; i < 4; ++i) {
+    createQuadtree(
+        tile.getChildren()[i],
+        center + offsets[i],
+        0.5 * radius,
+        0.5 * geometricError,
+        depth - 1,
+        east,
+        north);
+  }
+}
+
+// Mimics the part of the selection traversal that is executed for every
+// visited tile: culling, screen-space error, and refinement decisions.
+size_t traverse(const Tile& tile, const ViewState& viewState) {
+  if (!viewState.isBoundingVolumeVisible(tile.getBoundingVolume())) {
+    return 0;
+  }
+
+  const double distance = glm::sqrt(glm::max(
+      viewState.computeDistanceSquaredToBoundingVolume(
+          tile.getBoundingVolume()),
+      0.0));
+  const double sse =
+      viewState.computeScreenSpaceError(tile.getGeometricError(), distance);
+
+  if (sse <= 16.0 || tile.getChildren().empty()) {
+    return 1;
+  }
+
+  size_t selected = tile.getRefine() == TileRefine::Add ? 1 : 0;
+  for (const Tile& child : tile.getChildren()) {
+    selected += traverse(child, viewState);
+  }
+
+  return selected;
+}
+
+} // namespace
+
+TEST_CASE("Tile rarely-used properties") {
+  Tile tile(nullptr);
+
+  SUBCASE("have default values") {
+    CHECK(tile.getTransform() == glm::dmat4x4(1.0));
+    CHECK(!tile.getViewerRequestVolume());
+    CHECK(!tile.getContentBoundingVolume());
+  }
+
+  SUBCASE("can be set and reset") {
+    const glm::dmat4x4 transform =
+        glm::translate(glm::dmat4x4(1.0), glm::dvec3(1.0, 2.0, 3.0));
+    const BoundingVolume volume = BoundingSphere(glm::dvec3(1.0), 2.0);
+
+    tile.setTransform(transform);
+    tile.setViewerRequestVolume(volume);
+    tile.setContentBoundingVolume(volume);
+
+    CHECK(tile.getTransform() == transform);
+    REQUIRE(tile.getViewerRequestVolume());
+    CHECK(
+        std::get<BoundingSphere>(*tile.getViewerRequestVolume()).getRadius() ==
+        2.0);
+    REQUIRE(tile.getContentBoundingVolume());
+    CHECK(
+        std::get<BoundingSphere>(*tile.getContentBoundingVolume())
+            .getRadius() == 2.0);
+
+    tile.setTransform(glm::dmat4x4(1.0));
+    tile.setViewerRequestVolume(std::nullopt);
+    tile.setContentBoundingVolume(std::nullopt);
+
+    CHECK(tile.getTransform() == glm::dmat4x4(1.0));
+    CHECK(!tile.getViewerRequestVolume());
+    CHECK(!tile.getContentBoundingVolume());
+  }
+
+  SUBCASE("are moved with the tile") {
+    const glm::dmat4x4 transform =
+        glm::translate(glm::dmat4x4(1.0), glm::dvec3(1.0, 2.0, 3.0));
+    tile.setTransform(transform);
+
+    Tile moved(std::move(tile));
+    CHECK(moved.getTransform() == transform);
+  }
+}
+
+TEST_CASE("Tile selection traversal benchmark" * doctest::skip()) {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  const glm::dvec3 center = ellipsoid.cartographicToCartesian(
+      Cartographic::fromDegrees(-75.0, 40.0, 0.0));
+  const glm::dvec3 up = ellipsoid.geodeticSurfaceNormal(center);
+  const glm::dvec3 east =
+      glm::normalize(glm::cross(glm::dvec3(0.0, 0.0, 1.0), up));
+  const glm::dvec3 north = glm::cross(up, east);
+
+  // A quadtree of depth 10 has 1,398,101 tiles.
+  Tile root(nullptr);
+  createQuadtree(root, center, 100000.0, 10000.0, 10, east, north);
+
+  const ViewState viewState(
+      center + up * 2000.0 + north * 20000.0,
+      glm::normalize(-up - north),
+      glm::normalize(north - up),
+      glm::dvec2(1920.0, 1080.0),
+      Math::degreesToRadians(60.0),
+      2.0 * std::atan(std::tan(Math::degreesToRadians(30.0)) * 1080.0 / 1920.0),
+      ellipsoid);
+
+  constexpr size_t iterations = 100;
+  size_t selected = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    selected += traverse(root, viewState);
+  }
+  const auto time = std::chrono::steady_clock::now() - start;
+
+  MESSAGE(
+      "sizeof(Tile): "
+      << sizeof(Tile) << " bytes, " << selected / iterations
+      << " tiles selected per traversal, "
+      << std::chrono::duration_cast<std::chrono::microseconds>(time).count() /
+             int64_t(iterations)
+      << "us per traversal");
+}
@@ -9,12 +9,17 @@
 #include <Cesium3DTilesSelection/RasterOverlayCollection.h>
 #include <Cesium3DTilesSelection/Tile.h>
 #include <Cesium3DTilesSelection/TileLoadResult.h>
+#include <Cesium3DTilesSelection/TileLoadTask.h>
 #include <Cesium3DTilesSelection/TileRefine.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <Cesium3DTilesSelection/TilesetExternals.h>
 #include <Cesium3DTilesSelection/TilesetOptions.h>
+#include <Cesium3DTilesSelection/TilesetViewGroup.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/ITaskProcessor.h>
+#include <CesiumAsync/Promise.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeometry/Rectangle.h>
@@ -63,10 +68,12 @@
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <span>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -101,6 +108,47 @@ public:
   TileChildrenResult mockCreateTileChildren;
 };
 
+// A loader whose loads complete only when the test resolves them.
+class DeferredTilesetContentLoader : public TilesetContentLoader {
+public:
+  CesiumAsync::Future<TileLoadResult>
+  loadTileContent(const TileLoadInput& input) override {
+    this->cancellationToken = input.cancellationToken;
+    this->priority = input.priority;
+    this->promise.emplace(input.asyncSystem.createPromise<TileLoadResult>());
+    return this->promise->getFuture();
+  }
+
+  TileChildrenResult createTileChildren(
+      [[maybe_unused]] const Tile& tile,
+      [[maybe_unused]] const Ellipsoid& ellipsoid) override {
+    return {{}, TileLoadResultState::Failed};
+  }
+
+  std::optional<CesiumAsync::Promise<TileLoadResult>> promise;
+  CesiumAsync::CancellationToken cancellationToken;
+  CesiumAsync::TaskPriority priority = CesiumAsync::TaskPriority::Normal;
+};
+
+// Runs tasks immediately, like SimpleTaskProcessor, and records the priority
+// of each one.
+class PriorityRecordingTaskProcessor : public CesiumAsync::ITaskProcessor {
+public:
+  virtual void startTask(std::function<void()> f) override {
+    this->priorities.emplace_back(CesiumAsync::TaskPriority::Normal);
+    f();
+  }
+
+  virtual void startPrioritizedTask(
+      std::function<void()> f,
+      CesiumAsync::TaskPriority priority) override {
+    this->priorities.emplace_back(priority);
+    f();
+  }
+
+  std::vector<CesiumAsync::TaskPriority> priorities;
+};
+
 std::shared_ptr<SimpleAssetRequest>
 createMockRequest(const std::filesystem::path& path) {
   auto pMockCompletedResponse = std::make_unique<SimpleAssetResponse>(
@@ -877,6 +925,228 @@ TEST_CASE("Test tile state machine") {
   }
 }
 
+TEST_CASE("Test tile load cancellation") {
+  auto pMockedAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>{});
+  CesiumAsync::AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+
+  TilesetExternals externals{
+      pMockedAssetAccessor,
+      std::make_shared<SimplePrepareRendererResource>(),
+      asyncSystem,
+      std::make_shared<CreditSystem>()};
+
+  auto pMockedLoader = std::make_unique<DeferredTilesetContentLoader>();
+  DeferredTilesetContentLoader* pLoader = pMockedLoader.get();
+  auto pRootTile = std::make_unique<Tile>(pMockedLoader.get());
+  pRootTile->setTileID("foo");
+
+  TilesetOptions options{};
+  IntrusivePointer<TilesetContentManager> pManager =
+      new TilesetContentManager{
+          externals,
+          options,
+          std::move(pMockedLoader),
+          std::move(pRootTile)};
+  pManager->waitUntilIdle();
+
+  Tile& tile = *pManager->getRootTile();
+  pManager->loadTileContent(tile, options);
+  REQUIRE(tile.getState() == TileLoadState::ContentLoading);
+  REQUIRE(pLoader->promise);
+  CHECK(pLoader->cancellationToken.canBeCanceled());
+
+  SUBCASE("Loads that are never requested while loading are not canceled") {
+    pManager->cancelStaleTileLoads();
+    pManager->cancelStaleTileLoads();
+    CHECK(!pLoader->cancellationToken.isCanceled());
+
+    pLoader->promise->reject(std::runtime_error("Failed"));
+    pManager->waitUntilIdle();
+    CHECK(tile.getState() == TileLoadState::Failed);
+  }
+
+  SUBCASE("Loads that stop being requested are canceled") {
+    pManager->markTileLoadRequested(tile);
+    pManager->cancelStaleTileLoads();
+    CHECK(!pLoader->cancellationToken.isCanceled());
+
+    pManager->markTileLoadRequested(tile);
+    pManager->cancelStaleTileLoads();
+    CHECK(!pLoader->cancellationToken.isCanceled());
+
+    pManager->cancelStaleTileLoads();
+    CHECK(pLoader->cancellationToken.isCanceled());
+
+    // A canceled load that is abandoned can be retried later.
+    pLoader->promise->reject(std::runtime_error("Canceled"));
+    pManager->waitUntilIdle();
+    CHECK(pManager->getNumberOfTilesLoading() == 0);
+    CHECK(tile.getState() == TileLoadState::FailedTemporarily);
+    CHECK(tile.getContent().isUnknownContent());
+
+    pManager->loadTileContent(tile, options);
+    CHECK(tile.getState() == TileLoadState::ContentLoading);
+    CHECK(!pLoader->cancellationToken.isCanceled());
+    pLoader->promise->resolve(
+        TileLoadResult::createRetryLaterResult(nullptr, nullptr));
+    pManager->waitUntilIdle();
+    CHECK(tile.getState() == TileLoadState::FailedTemporarily);
+  }
+}
+
+TEST_CASE("Test cancellation of tile loads started for a view group") {
+  auto pMockedAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>{});
+  CesiumAsync::AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+
+  TilesetExternals externals{
+      pMockedAssetAccessor,
+      std::make_shared<SimplePrepareRendererResource>(),
+      asyncSystem,
+      std::make_shared<CreditSystem>()};
+
+  auto pMockedLoader = std::make_unique<DeferredTilesetContentLoader>();
+  DeferredTilesetContentLoader* pLoader = pMockedLoader.get();
+  auto pRootTile = std::make_unique<Tile>(pMockedLoader.get());
+  pRootTile->setTileID("foo");
+
+  TilesetOptions options{};
+  IntrusivePointer<TilesetContentManager> pManager =
+      new TilesetContentManager{
+          externals,
+          options,
+          std::move(pMockedLoader),
+          std::move(pRootTile)};
+  pManager->waitUntilIdle();
+
+  Tile& tile = *pManager->getRootTile();
+  tile.addReference();
+
+  // Start the load the way a Tileset does: the view group requests the tile
+  // while it isn't loading yet, and the load starts in the same frame.
+  TilesetViewGroup viewGroup;
+  pManager->registerTileRequester(viewGroup);
+  viewGroup.addToLoadQueue(
+      TileLoadTask{&tile, TileLoadPriorityGroup::Normal, 0.0},
+      nullptr);
+  pManager->cancelStaleTileLoads();
+  pManager->processWorkerThreadLoadRequests(options);
+  REQUIRE(tile.getState() == TileLoadState::ContentLoading);
+  REQUIRE(pLoader->promise);
+
+  // The view group doesn't request the tile in the next frame.
+  pManager->cancelStaleTileLoads();
+  CHECK(!pLoader->cancellationToken.isCanceled());
+  pManager->cancelStaleTileLoads();
+  CHECK(pLoader->cancellationToken.isCanceled());
+
+  pLoader->promise->reject(std::runtime_error("Canceled"));
+  pManager->waitUntilIdle();
+  CHECK(pManager->getNumberOfTilesLoading() == 0);
+  CHECK(tile.getState() == TileLoadState::FailedTemporarily);
+
+  viewGroup.unregister();
+  tile.releaseReference();
+}
+
+TEST_CASE("Test priority of tile loads started for a view group") {
+  auto pMockedAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>{});
+  auto pTaskProcessor = std::make_shared<PriorityRecordingTaskProcessor>();
+  CesiumAsync::AsyncSystem asyncSystem{pTaskProcessor};
+
+  TilesetExternals externals{
+      pMockedAssetAccessor,
+      std::make_shared<SimplePrepareRendererResource>(),
+      asyncSystem,
+      std::make_shared<CreditSystem>()};
+
+  auto pMockedLoader = std::make_unique<DeferredTilesetContentLoader>();
+  DeferredTilesetContentLoader* pLoader = pMockedLoader.get();
+  auto pRootTile = std::make_unique<Tile>(pMockedLoader.get());
+  pRootTile->setTileID("foo");
+
+  TilesetOptions options{};
+  IntrusivePointer<TilesetContentManager> pManager =
+      new TilesetContentManager{
+          externals,
+          options,
+          std::move(pMockedLoader),
+          std::move(pRootTile)};
+  pManager->waitUntilIdle();
+
+  Tile& tile = *pManager->getRootTile();
+  tile.addReference();
+
+  TileLoadPriorityGroup group = TileLoadPriorityGroup::Normal;
+  CesiumAsync::TaskPriority expected = CesiumAsync::TaskPriority::High;
+  SUBCASE("Tiles needed by the view are decoded at high priority") {
+    group = TileLoadPriorityGroup::Normal;
+    expected = CesiumAsync::TaskPriority::High;
+  }
+  SUBCASE("Urgent tiles are decoded at high priority") {
+    group = TileLoadPriorityGroup::Urgent;
+    expected = CesiumAsync::TaskPriority::High;
+  }
+  SUBCASE("Preloaded tiles are decoded at low priority") {
+    group = TileLoadPriorityGroup::Preload;
+    expected = CesiumAsync::TaskPriority::Low;
+  }
+
+  TilesetViewGroup viewGroup;
+  pManager->registerTileRequester(viewGroup);
+  viewGroup.addToLoadQueue(TileLoadTask{&tile, group, 0.0}, nullptr);
+  pManager->processWorkerThreadLoadRequests(options);
+  REQUIRE(tile.getState() == TileLoadState::ContentLoading);
+  REQUIRE(pLoader->promise);
+  CHECK(viewGroup.getLastWorkerThreadLoadPriorityGroup() == group);
+  CHECK(pLoader->priority == expected);
+
+  // A main thread task with normal priority that is queued before the load
+  // completes.
+  bool normalTaskRan = false;
+  CesiumAsync::Future<void> normalTask = asyncSystem.runInMainThread(
+      [&normalTaskRan]() { normalTaskRan = true; },
+      CesiumAsync::TaskPriority::Normal);
+
+  // The renderer resources of the loaded model are prepared in a worker
+  // thread task with the same priority.
+  pTaskProcessor->priorities.clear();
+  pLoader->promise->resolve(TileLoadResult{
+      CesiumGltf::Model(),
+      CesiumGeometry::Axis::Y,
+      std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      nullptr,
+      nullptr,
+      {},
+      TileLoadResultState::Success,
+      Ellipsoid::WGS84});
+  REQUIRE(!pTaskProcessor->priorities.empty());
+  CHECK(pTaskProcessor->priorities.front() == expected);
+
+  // The load is finished in the main thread with the same priority, so it
+  // runs before the normal priority task only if the tile is needed now.
+  CHECK(asyncSystem.dispatchOneMainThreadTask());
+  if (expected == CesiumAsync::TaskPriority::High) {
+    CHECK(!normalTaskRan);
+    CHECK(tile.getState() == TileLoadState::ContentLoaded);
+  } else {
+    CHECK(normalTaskRan);
+    CHECK(tile.getState() == TileLoadState::ContentLoading);
+  }
+
+  pManager->waitUntilIdle();
+  asyncSystem.dispatchMainThreadTasks();
+  CHECK(normalTaskRan);
+  CHECK(tile.getState() == TileLoadState::ContentLoaded);
+
+  viewGroup.unregister();
+  tile.releaseReference();
+}
+
 TEST_CASE("Test the tileset content manager's post processing for gltf") {
   Cesium3DTilesContent::registerAllTileContentTypes();
 
@@ -15,9 +15,12 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace Cesium3DTilesContent;
 using namespace Cesium3DTilesSelection;
@@ -87,6 +90,60 @@ TEST_CASE("Tileset height queries") {
         Math::Epsilon4));
   }
 
+  SUBCASE("Many positions in one request") {
+    std::string url =
+        "file://" +
+        Uri::nativePathToUriPath(StringHelpers::toStringUtf8(
+            (testDataPath / "Tileset" / "tileset.json").u8string()));
+
+    Tileset tileset(externals, url);
+
+    // A grid of positions spanning the parent tile and several leaf tiles.
+    std::vector<Cartographic> positions;
+    for (double longitude = -75.6130; longitude <= -75.6110;
+         longitude += 0.0002) {
+      for (double latitude = 40.0410; latitude <= 40.0430;
+           latitude += 0.0002) {
+        positions.emplace_back(
+            Cartographic::fromDegrees(longitude, latitude, 0.0));
+      }
+    }
+
+    Future<SampleHeightResult> future =
+        tileset.sampleHeightMostDetailed(positions);
+    while (!future.isReady()) {
+      tileset.loadTiles();
+    }
+
+    SampleHeightResult results = future.waitInMainThread();
+    CHECK(results.warnings.empty());
+    REQUIRE(results.positions.size() == positions.size());
+    REQUIRE(results.sampleSuccess.size() == positions.size());
+
+    // Each position must have the same height as when it is sampled alone.
+    for (size_t i = 0; i < positions.size(); ++i) {
+      Future<SampleHeightResult> singleFuture =
+          tileset.sampleHeightMostDetailed({positions[i]});
+      while (!singleFuture.isReady()) {
+        tileset.loadTiles();
+      }
+
+      SampleHeightResult single = singleFuture.waitInMainThread();
+      REQUIRE(single.positions.size() == 1);
+      CHECK(results.positions[i].longitude == positions[i].longitude);
+      CHECK(results.positions[i].latitude == positions[i].latitude);
+      CHECK(results.sampleSuccess[i] == single.sampleSuccess[0]);
+      if (single.sampleSuccess[0]) {
+        CHECK(results.positions[i].height == single.positions[0].height);
+      }
+    }
+
+    CHECK(std::count(
+              results.sampleSuccess.begin(),
+              results.sampleSuccess.end(),
+              true) > 0);
+  }
+
   SUBCASE("Replace-refined tileset") {
     std::string url =
         "file://" +
@@ -505,6 +505,76 @@ TEST_CASE("Test creating tileset json loader") {
     REQUIRE(schema);
     CHECK(schema->id == "voxel");
   }
+
+  SUBCASE("Tiles below the first levels are created when they are needed") {
+    // Each tile of the chain in this tileset has the next tile of the chain
+    // and a leaf as its children, ten levels deep. The root's scale applies
+    // to all geometric errors.
+    const uint32_t levels = 10;
+    auto loaderResult = createTilesetJsonLoader(
+        testDataPath / "MultipleKindsOfTilesets" / "DeepTileset.json");
+
+    CHECK(!loaderResult.errors.hasErrors());
+    REQUIRE(loaderResult.pRootTile);
+    REQUIRE(loaderResult.pRootTile->getChildren().size() == 1);
+
+    Tile* pTile = &loaderResult.pRootTile->getChildren()[0];
+    for (uint32_t level = 0; level < levels; ++level) {
+      CHECK(
+          std::get<std::string>(pTile->getTileID()) ==
+          std::to_string(level) + ".b3dm");
+      CHECK(pTile->getGeometricError() == double(2 << (levels - level)));
+      CHECK(pTile->getRefine() == TileRefine::Add);
+      CHECK(pTile->getTransform()[0][0] == 2.0);
+
+      const bool isLastLevelOfPass =
+          level % TilesetJsonLoader::LevelsCreatedAtOnce ==
+          TilesetJsonLoader::LevelsCreatedAtOnce - 1;
+      if (level > 0) {
+        CHECK(
+            (pTile->getLoader() != pTile->getParent()->getLoader()) ==
+            isLastLevelOfPass);
+      }
+
+      if (level + 1 == levels) {
+        break;
+      }
+
+      // The last level created in a pass has no children yet. Its loader
+      // creates them, once.
+      if (isLastLevelOfPass) {
+        REQUIRE(pTile->getChildren().empty());
+        TileChildrenResult childrenResult =
+            loaderResult.pLoader->createTileChildren(*pTile);
+        REQUIRE(childrenResult.state == TileLoadResultState::Success);
+        pTile->createChildTiles(std::move(childrenResult.children));
+        CHECK(
+            loaderResult.pLoader->createTileChildren(*pTile).state ==
+            TileLoadResultState::Failed);
+      }
+
+      REQUIRE(pTile->getChildren().size() == 2);
+      const Tile& leaf = pTile->getChildren()[1];
+      CHECK(
+          std::get<std::string>(leaf.getTileID()) ==
+          std::to_string(level + 1) + "-leaf.b3dm");
+      CHECK(leaf.getGeometricError() == 0.0);
+      CHECK(leaf.getRefine() == TileRefine::Add);
+      CHECK(leaf.getChildren().empty());
+      CHECK(leaf.getLoader() == pTile->getLoader());
+      CHECK(
+          loaderResult.pLoader->createTileChildren(leaf).state ==
+          TileLoadResultState::Failed);
+
+      pTile = &pTile->getChildren()[0];
+    }
+
+    // The last tile of the chain has no children to create.
+    CHECK(pTile->getChildren().empty());
+    CHECK(
+        loaderResult.pLoader->createTileChildren(*pTile).state ==
+        TileLoadResultState::Failed);
+  }
 }
 
 TEST_CASE("Test loading individual tile of tileset json") {
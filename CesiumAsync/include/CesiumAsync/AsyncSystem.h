@@ -6,11 +6,13 @@
 #include "Impl/cesium-async++.h"
 
 #include <CesiumAsync/Future.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumAsync/Library.h>
 #include <CesiumAsync/Promise.h>
 #include <CesiumAsync/ThreadPool.h>
 #include <CesiumUtility/Tracing.h>
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -19,6 +21,33 @@ class ITaskProcessor;
 
 class AsyncSystem;
 
+/**
+ * @brief Statistics about a call to
+ * {@link AsyncSystem::dispatchMainThreadTasks} with a time budget.
+ */
+struct CESIUMASYNC_API MainThreadDispatchStatistics {
+  /**
+   * @brief The number of tasks that were run.
+   */
+  size_t tasksDispatched = 0;
+
+  /**
+   * @brief The number of tasks that were still waiting when the dispatch
+   * stopped. These include tasks queued by the tasks that were run.
+   */
+  size_t tasksRemaining = 0;
+
+  /**
+   * @brief The total time, in milliseconds, spent running tasks.
+   */
+  double elapsedMilliseconds = 0.0;
+
+  /**
+   * @brief The time, in milliseconds, taken by the slowest task that was run.
+   */
+  double longestTaskMilliseconds = 0.0;
+};
+
 /**
  * @brief A system for managing asynchronous requests and tasks.
  *
@@ -127,6 +156,43 @@ public:
                 std::forward<Func>(f))));
   }
 
+  /**
+   * @brief Runs a function in a worker thread with the given priority,
+   * returning a Future that resolves when the function completes.
+   *
+   * The priority is passed to {@link ITaskProcessor::startPrioritizedTask}.
+   * A task processor that supports priorities, such as
+   * {@link WorkStealingTaskProcessor}, starts waiting high-priority functions
+   * before waiting low-priority ones.
+   *
+   * If the function itself returns a `Future`, the function will not be
+   * considered complete until that returned `Future` also resolves.
+   *
+   * If this method is called from a designated worker thread, the
+   * callback will be invoked immediately and complete before this function
+   * returns, regardless of its priority.
+   *
+   * @tparam Func The type of the function.
+   * @param f The function.
+   * @param priority The priority of the function.
+   * @return A future that resolves after the supplied function completes.
+   */
+  template <typename Func>
+  CesiumImpl::ContinuationFutureType_t<Func, void>
+  runInWorkerThread(Func&& f, TaskPriority priority) const {
+    static const char* tracingName = "waiting for worker thread";
+
+    CESIUM_TRACE_BEGIN_IN_TRACK(tracingName);
+
+    return CesiumImpl::ContinuationFutureType_t<Func, void>(
+        this->_pSchedulers,
+        async::spawn(
+            this->_pSchedulers->workerThread.prioritized(priority),
+            CesiumImpl::WithTracing<void>::end(
+                tracingName,
+                std::forward<Func>(f))));
+  }
+
   /**
    * @brief Runs a function in the main thread, returning a Future that
    * resolves when the function completes.
@@ -157,6 +223,43 @@ public:
                 std::forward<Func>(f))));
   }
 
+  /**
+   * @brief Runs a function in the main thread with the given priority,
+   * returning a Future that resolves when the function completes.
+   *
+   * Each dispatch of main-thread tasks runs waiting high-priority functions
+   * before waiting low-priority ones. Continuations registered with
+   * {@link Future::thenInMainThread} without a priority have
+   * {@link TaskPriority::Normal} priority.
+   *
+   * If the function itself returns a `Future`, the function will not be
+   * considered complete until that returned `Future` also resolves.
+   *
+   * If this method is called from the main thread, the callback will be invoked
+   * immediately and complete before this function returns, regardless of its
+   * priority.
+   *
+   * @tparam Func The type of the function.
+   * @param f The function.
+   * @param priority The priority of the function.
+   * @return A future that resolves after the supplied function completes.
+   */
+  template <typename Func>
+  CesiumImpl::ContinuationFutureType_t<Func, void>
+  runInMainThread(Func&& f, TaskPriority priority) const {
+    static const char* tracingName = "waiting for main thread";
+
+    CESIUM_TRACE_BEGIN_IN_TRACK(tracingName);
+
+    return CesiumImpl::ContinuationFutureType_t<Func, void>(
+        this->_pSchedulers,
+        async::spawn(
+            this->_pSchedulers->mainThread.prioritized(priority),
+            CesiumImpl::WithTracing<void>::end(
+                tracingName,
+                std::forward<Func>(f))));
+  }
+
   /**
    * @brief Runs a function in a thread pool, returning a Future that resolves
    * when the function completes.
@@ -279,6 +382,23 @@ public:
    */
   void dispatchMainThreadTasks();
 
+  /**
+   * @brief Runs tasks that are queued for the main thread, highest priority
+   * first, until there are none left or the time budget is used up.
+   *
+   * The budget is a soft limit: it is checked after each task, and at least
+   * one task is run if any are waiting, so a single slow task may exceed it.
+   * Tasks queued by the tasks that are run may also be run by this call.
+   *
+   * The tasks are run in the calling thread.
+   *
+   * @param timeBudgetMilliseconds The time, in milliseconds, after which no
+   * more tasks are started. If zero or less, all waiting tasks are run.
+   * @return Statistics about the tasks that were run.
+   */
+  MainThreadDispatchStatistics
+  dispatchMainThreadTasks(double timeBudgetMilliseconds);
+
   /**
    * @brief Runs a single waiting task that is currently queued for the main
    * thread. If there are no tasks waiting, it returns immediately without
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <ctime>
 #include <map>
+#include <memory>
 #include <span>
 #include <vector>
 
@@ -29,7 +30,44 @@ public:
       std::vector<std::byte>&& cacheData)
       : statusCode(cacheStatusCode),
         headers(std::move(cacheHeaders)),
-        data(std::move(cacheData)) {}
+        data(std::move(cacheData)),
+        _dataView(),
+        _pDataOwner() {}
+
+  /**
+   * @brief Constructor for a response whose body is not copied, but instead
+   * remains in memory owned by another object, such as a memory-mapped file.
+   *
+   * The {@link data} vector of such a response is empty. Use {@link getData}
+   * to access the body.
+   *
+   * @param cacheStatusCode the status code of the response
+   * @param cacheHeaders the headers of the response
+   * @param cacheDataView the body of the response
+   * @param pCacheDataOwner the object that owns the memory of `cacheDataView`.
+   * It is kept alive as long as this response.
+   */
+  CacheResponse(
+      uint16_t cacheStatusCode,
+      HttpHeaders&& cacheHeaders,
+      std::span<const std::byte> cacheDataView,
+      std::shared_ptr<const void>&& pCacheDataOwner)
+      : statusCode(cacheStatusCode),
+        headers(std::move(cacheHeaders)),
+        data(),
+        _dataView(cacheDataView),
+        _pDataOwner(std::move(pCacheDataOwner)) {}
+
+  /**
+   * @brief Gets the body data of the response, regardless of whether it is
+   * stored in {@link data} or owned by another object.
+   */
+  std::span<const std::byte> getData() const noexcept {
+    if (this->_pDataOwner) {
+      return this->_dataView;
+    }
+    return std::span<const std::byte>(this->data.data(), this->data.size());
+  }
 
   /**
    * @brief The status code of the response.
@@ -43,8 +81,15 @@ public:
 
   /**
    * @brief The body data of the response.
+   *
+   * This is empty if the body is owned by another object. Prefer
+   * {@link getData}, which works in both cases.
    */
   std::vector<std::byte> data;
+
+private:
+  std::span<const std::byte> _dataView;
+  std::shared_ptr<const void> _pDataOwner;
 };
 
 /**
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/ICacheDatabase.h>
@@ -50,6 +51,23 @@ public:
       const std::string& url,
       const std::vector<THeader>& headers) override;
 
+  /**
+   * @copydoc IAssetAccessor::getCancelable
+   *
+   * A request that is canceled while it waits for a cache thread is abandoned
+   * before the cache is read, and the token is passed to the underlying
+   * {@link IAssetAccessor} for requests that are not answered by the cache.
+   *
+   * Responses from the underlying accessor are written to the cache in a
+   * worker thread task with {@link TaskPriority::Low} priority, after the
+   * returned future has resolved.
+   */
+  virtual Future<std::shared_ptr<IAssetRequest>> getCancelable(
+      const AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers,
+      const CancellationToken& cancellationToken) override;
+
   virtual Future<std::shared_ptr<IAssetRequest>> request(
       const AsyncSystem& asyncSystem,
       const std::string& verb,
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <CesiumAsync/Library.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CesiumAsync {
+
+//! @cond Doxygen_Suppress
+namespace CesiumImpl {
+// The state shared by a source and its tokens. Callbacks are run with the
+// mutex held, so that a registration that is destroyed waits for its callback
+// to finish rather than racing with it.
+struct CancellationState {
+  std::atomic<bool> canceled{false};
+  std::mutex mutex;
+  uint64_t nextCallbackId = 0;
+  std::vector<std::pair<uint64_t, std::function<void()>>> callbacks;
+};
+} // namespace CesiumImpl
+//! @endcond
+
+/**
+ * @brief A callback registered with {@link CancellationToken::onCancel}. The
+ * callback is unregistered when this object is destroyed or reset.
+ *
+ * Unregistering waits for the callback if it is running on another thread, so
+ * once this object is destroyed the callback will not be running and will
+ * never be called again. A callback must not destroy its own registration.
+ */
+class CESIUMASYNC_API CancellationRegistration {
+public:
+  /**
+   * @brief Constructs a registration that has no callback.
+   */
+  CancellationRegistration() noexcept = default;
+
+  /** @brief Moves a registration. */
+  CancellationRegistration(CancellationRegistration&& rhs) noexcept;
+
+  /** @brief Moves a registration, unregistering this one's callback. */
+  CancellationRegistration& operator=(CancellationRegistration&& rhs) noexcept;
+
+  CancellationRegistration(const CancellationRegistration&) = delete;
+  CancellationRegistration&
+  operator=(const CancellationRegistration&) = delete;
+
+  /**
+   * @brief Unregisters the callback.
+   */
+  ~CancellationRegistration() noexcept;
+
+  /**
+   * @brief Unregisters the callback, waiting for it if it is running.
+   */
+  void reset() noexcept;
+
+private:
+  CancellationRegistration(
+      std::shared_ptr<CesiumImpl::CancellationState> pState,
+      uint64_t id) noexcept
+      : _pState(std::move(pState)), _id(id) {}
+
+  std::shared_ptr<CesiumImpl::CancellationState> _pState;
+  uint64_t _id = 0;
+
+  friend class CancellationToken;
+};
+
+/**
+ * @brief Observes whether an asynchronous operation has been canceled by the
+ * {@link CancellationSource} that created this token.
+ *
+ * Cancellation is cooperative: an operation that is given a token checks it
+ * at convenient points, such as before starting a network request or before
+ * decoding a response, and stops early if it has been canceled. An operation
+ * that sleeps can instead register a callback with {@link onCancel} to be
+ * woken when it is canceled. A default-constructed token is never canceled.
+ *
+ * Tokens are cheap to copy, and may be checked from any thread.
+ */
+class CESIUMASYNC_API CancellationToken {
+public:
+  /**
+   * @brief Constructs a token that is never canceled.
+   */
+  CancellationToken() noexcept = default;
+
+  /**
+   * @brief Determines if the operation observing this token has been
+   * canceled.
+   */
+  bool isCanceled() const noexcept {
+    return this->_pState &&
+           this->_pState->canceled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Determines if this token can ever be canceled. Only tokens created
+   * by a {@link CancellationSource} can be.
+   */
+  bool canBeCanceled() const noexcept { return this->_pState != nullptr; }
+
+  /**
+   * @brief Registers a callback to be called when this token is canceled.
+   *
+   * The callback is called on the thread that calls
+   * {@link CancellationSource::cancel}, or immediately on this thread if the
+   * token has already been canceled. It should be quick, must not throw, and
+   * must not cancel the source or register or unregister callbacks on the
+   * same token.
+   *
+   * @param callback The function to call.
+   * @return The registration, which unregisters the callback when it is
+   * destroyed. If this token can never be canceled, the callback is never
+   * called and the registration is empty.
+   */
+  CancellationRegistration onCancel(std::function<void()> callback) const;
+
+private:
+  explicit CancellationToken(
+      std::shared_ptr<CesiumImpl::CancellationState> pState) noexcept
+      : _pState(std::move(pState)) {}
+
+  std::shared_ptr<CesiumImpl::CancellationState> _pState;
+
+  friend class CancellationSource;
+};
+
+/**
+ * @brief Creates {@link CancellationToken} instances and cancels them.
+ *
+ * Copies of a source share the same state, so canceling any copy cancels the
+ * tokens of all of them. Once canceled, a source cannot be reset.
+ */
+class CESIUMASYNC_API CancellationSource {
+public:
+  /**
+   * @brief Constructs a new source that has not been canceled.
+   */
+  CancellationSource()
+      : _pState(std::make_shared<CesiumImpl::CancellationState>()) {}
+
+  /**
+   * @brief Gets a token that observes this source.
+   */
+  CancellationToken getToken() const noexcept {
+    return CancellationToken(this->_pState);
+  }
+
+  /**
+   * @brief Cancels the tokens of this source, calling the callbacks that have
+   * been registered with them. Canceling a source more than once has no
+   * further effect.
+   */
+  void cancel() noexcept;
+
+  /**
+   * @brief Determines if this source has been canceled.
+   */
+  bool isCanceled() const noexcept {
+    return this->_pState->canceled.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::shared_ptr<CesiumImpl::CancellationState> _pState;
+};
+
+} // namespace CesiumAsync
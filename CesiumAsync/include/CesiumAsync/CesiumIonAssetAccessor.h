@@ -1,6 +1,7 @@
 #pragma once
 
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
@@ -57,6 +58,15 @@ public:
       const std::string& url,
       const std::vector<THeader>& headers = {}) override;
 
+  /**
+   * \inheritdoc
+   */
+  Future<std::shared_ptr<IAssetRequest>> getCancelable(
+      const AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers,
+      const CancellationToken& cancellationToken) override;
+
   /**
    * \inheritdoc
    */
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <CesiumAsync/CancellationToken.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/Library.h>
+#include <CesiumAsync/ThreadPool.h>
+#include <CesiumUtility/ByteBufferPool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CesiumAsync {
+class AsyncSystem;
+
+/**
+ * @brief Options for constructing a {@link FileAssetAccessor}.
+ */
+struct CESIUMASYNC_API FileAssetAccessorOptions {
+  /**
+   * @brief The number of threads that read files. This bounds the number of
+   * files that are read at once.
+   */
+  int32_t numberOfThreads = 4;
+
+  /**
+   * @brief The smallest file, in bytes, that is mapped into memory instead of
+   * being read into a buffer.
+   *
+   * The response data of a mapped file refers directly to the mapping, so it
+   * is never copied, but mapping a file costs more than reading a small one.
+   */
+  uint64_t minimumMappedSize = 1024 * 1024;
+
+  /**
+   * @brief The pool to allocate the buffers of files that are read, rather
+   * than mapped, from. If nullptr, the buffers are allocated normally.
+   */
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pBufferPool = nullptr;
+};
+
+/**
+ * @brief An {@link IAssetAccessor} that reads `file:` URLs directly from the
+ * local file system, and passes all other requests to another accessor.
+ *
+ * Files are read by a dedicated thread pool. Large files are mapped into
+ * memory, so the data of their responses is not copied. A file that does not
+ * exist produces a response with status code 404, and any other file that
+ * is read successfully produces a response with status code 200.
+ */
+class CESIUMASYNC_API FileAssetAccessor : public IAssetAccessor {
+public:
+  /**
+   * @brief Constructs a new instance.
+   *
+   * @param pAssetAccessor The {@link IAssetAccessor} to use for URLs that are
+   * not `file:` URLs. If nullptr, requests for those URLs fail.
+   * @param options The options with which to construct this instance.
+   */
+  FileAssetAccessor(
+      const std::shared_ptr<IAssetAccessor>& pAssetAccessor = nullptr,
+      const FileAssetAccessorOptions& options = {});
+
+  virtual ~FileAssetAccessor() noexcept override;
+
+  /** @copydoc IAssetAccessor::get */
+  virtual Future<std::shared_ptr<IAssetRequest>>
+  get(const AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers) override;
+
+  /**
+   * @copydoc IAssetAccessor::getCancelable
+   *
+   * A file that is canceled while it waits for a reading thread is not read.
+   */
+  virtual Future<std::shared_ptr<IAssetRequest>> getCancelable(
+      const AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers,
+      const CancellationToken& cancellationToken) override;
+
+  /**
+   * @copydoc IAssetAccessor::request
+   *
+   * Only `GET` requests are supported for `file:` URLs.
+   */
+  virtual Future<std::shared_ptr<IAssetRequest>> request(
+      const AsyncSystem& asyncSystem,
+      const std::string& verb,
+      const std::string& url,
+      const std::vector<THeader>& headers,
+      const std::span<const std::byte>& contentPayload) override;
+
+  /** @copydoc IAssetAccessor::tick */
+  virtual void tick() noexcept override;
+
+private:
+  std::shared_ptr<IAssetAccessor> _pAssetAccessor;
+  FileAssetAccessorOptions _options;
+  ThreadPool _threadPool;
+};
+} // namespace CesiumAsync
@@ -5,6 +5,7 @@
 #include "Impl/ContinuationFutureType.h"
 #include "Impl/WithTracing.h"
 
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumAsync/SharedFuture.h>
 #include <CesiumAsync/ThreadPool.h>
 #include <CesiumUtility/Tracing.h>
@@ -74,6 +75,30 @@ public:
         std::forward<Func>(f));
   }
 
+  /**
+   * @brief Registers a continuation function to be invoked in a worker thread
+   * with the given priority when this Future resolves, and invalidates this
+   * Future.
+   *
+   * The priority is passed to {@link ITaskProcessor::startPrioritizedTask}.
+   * As with {@link AsyncSystem::runInWorkerThread}, the continuation is
+   * invoked immediately, regardless of its priority, if this Future is
+   * resolved from a designated worker thread.
+   *
+   * @tparam Func The type of the function.
+   * @param f The function.
+   * @param priority The priority of the continuation.
+   * @return A future that resolves after the supplied function completes.
+   */
+  template <typename Func>
+  CesiumImpl::ContinuationFutureType_t<Func, T>
+  thenInWorkerThread(Func&& f, TaskPriority priority) && {
+    return std::move(*this).thenWithScheduler(
+        this->_pSchedulers->workerThread.prioritized(priority),
+        "waiting for worker thread",
+        std::forward<Func>(f));
+  }
+
   /**
    * @brief Registers a continuation function to be invoked in the main thread
    * when this Future resolves, and invalidates this Future.
@@ -100,6 +125,31 @@ public:
         std::forward<Func>(f));
   }
 
+  /**
+   * @brief Registers a continuation function to be invoked in the main thread
+   * with the given priority when this Future resolves, and invalidates this
+   * Future.
+   *
+   * Each dispatch of main-thread tasks runs waiting high-priority
+   * continuations before waiting low-priority ones. As with
+   * {@link AsyncSystem::runInMainThread}, the continuation is invoked
+   * immediately, regardless of its priority, if this Future is resolved from
+   * the main thread.
+   *
+   * @tparam Func The type of the function.
+   * @param f The function.
+   * @param priority The priority of the continuation.
+   * @return A future that resolves after the supplied function completes.
+   */
+  template <typename Func>
+  CesiumImpl::ContinuationFutureType_t<Func, T>
+  thenInMainThread(Func&& f, TaskPriority priority) && {
+    return std::move(*this).thenWithScheduler(
+        this->_pSchedulers->mainThread.prioritized(priority),
+        "waiting for main thread",
+        std::forward<Func>(f));
+  }
+
   /**
    * @brief Registers a continuation function to be invoked immediately in
    * whichever thread causes the Future to be resolved, and invalidates this
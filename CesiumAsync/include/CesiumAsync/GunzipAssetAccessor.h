@@ -1,5 +1,6 @@
 #pragma once
 
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 
@@ -28,6 +29,13 @@ public:
       const std::string& url,
       const std::vector<THeader>& headers) override;
 
+  /** @copydoc IAssetAccessor::getCancelable */
+  virtual Future<std::shared_ptr<IAssetRequest>> getCancelable(
+      const AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers,
+      const CancellationToken& cancellationToken) override;
+
   virtual Future<std::shared_ptr<IAssetRequest>> request(
       const AsyncSystem& asyncSystem,
       const std::string& verb,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/Library.h>
@@ -41,6 +42,31 @@ public:
       const std::string& url,
       const std::vector<THeader>& headers = {}) = 0;
 
+  /**
+   * @brief Starts a new request for the asset with the given URL, which may be
+   * abandoned if the given token is canceled before it completes.
+   *
+   * Accessors that can abort a request in progress, or that do further work
+   * after the request completes, override this method to stop early once the
+   * token is canceled. The default implementation rejects the returned future
+   * if the token is already canceled, and otherwise calls {@link get}.
+   *
+   * A request that is abandoned rejects the returned future. A request that
+   * is canceled too late to be abandoned completes normally.
+   *
+   * @param asyncSystem The async system used to do work in threads.
+   * @param url The URL of the asset.
+   * @param headers The headers to include in the request.
+   * @param cancellationToken The token that signals that the asset is no
+   * longer needed.
+   * @return The in-progress asset request.
+   */
+  virtual CesiumAsync::Future<std::shared_ptr<IAssetRequest>> getCancelable(
+      const AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers,
+      const CancellationToken& cancellationToken);
+
   /**
    * @brief Starts a new request to the given URL, using the provided HTTP verb
    * and the provided content payload.
@@ -3,8 +3,10 @@
 #include <CesiumAsync/HttpHeaders.h>
 #include <CesiumAsync/Library.h>
 
+#include <cstddef>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace CesiumAsync {
 
@@ -40,6 +42,23 @@ public:
    * This method may be called from any thread.
    */
   virtual const IAssetResponse* response() const = 0;
+
+  /**
+   * @brief Takes ownership of the data of the response.
+   *
+   * Implementations that own the response data in a `std::vector` move it
+   * out, so that a large response can be adopted by whatever is decoded from
+   * it instead of being copied. The default implementation copies
+   * {@link IAssetResponse::data}.
+   *
+   * After this method is called, the response's data may be empty. Only the
+   * last user of a completed request should call it, and requests that are
+   * shared between multiple users should not override it.
+   *
+   * @return The data of the response, or an empty vector if there is no
+   * response.
+   */
+  virtual std::vector<std::byte> takeResponseData();
 };
 
 } // namespace CesiumAsync
@@ -2,9 +2,39 @@
 
 #include <CesiumAsync/Library.h>
 
+#include <cstdint>
 #include <functional>
+#include <utility>
 
 namespace CesiumAsync {
+
+/**
+ * @brief The priority of a task started with
+ * {@link ITaskProcessor::startPrioritizedTask}, or of a main-thread task.
+ *
+ * A task processor that supports priorities starts all waiting tasks of a
+ * higher priority before any waiting task of a lower priority. So does each
+ * dispatch of main-thread tasks. Tasks that have already started are not
+ * interrupted.
+ */
+enum class TaskPriority : uint8_t {
+  /**
+   * @brief Work that something is waiting for right now, such as decoding the
+   * content of tiles near the camera.
+   */
+  High,
+
+  /**
+   * @brief The priority of tasks started without a priority.
+   */
+  Normal,
+
+  /**
+   * @brief Background work, such as prefetching and writing to caches.
+   */
+  Low
+};
+
 /**
  * @brief When implemented by a rendering engine, allows tasks to be
  * asynchronously executed in background threads.
@@ -25,5 +55,21 @@ public:
    * @param f The function to execute
    */
   virtual void startTask(std::function<void()> f) = 0;
+
+  /**
+   * @brief Starts a task that executes the given function in a background
+   * thread, with the given priority.
+   *
+   * The default implementation ignores the priority and calls
+   * {@link startTask}.
+   *
+   * @param f The function to execute
+   * @param priority The priority of the task.
+   */
+  virtual void
+  startPrioritizedTask(std::function<void()> f, TaskPriority priority) {
+    (void)priority;
+    this->startTask(std::move(f));
+  }
 };
 } // namespace CesiumAsync
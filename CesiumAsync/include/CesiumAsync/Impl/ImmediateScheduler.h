@@ -18,10 +18,7 @@ public:
 
   void schedule(async::task_run_handle t) {
     // Are we already in a suitable thread?
-    std::vector<TScheduler*>& inSuitable =
-        ImmediateScheduler<TScheduler>::getSchedulersCurrentlyDispatching();
-    if (std::find(inSuitable.begin(), inSuitable.end(), this->_pScheduler) !=
-        inSuitable.end()) {
+    if (this->isCurrentThreadDispatching()) {
       // Yes, run this task directly.
       t.run();
     } else {
@@ -30,6 +27,13 @@ public:
     }
   }
 
+  bool isCurrentThreadDispatching() const noexcept {
+    std::vector<TScheduler*>& inSuitable =
+        ImmediateScheduler<TScheduler>::getSchedulersCurrentlyDispatching();
+    return std::find(inSuitable.begin(), inSuitable.end(), this->_pScheduler) !=
+           inSuitable.end();
+  }
+
   class SchedulerScope {
   public:
     SchedulerScope(TScheduler* pScheduler = nullptr) : _pScheduler(pScheduler) {
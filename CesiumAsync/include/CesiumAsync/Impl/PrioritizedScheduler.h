@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../ITaskProcessor.h"
+#include "cesium-async++.h"
+
+#include <utility>
+
+namespace CesiumAsync {
+// Begin omitting doxygen warnings for Impl namespace
+//! @cond Doxygen_Suppress
+namespace CesiumImpl {
+
+// Like ImmediateScheduler, but schedules tasks with a priority. A task that is
+// scheduled from a thread that is already dispatching the scheduler's tasks
+// runs immediately, regardless of its priority.
+template <typename TScheduler> class PrioritizedScheduler {
+public:
+  PrioritizedScheduler(TScheduler* pScheduler, TaskPriority priority) noexcept
+      : _pScheduler(pScheduler), _priority(priority) {}
+
+  void schedule(async::task_run_handle t) {
+    if (this->_pScheduler->immediate.isCurrentThreadDispatching()) {
+      t.run();
+    } else {
+      this->_pScheduler->schedule(std::move(t), this->_priority);
+    }
+  }
+
+private:
+  TScheduler* _pScheduler;
+  TaskPriority _priority;
+};
+
+} // namespace CesiumImpl
+//! @endcond
+// End omitting doxygen warnings for Impl namespace
+} // namespace CesiumAsync
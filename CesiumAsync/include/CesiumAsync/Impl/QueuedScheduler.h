@@ -1,9 +1,13 @@
 #pragma once
 
+#include "../ITaskProcessor.h"
 #include "ImmediateScheduler.h"
+#include "PrioritizedScheduler.h"
 #include "cesium-async++.h"
 
+#include <array>
 #include <atomic>
+#include <cstddef>
 
 namespace CesiumAsync {
 // Begin omitting doxygen warnings for Impl namespace
@@ -16,8 +20,10 @@ public:
   ~QueuedScheduler();
 
   void schedule(async::task_run_handle t);
+  void schedule(async::task_run_handle t, TaskPriority priority);
   void dispatchQueuedContinuations();
   bool dispatchZeroOrOneContinuation();
+  size_t getQueuedContinuationCount() const;
 
   template <typename T> T dispatchUntilTaskCompletes(async::task<T>&& task) {
     // Set up a continuation to unblock the blocking dispatch when this task
@@ -81,12 +87,27 @@ public:
 
   ImmediateScheduler<QueuedScheduler> immediate{this};
 
+  PrioritizedScheduler<QueuedScheduler>&
+  prioritized(TaskPriority priority) noexcept {
+    return this->_prioritized[size_t(priority)];
+  }
+
 private:
   bool dispatchInternal(bool blockIfNoTasks);
   void unblock();
 
   struct Impl;
   std::unique_ptr<Impl> _pImpl;
+
+  // Continuations keep a pointer to their scheduler, so there is one
+  // long-lived scheduler per priority.
+  std::array<
+      PrioritizedScheduler<QueuedScheduler>,
+      size_t(TaskPriority::Low) + 1>
+      _prioritized{
+          PrioritizedScheduler<QueuedScheduler>(this, TaskPriority::High),
+          PrioritizedScheduler<QueuedScheduler>(this, TaskPriority::Normal),
+          PrioritizedScheduler<QueuedScheduler>(this, TaskPriority::Low)};
 };
 //! @endcond
 // End omitting doxygen warnings for Impl namespace
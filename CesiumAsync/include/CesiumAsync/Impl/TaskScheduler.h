@@ -2,7 +2,10 @@
 
 #include "../ITaskProcessor.h"
 #include "ImmediateScheduler.h"
+#include "PrioritizedScheduler.h"
 
+#include <array>
+#include <cstddef>
 #include <memory>
 
 namespace CesiumAsync {
@@ -14,11 +17,25 @@ class TaskScheduler {
 public:
   TaskScheduler(const std::shared_ptr<ITaskProcessor>& pTaskProcessor);
   void schedule(async::task_run_handle t);
+  void schedule(async::task_run_handle t, TaskPriority priority);
 
   ImmediateScheduler<TaskScheduler> immediate{this};
 
+  PrioritizedScheduler<TaskScheduler>&
+  prioritized(TaskPriority priority) noexcept {
+    return this->_prioritized[size_t(priority)];
+  }
+
 private:
   std::shared_ptr<ITaskProcessor> _pTaskProcessor;
+
+  // Continuations keep a pointer to their scheduler, so there is one
+  // long-lived scheduler per priority.
+  std::array<PrioritizedScheduler<TaskScheduler>, size_t(TaskPriority::Low) + 1>
+      _prioritized{
+          PrioritizedScheduler<TaskScheduler>(this, TaskPriority::High),
+          PrioritizedScheduler<TaskScheduler>(this, TaskPriority::Normal),
+          PrioritizedScheduler<TaskScheduler>(this, TaskPriority::Low)};
 };
 //! @endcond
 // End omitting doxygen warnings for Impl namespace
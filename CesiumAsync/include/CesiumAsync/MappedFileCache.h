@@ -0,0 +1,99 @@
+#pragma once
+
+#include <CesiumAsync/ICacheDatabase.h>
+#include <CesiumAsync/Library.h>
+
+#include <spdlog/fwd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace CesiumAsync {
+
+/**
+ * @brief Cache storage that appends completed responses to memory-mapped
+ * segment files.
+ *
+ * Unlike {@link SqliteCache}, the body of a response is never copied when it
+ * is read from this cache. The {@link CacheResponse} returned by
+ * {@link getEntry} refers directly to the mapped file, and keeps the mapping
+ * alive for as long as it exists. This makes cache hits for large responses,
+ * such as tile content, much cheaper.
+ *
+ * Each segment file is written sequentially. Replaced and removed entries are
+ * not reclaimed immediately. Instead, {@link prune} copies the remaining
+ * entries out of mostly-unused segments and then deletes them.
+ *
+ * The index of the cache is kept in memory and rebuilt from the segment files
+ * when the cache is constructed.
+ *
+ * All methods may be called from multiple threads at once.
+ */
+class CESIUMASYNC_API MappedFileCache : public ICacheDatabase {
+public:
+  /**
+   * @brief The default size of each segment file, in bytes.
+   */
+  static constexpr uint64_t DEFAULT_SEGMENT_SIZE = 32 * 1024 * 1024;
+
+  /**
+   * @brief Constructs a new instance that stores its segment files in the
+   * given directory.
+   *
+   * The directory is created if it does not exist. Existing segment files in
+   * it are loaded.
+   *
+   * @param pLogger The logger that receives error messages.
+   * @param directory The directory that contains the segment files.
+   * @param maxItems The maximum number of items that should be kept in the
+   * cache after pruning.
+   * @param segmentSize The size of each segment file, in bytes. Responses
+   * larger than this are stored in their own segment file.
+   * @throws std::runtime_error if the directory or an existing segment file
+   * cannot be opened.
+   */
+  MappedFileCache(
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const std::string& directory,
+      uint64_t maxItems = 4096,
+      uint64_t segmentSize = DEFAULT_SEGMENT_SIZE);
+  ~MappedFileCache() noexcept override;
+
+  /** @copydoc ICacheDatabase::getEntry*/
+  virtual std::optional<CacheItem>
+  getEntry(const std::string& key) const override;
+
+  /** @copydoc ICacheDatabase::storeEntry*/
+  virtual bool storeEntry(
+      const std::string& key,
+      std::time_t expiryTime,
+      const std::string& url,
+      const std::string& requestMethod,
+      const HttpHeaders& requestHeaders,
+      uint16_t statusCode,
+      const HttpHeaders& responseHeaders,
+      const std::span<const std::byte>& responseData) override;
+
+  /**
+   * @copydoc ICacheDatabase::prune
+   *
+   * This also compacts segment files that are mostly unused. It may take a
+   * while, so it should not be called from the main thread.
+   * {@link CachingAssetAccessor} calls it from its cache thread pool.
+   */
+  virtual bool prune() override;
+
+  /** @copydoc ICacheDatabase::clearAll*/
+  virtual bool clearAll() override;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> _pImpl;
+};
+
+} // namespace CesiumAsync
@@ -13,6 +13,10 @@ namespace CesiumAsync {
 
 /**
  * @brief Cache storage using SQLITE to store completed response.
+ *
+ * All methods may be called from multiple threads at once. Reads use a pool of
+ * connections, so cache hits on different threads do not wait for each other
+ * or for writes.
  */
 class CESIUMASYNC_API SqliteCache : public ICacheDatabase {
 public:
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <CesiumAsync/ITaskProcessor.h>
+#include <CesiumAsync/Library.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace CesiumAsync {
+
+/**
+ * @brief An {@link ITaskProcessor} that runs tasks on its own threads, and
+ * supports {@link TaskPriority}.
+ *
+ * Each thread has its own queue of tasks for each priority. A task that is
+ * started from one of these threads is added to that thread's queue, and is
+ * usually run by the same thread, while its data is still in the cache. A
+ * thread with no tasks of its own steals the oldest task from another
+ * thread's queue. Tasks started from other threads are added to a shared
+ * queue.
+ *
+ * A thread always looks for a waiting task of the highest priority first, so
+ * low-priority tasks only run when no higher-priority task is waiting.
+ *
+ * Tasks are queued as the `std::function` they are started with, which is
+ * moved rather than copied. Because {@link ITaskProcessor} takes a
+ * `std::function`, a task whose callable is too large for the standard
+ * library's small-object buffer has already been allocated on the heap before
+ * it reaches this processor, and a `std::function`-free task storage would
+ * not avoid that allocation. Removing it would require a change to
+ * {@link ITaskProcessor}.
+ *
+ * When this instance is destroyed, it waits for all of the tasks that have
+ * been started to complete.
+ */
+class CESIUMASYNC_API WorkStealingTaskProcessor : public ITaskProcessor {
+public:
+  /**
+   * @brief Constructs a new instance and starts its threads.
+   *
+   * @param numberOfThreads The number of threads that run tasks. If zero or
+   * less, one fewer than the number of hardware threads is used, so that the
+   * main thread has a core to itself, but always at least one.
+   */
+  explicit WorkStealingTaskProcessor(int32_t numberOfThreads = 0);
+
+  /**
+   * @brief Waits for all started tasks to complete, and then stops the
+   * threads.
+   */
+  virtual ~WorkStealingTaskProcessor() noexcept override;
+
+  WorkStealingTaskProcessor(const WorkStealingTaskProcessor&) = delete;
+  WorkStealingTaskProcessor&
+  operator=(const WorkStealingTaskProcessor&) = delete;
+
+  /**
+   * @copydoc ITaskProcessor::startTask
+   *
+   * The task has {@link TaskPriority::Normal} priority.
+   */
+  virtual void startTask(std::function<void()> f) override;
+
+  /** @copydoc ITaskProcessor::startPrioritizedTask */
+  virtual void startPrioritizedTask(
+      std::function<void()> f,
+      TaskPriority priority) override;
+
+  /**
+   * @brief Gets the number of threads that run tasks.
+   */
+  int32_t getNumberOfThreads() const noexcept;
+
+private:
+  struct Impl;
+  std::shared_ptr<Impl> _pImpl;
+};
+
+} // namespace CesiumAsync
@@ -3,7 +3,10 @@
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumAsync/ThreadPool.h>
+#include <CesiumUtility/Tracing.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 
@@ -18,6 +21,38 @@ void AsyncSystem::dispatchMainThreadTasks() {
   this->_pSchedulers->mainThread.dispatchQueuedContinuations();
 }
 
+MainThreadDispatchStatistics
+AsyncSystem::dispatchMainThreadTasks(double timeBudgetMilliseconds) {
+  CESIUM_TRACE("AsyncSystem::dispatchMainThreadTasks");
+
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+
+  CesiumImpl::QueuedScheduler& scheduler = this->_pSchedulers->mainThread;
+  MainThreadDispatchStatistics statistics;
+
+  const auto start = std::chrono::steady_clock::now();
+  auto taskStart = start;
+  while (scheduler.dispatchZeroOrOneContinuation()) {
+    const auto taskEnd = std::chrono::steady_clock::now();
+
+    ++statistics.tasksDispatched;
+    statistics.longestTaskMilliseconds = std::max(
+        statistics.longestTaskMilliseconds,
+        Milliseconds(taskEnd - taskStart).count());
+    statistics.elapsedMilliseconds = Milliseconds(taskEnd - start).count();
+
+    if (timeBudgetMilliseconds > 0.0 &&
+        statistics.elapsedMilliseconds >= timeBudgetMilliseconds) {
+      break;
+    }
+
+    taskStart = taskEnd;
+  }
+
+  statistics.tasksRemaining = scheduler.getQueuedContinuationCount();
+  return statistics;
+}
+
 bool AsyncSystem::dispatchOneMainThreadTask() {
   return this->_pSchedulers->mainThread.dispatchZeroOrOneContinuation();
 }
@@ -1,13 +1,16 @@
 #include "InternalTimegm.h"
+#include "RequestCanceledError.h"
 #include "ResponseCacheControl.h"
 
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/CacheItem.h>
 #include <CesiumAsync/CachingAssetAccessor.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
 #include <CesiumAsync/ICacheDatabase.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumUtility/Tracing.h>
 
 #include <spdlog/logger.h>
@@ -51,9 +54,17 @@ public:
   }
 
   virtual std::span<const std::byte> data() const noexcept override {
-    return std::span<const std::byte>(
-        this->_cacheResponse.data.data(),
-        this->_cacheResponse.data.size());
+    return this->_cacheResponse.getData();
+  }
+
+  std::vector<std::byte> takeData() {
+    // Data that is owned by the cache response can be moved out, but data
+    // that is only viewed must be copied.
+    if (this->_cacheResponse.data.empty()) {
+      const std::span<const std::byte> data = this->_cacheResponse.getData();
+      return std::vector<std::byte>(data.begin(), data.end());
+    }
+    return std::move(this->_cacheResponse.data);
   }
 
 private:
@@ -87,6 +98,10 @@ public:
     return &this->_response;
   }
 
+  virtual std::vector<std::byte> takeResponseData() override {
+    return this->_response.takeData();
+  }
+
 private:
   std::string _method;
   std::string _url;
@@ -144,6 +159,12 @@ std::shared_ptr<IAssetRequest> updateCacheItem(
     CacheItem&& cacheItem,
     const IAssetRequest& request);
 
+void storeEntryInBackground(
+    const AsyncSystem& asyncSystem,
+    const std::shared_ptr<ICacheDatabase>& pCacheDatabase,
+    const IAssetRequest& request,
+    const std::optional<ResponseCacheControl>& cacheControl);
+
 } // namespace
 
 CachingAssetAccessor::CachingAssetAccessor(
@@ -164,6 +185,14 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
     const AsyncSystem& asyncSystem,
     const std::string& url,
     const std::vector<THeader>& headers) {
+  return this->getCancelable(asyncSystem, url, headers, CancellationToken());
+}
+
+Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::getCancelable(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const CancellationToken& cancellationToken) {
   const int32_t requestSinceLastPrune = ++this->_requestSinceLastPrune;
   if (requestSinceLastPrune == this->_requestsPerCachePrune) {
     // More requests may have started and incremented _requestSinceLastPrune
@@ -189,15 +218,22 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
            pLogger = this->_pLogger,
            url = url,
            headers = headers,
-           threadPool]() mutable -> Future<std::shared_ptr<IAssetRequest>> {
+           threadPool,
+           cancellationToken]() mutable
+          -> Future<std::shared_ptr<IAssetRequest>> {
+            if (cancellationToken.isCanceled()) {
+              throw createRequestCanceledError(url);
+            }
+
             std::optional<CacheItem> cacheLookup =
                 pCacheDatabase->getEntry(url);
             if (!cacheLookup) {
               // No cache item found, request directly from the server
-              return pAssetAccessor->get(asyncSystem, url, headers)
+              return pAssetAccessor
+                  ->getCancelable(asyncSystem, url, headers, cancellationToken)
                   .thenInThreadPool(
                       threadPool,
-                      [pCacheDatabase, pLogger](
+                      [asyncSystem, pCacheDatabase, pLogger](
                           std::shared_ptr<IAssetRequest>&& pCompletedRequest) {
                         const IAssetResponse* pResponse =
                             pCompletedRequest->response();
@@ -212,17 +248,11 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
                         if (pResponse && shouldCacheRequest(
                                              *pCompletedRequest,
                                              cacheControl)) {
-                          pCacheDatabase->storeEntry(
-                              calculateCacheKey(*pCompletedRequest),
-                              calculateExpiryTime(
-                                  *pCompletedRequest,
-                                  cacheControl),
-                              pCompletedRequest->url(),
-                              pCompletedRequest->method(),
-                              pCompletedRequest->headers(),
-                              pResponse->statusCode(),
-                              pResponse->headers(),
-                              pResponse->data());
+                          storeEntryInBackground(
+                              asyncSystem,
+                              pCacheDatabase,
+                              *pCompletedRequest,
+                              cacheControl);
                         }
 
                         return std::move(pCompletedRequest);
@@ -249,10 +279,16 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
                       lastModifiedHeader->second);
               }
 
-              return pAssetAccessor->get(asyncSystem, url, newHeaders)
+              return pAssetAccessor
+                  ->getCancelable(
+                      asyncSystem,
+                      url,
+                      newHeaders,
+                      cancellationToken)
                   .thenInThreadPool(
                       threadPool,
-                      [cacheItem = std::move(cacheItem),
+                      [asyncSystem,
+                       cacheItem = std::move(cacheItem),
                        pCacheDatabase,
                        pLogger,
                        url = std::move(url),
@@ -293,17 +329,11 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
                         if (shouldCacheRequest(
                                 *pRequestToStore,
                                 cacheControl)) {
-                          pCacheDatabase->storeEntry(
-                              calculateCacheKey(*pRequestToStore),
-                              calculateExpiryTime(
-                                  *pRequestToStore,
-                                  cacheControl),
-                              pRequestToStore->url(),
-                              pRequestToStore->method(),
-                              pRequestToStore->headers(),
-                              pResponseToStore->statusCode(),
-                              pResponseToStore->headers(),
-                              pResponseToStore->data());
+                          storeEntryInBackground(
+                              asyncSystem,
+                              pCacheDatabase,
+                              *pRequestToStore,
+                              cacheControl);
                         }
 
                         return pRequestToStore;
@@ -494,6 +524,40 @@ std::shared_ptr<IAssetRequest> updateCacheItem(
       std::move(cacheItem));
 }
 
+void storeEntryInBackground(
+    const AsyncSystem& asyncSystem,
+    const std::shared_ptr<ICacheDatabase>& pCacheDatabase,
+    const IAssetRequest& request,
+    const std::optional<ResponseCacheControl>& cacheControl) {
+  // The write runs in a low-priority worker thread task, so that it does not
+  // delay the work that is waiting for this response. The response data is
+  // copied because the caller may take it from the request before the write
+  // runs.
+  const IAssetResponse* pResponse = request.response();
+  const std::span<const std::byte> data = pResponse->data();
+  asyncSystem.runInWorkerThread(
+      [pCacheDatabase,
+       key = calculateCacheKey(request),
+       expiryTime = calculateExpiryTime(request, cacheControl),
+       url = request.url(),
+       method = request.method(),
+       requestHeaders = request.headers(),
+       statusCode = pResponse->statusCode(),
+       responseHeaders = pResponse->headers(),
+       data = std::vector<std::byte>(data.begin(), data.end())]() {
+        pCacheDatabase->storeEntry(
+            key,
+            expiryTime,
+            url,
+            method,
+            requestHeaders,
+            statusCode,
+            responseHeaders,
+            data);
+      },
+      TaskPriority::Low);
+}
+
 std::time_t convertHttpDateToTime(const std::string& httpDate) {
   std::tm tm = {};
   std::stringstream ss(httpDate);
@@ -0,0 +1,75 @@
+#include <CesiumAsync/CancellationToken.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace CesiumAsync {
+
+CancellationRegistration::CancellationRegistration(
+    CancellationRegistration&& rhs) noexcept
+    : _pState(std::move(rhs._pState)), _id(rhs._id) {}
+
+CancellationRegistration&
+CancellationRegistration::operator=(CancellationRegistration&& rhs) noexcept {
+  if (this != &rhs) {
+    this->reset();
+    this->_pState = std::move(rhs._pState);
+    this->_id = rhs._id;
+  }
+  return *this;
+}
+
+CancellationRegistration::~CancellationRegistration() noexcept {
+  this->reset();
+}
+
+void CancellationRegistration::reset() noexcept {
+  if (!this->_pState) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->_pState->mutex);
+    std::erase_if(this->_pState->callbacks, [id = this->_id](const auto& pair) {
+      return pair.first == id;
+    });
+  }
+  this->_pState.reset();
+}
+
+CancellationRegistration
+CancellationToken::onCancel(std::function<void()> callback) const {
+  if (!this->_pState) {
+    return CancellationRegistration();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->_pState->mutex);
+    if (!this->_pState->canceled.load(std::memory_order_relaxed)) {
+      const uint64_t id = this->_pState->nextCallbackId++;
+      this->_pState->callbacks.emplace_back(id, std::move(callback));
+      return CancellationRegistration(this->_pState, id);
+    }
+  }
+
+  callback();
+  return CancellationRegistration();
+}
+
+void CancellationSource::cancel() noexcept {
+  std::lock_guard<std::mutex> lock(this->_pState->mutex);
+  if (this->_pState->canceled.exchange(true, std::memory_order_relaxed)) {
+    return;
+  }
+
+  for (const auto& [id, callback] : this->_pState->callbacks) {
+    callback();
+  }
+  this->_pState->callbacks.clear();
+}
+
+} // namespace CesiumAsync
@@ -1,4 +1,5 @@
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/CesiumIonAssetAccessor.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/HttpHeaders.h>
@@ -46,10 +47,19 @@ CesiumIonAssetAccessor::get(
     const CesiumAsync::AsyncSystem& asyncSystem,
     const std::string& url,
     const std::vector<THeader>& headers) {
+  return this->getCancelable(asyncSystem, url, headers, CancellationToken());
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+CesiumIonAssetAccessor::getCancelable(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const CancellationToken& cancellationToken) {
   // If token refresh is needed, this lambda will be called in the main thread
   // so that it can safely use the tileset loader.
   auto refreshToken =
-      [pThis = this->shared_from_this()](
+      [pThis = this->shared_from_this(), cancellationToken](
           const CesiumAsync::AsyncSystem& asyncSystem,
           std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) {
         if (!pThis->_maybeUpdatedTokenCallback) {
@@ -81,6 +91,7 @@ CesiumIonAssetAccessor::get(
                 currentAccessTokenQueryParameterValue)
             .thenImmediately([pThis,
                               asyncSystem,
+                              cancellationToken,
                               pRequest = std::move(pRequest)](
                                  const UpdatedToken& updatedToken) mutable {
               if (updatedToken.authorizationHeader.empty() &&
@@ -112,11 +123,16 @@ CesiumIonAssetAccessor::get(
               std::vector<THeader> vecHeaders(
                   std::make_move_iterator(headers.begin()),
                   std::make_move_iterator(headers.end()));
-              return pThis->get(asyncSystem, url, vecHeaders);
+              return pThis->getCancelable(
+                  asyncSystem,
+                  url,
+                  vecHeaders,
+                  cancellationToken);
             });
       };
 
-  return this->_pAggregatedAccessor->get(asyncSystem, url, headers)
+  return this->_pAggregatedAccessor
+      ->getCancelable(asyncSystem, url, headers, cancellationToken)
       .thenImmediately(
           [asyncSystem, refreshToken = std::move(refreshToken)](
               std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) mutable {
@@ -0,0 +1,255 @@
+#include "MappedFile.h"
+#include "RequestCanceledError.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
+#include <CesiumAsync/FileAssetAccessor.h>
+#include <CesiumAsync/Future.h>
+#include <CesiumAsync/HttpHeaders.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/Promise.h>
+#include <CesiumUtility/ByteBufferPool.h>
+#include <CesiumUtility/Uri.h>
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+using namespace CesiumUtility;
+
+namespace CesiumAsync {
+
+namespace {
+
+class FileAssetResponse : public IAssetResponse {
+public:
+  // A response for a file that could not be found.
+  FileAssetResponse() noexcept : _statusCode(404) {}
+
+  FileAssetResponse(std::unique_ptr<MappedFile>&& pMappedFile) noexcept
+      : _statusCode(200), _pMappedFile(std::move(pMappedFile)) {}
+
+  FileAssetResponse(
+      std::vector<std::byte>&& data,
+      const std::shared_ptr<ByteBufferPool>& pBufferPool) noexcept
+      : _statusCode(200), _data(std::move(data)), _pBufferPool(pBufferPool) {}
+
+  virtual ~FileAssetResponse() noexcept override {
+    if (this->_pBufferPool) {
+      this->_pBufferPool->release(std::move(this->_data));
+    }
+  }
+
+  FileAssetResponse(const FileAssetResponse&) = delete;
+  FileAssetResponse& operator=(const FileAssetResponse&) = delete;
+
+  virtual uint16_t statusCode() const noexcept override {
+    return this->_statusCode;
+  }
+
+  virtual std::string contentType() const override { return {}; }
+
+  virtual const HttpHeaders& headers() const noexcept override {
+    return this->_headers;
+  }
+
+  virtual std::span<const std::byte> data() const noexcept override {
+    if (this->_pMappedFile) {
+      return std::span<const std::byte>(
+          this->_pMappedFile->data(),
+          size_t(this->_pMappedFile->size()));
+    }
+    return this->_data;
+  }
+
+  std::vector<std::byte> takeData() {
+    if (this->_pMappedFile) {
+      const std::span<const std::byte> mapped = this->data();
+      return std::vector<std::byte>(mapped.begin(), mapped.end());
+    }
+    return std::move(this->_data);
+  }
+
+private:
+  uint16_t _statusCode;
+  HttpHeaders _headers;
+  std::unique_ptr<MappedFile> _pMappedFile;
+  std::vector<std::byte> _data;
+  std::shared_ptr<ByteBufferPool> _pBufferPool;
+};
+
+class FileAssetRequest : public IAssetRequest {
+public:
+  FileAssetRequest(
+      const std::string& url,
+      const std::vector<IAssetAccessor::THeader>& headers,
+      std::unique_ptr<FileAssetResponse>&& pResponse)
+      : _method("GET"),
+        _url(url),
+        _headers(headers.begin(), headers.end()),
+        _pResponse(std::move(pResponse)) {}
+
+  virtual const std::string& method() const noexcept override {
+    return this->_method;
+  }
+
+  virtual const std::string& url() const noexcept override {
+    return this->_url;
+  }
+
+  virtual const HttpHeaders& headers() const noexcept override {
+    return this->_headers;
+  }
+
+  virtual const IAssetResponse* response() const noexcept override {
+    return this->_pResponse.get();
+  }
+
+  virtual std::vector<std::byte> takeResponseData() override {
+    return this->_pResponse->takeData();
+  }
+
+private:
+  std::string _method;
+  std::string _url;
+  HttpHeaders _headers;
+  std::unique_ptr<FileAssetResponse> _pResponse;
+};
+
+bool isFile(const std::string& url) {
+  return Uri(url).getScheme() == "file:";
+}
+
+std::unique_ptr<FileAssetResponse>
+readFile(const std::string& url, const FileAssetAccessorOptions& options) {
+  const std::filesystem::path path =
+      Uri::uriPathToNativePath(Uri::getPath(url));
+
+  std::error_code error;
+  const uintmax_t size = std::filesystem::file_size(path, error);
+  if (error) {
+    return std::make_unique<FileAssetResponse>();
+  }
+
+  if (size >= options.minimumMappedSize) {
+    return std::make_unique<FileAssetResponse>(
+        std::make_unique<MappedFile>(path));
+  }
+
+  std::vector<std::byte> data = options.pBufferPool
+                                    ? options.pBufferPool->acquire(size_t(size))
+                                    : std::vector<std::byte>(size_t(size));
+  std::ifstream file(path, std::ios::binary);
+  file.read(reinterpret_cast<char*>(data.data()), std::streamsize(size));
+  if (!file) {
+    if (options.pBufferPool) {
+      options.pBufferPool->release(std::move(data));
+    }
+    throw std::runtime_error(fmt::format("Unable to read `{}`.", url));
+  }
+
+  return std::make_unique<FileAssetResponse>(
+      std::move(data),
+      options.pBufferPool);
+}
+
+Future<std::shared_ptr<IAssetRequest>>
+createFailedFuture(const AsyncSystem& asyncSystem, std::string&& message) {
+  return asyncSystem.createFuture<std::shared_ptr<IAssetRequest>>(
+      [&message](const Promise<std::shared_ptr<IAssetRequest>>& promise) {
+        promise.reject(std::runtime_error(std::move(message)));
+      });
+}
+
+} // namespace
+
+FileAssetAccessor::FileAssetAccessor(
+    const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
+    const FileAssetAccessorOptions& options)
+    : _pAssetAccessor(pAssetAccessor),
+      _options(options),
+      _threadPool(options.numberOfThreads) {}
+
+FileAssetAccessor::~FileAssetAccessor() noexcept = default;
+
+Future<std::shared_ptr<IAssetRequest>> FileAssetAccessor::get(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  return this->getCancelable(asyncSystem, url, headers, CancellationToken());
+}
+
+Future<std::shared_ptr<IAssetRequest>> FileAssetAccessor::getCancelable(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const CancellationToken& cancellationToken) {
+  if (!isFile(url)) {
+    if (this->_pAssetAccessor) {
+      return this->_pAssetAccessor
+          ->getCancelable(asyncSystem, url, headers, cancellationToken);
+    }
+    return createFailedFuture(
+        asyncSystem,
+        fmt::format("FileAssetAccessor cannot get `{}`.", url));
+  }
+
+  return asyncSystem.runInThreadPool(
+      this->_threadPool,
+      [url, headers, options = this->_options, cancellationToken]()
+          -> std::shared_ptr<IAssetRequest> {
+        if (cancellationToken.isCanceled()) {
+          throw createRequestCanceledError(url);
+        }
+        return std::make_shared<FileAssetRequest>(
+            url,
+            headers,
+            readFile(url, options));
+      });
+}
+
+Future<std::shared_ptr<IAssetRequest>> FileAssetAccessor::request(
+    const AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const std::span<const std::byte>& contentPayload) {
+  if (!isFile(url)) {
+    if (this->_pAssetAccessor) {
+      return this->_pAssetAccessor
+          ->request(asyncSystem, verb, url, headers, contentPayload);
+    }
+    return createFailedFuture(
+        asyncSystem,
+        fmt::format("FileAssetAccessor cannot {} `{}`.", verb, url));
+  }
+
+  if (verb != "GET") {
+    return createFailedFuture(
+        asyncSystem,
+        fmt::format("FileAssetAccessor does not support verb `{}`.", verb));
+  }
+
+  return this->get(asyncSystem, url, headers);
+}
+
+void FileAssetAccessor::tick() noexcept {
+  if (this->_pAssetAccessor) {
+    this->_pAssetAccessor->tick();
+  }
+}
+
+} // namespace CesiumAsync
@@ -1,4 +1,5 @@
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/GunzipAssetAccessor.h>
 #include <CesiumAsync/HttpHeaders.h>
 #include <CesiumAsync/IAssetAccessor.h>
@@ -44,6 +45,12 @@ public:
                             : this->_pAssetResponse->data();
   }
 
+  bool isDataValid() const noexcept { return this->_dataValid; }
+
+  std::vector<std::byte> takeData() noexcept {
+    return std::move(this->_gunzippedData);
+  }
+
 private:
   const IAssetResponse* _pAssetResponse;
   std::vector<std::byte> _gunzippedData;
@@ -71,6 +78,13 @@ public:
     return &this->_assetResponse;
   }
 
+  virtual std::vector<std::byte> takeResponseData() override {
+    if (!this->_assetResponse.isDataValid()) {
+      return this->_pAssetRequest->takeResponseData();
+    }
+    return this->_assetResponse.takeData();
+  }
+
 private:
   std::shared_ptr<IAssetRequest> _pAssetRequest;
   GunzippedAssetResponse _assetResponse;
@@ -103,7 +117,16 @@ Future<std::shared_ptr<IAssetRequest>> GunzipAssetAccessor::get(
     const AsyncSystem& asyncSystem,
     const std::string& url,
     const std::vector<THeader>& headers) {
-  return this->_pAssetAccessor->get(asyncSystem, url, headers)
+  return this->getCancelable(asyncSystem, url, headers, CancellationToken());
+}
+
+Future<std::shared_ptr<IAssetRequest>> GunzipAssetAccessor::getCancelable(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const CancellationToken& cancellationToken) {
+  return this->_pAssetAccessor
+      ->getCancelable(asyncSystem, url, headers, cancellationToken)
       .thenImmediately(
           [asyncSystem](std::shared_ptr<IAssetRequest>&& pCompletedRequest) {
             return gunzipIfNeeded(asyncSystem, std::move(pCompletedRequest));
@@ -0,0 +1,31 @@
+#include "RequestCanceledError.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
+#include <CesiumAsync/Future.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/Promise.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CesiumAsync {
+
+Future<std::shared_ptr<IAssetRequest>> IAssetAccessor::getCancelable(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const CancellationToken& cancellationToken) {
+  if (cancellationToken.isCanceled()) {
+    return asyncSystem.createFuture<std::shared_ptr<IAssetRequest>>(
+        [&url](const Promise<std::shared_ptr<IAssetRequest>>& promise) {
+          promise.reject(createRequestCanceledError(url));
+        });
+  }
+
+  return this->get(asyncSystem, url, headers);
+}
+
+} // namespace CesiumAsync
@@ -0,0 +1,20 @@
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace CesiumAsync {
+
+std::vector<std::byte> IAssetRequest::takeResponseData() {
+  const IAssetResponse* pResponse = this->response();
+  if (!pResponse) {
+    return {};
+  }
+
+  const std::span<const std::byte> data = pResponse->data();
+  return std::vector<std::byte>(data.begin(), data.end());
+}
+
+} // namespace CesiumAsync
@@ -0,0 +1,176 @@
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CesiumAsync {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(
+    const std::filesystem::path& path,
+    uint64_t minimumSize,
+    bool writable)
+    : _pData(nullptr),
+      _size(0),
+      _fileHandle(INVALID_HANDLE_VALUE),
+      _mappingHandle(nullptr) {
+  this->_fileHandle = ::CreateFileW(
+      path.c_str(),
+      writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+      nullptr,
+      writable ? OPEN_ALWAYS : OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+  if (this->_fileHandle == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Unable to open " + path.string());
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!::GetFileSizeEx(this->_fileHandle, &fileSize)) {
+    this->close();
+    throw std::runtime_error("Unable to get the size of " + path.string());
+  }
+
+  this->_size = uint64_t(fileSize.QuadPart);
+  if (this->_size < minimumSize) {
+    this->_size = minimumSize;
+  }
+
+  // A mapping of an empty file is not allowed.
+  if (this->_size == 0) {
+    return;
+  }
+
+  this->_mappingHandle = ::CreateFileMappingW(
+      this->_fileHandle,
+      nullptr,
+      writable ? PAGE_READWRITE : PAGE_READONLY,
+      DWORD(this->_size >> 32),
+      DWORD(this->_size & 0xffffffff),
+      nullptr);
+  if (this->_mappingHandle == nullptr) {
+    this->close();
+    throw std::runtime_error("Unable to map " + path.string());
+  }
+
+  this->_pData = static_cast<std::byte*>(
+      ::MapViewOfFile(
+          this->_mappingHandle,
+          writable ? FILE_MAP_WRITE : FILE_MAP_READ,
+          0,
+          0,
+          0));
+  if (this->_pData == nullptr) {
+    this->close();
+    throw std::runtime_error("Unable to map " + path.string());
+  }
+}
+
+void MappedFile::close() noexcept {
+  if (this->_pData != nullptr) {
+    ::UnmapViewOfFile(this->_pData);
+    this->_pData = nullptr;
+  }
+  if (this->_mappingHandle != nullptr) {
+    ::CloseHandle(this->_mappingHandle);
+    this->_mappingHandle = nullptr;
+  }
+  if (this->_fileHandle != INVALID_HANDLE_VALUE) {
+    ::CloseHandle(this->_fileHandle);
+    this->_fileHandle = INVALID_HANDLE_VALUE;
+  }
+  this->_size = 0;
+}
+
+#else
+
+MappedFile::MappedFile(
+    const std::filesystem::path& path,
+    uint64_t minimumSize,
+    bool writable)
+    : _pData(nullptr), _size(0), _fileDescriptor(-1) {
+  this->_fileDescriptor =
+      writable ? ::open(path.c_str(), O_RDWR | O_CREAT, 0644)
+               : ::open(path.c_str(), O_RDONLY);
+  if (this->_fileDescriptor < 0) {
+    throw std::runtime_error("Unable to open " + path.string());
+  }
+
+  struct stat fileStatus;
+  if (::fstat(this->_fileDescriptor, &fileStatus) != 0) {
+    this->close();
+    throw std::runtime_error("Unable to get the size of " + path.string());
+  }
+
+  this->_size = uint64_t(fileStatus.st_size);
+  if (this->_size < minimumSize) {
+    // The file is sparse, so this does not use any disk space until the
+    // mapping is written to.
+    if (::ftruncate(this->_fileDescriptor, off_t(minimumSize)) != 0) {
+      this->close();
+      throw std::runtime_error("Unable to resize " + path.string());
+    }
+    this->_size = minimumSize;
+  }
+
+  if (this->_size == 0) {
+    return;
+  }
+
+  void* pData = ::mmap(
+      nullptr,
+      size_t(this->_size),
+      writable ? PROT_READ | PROT_WRITE : PROT_READ,
+      MAP_SHARED,
+      this->_fileDescriptor,
+      0);
+  if (pData == MAP_FAILED) {
+    this->close();
+    throw std::runtime_error("Unable to map " + path.string());
+  }
+
+  this->_pData = static_cast<std::byte*>(pData);
+}
+
+void MappedFile::close() noexcept {
+  if (this->_pData != nullptr) {
+    ::munmap(this->_pData, size_t(this->_size));
+    this->_pData = nullptr;
+  }
+  if (this->_fileDescriptor >= 0) {
+    ::close(this->_fileDescriptor);
+    this->_fileDescriptor = -1;
+  }
+  this->_size = 0;
+}
+
+#endif
+
+MappedFile::MappedFile(
+    const std::filesystem::path& path,
+    uint64_t minimumSize)
+    : MappedFile(path, minimumSize, true) {}
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+    : MappedFile(path, 0, false) {}
+
+MappedFile::~MappedFile() noexcept { this->close(); }
+
+} // namespace CesiumAsync
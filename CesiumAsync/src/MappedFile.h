@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace CesiumAsync {
+
+/**
+ * @brief A file that is mapped into memory for reading and, optionally,
+ * writing.
+ *
+ * Writes to the mapped memory are written back to the file by the operating
+ * system. The mapping is released when this instance is destroyed.
+ */
+class MappedFile {
+public:
+  /**
+   * @brief Opens or creates a file and maps it into memory.
+   *
+   * If the file is smaller than `minimumSize`, it is first extended with
+   * zeros.
+   *
+   * @param path The path of the file.
+   * @param minimumSize The minimum size of the file, in bytes.
+   * @throws std::runtime_error if the file cannot be opened or mapped.
+   */
+  MappedFile(const std::filesystem::path& path, uint64_t minimumSize);
+
+  /**
+   * @brief Opens an existing file and maps it into memory for reading only.
+   *
+   * The mapped memory must not be written to.
+   *
+   * @param path The path of the file.
+   * @throws std::runtime_error if the file cannot be opened or mapped.
+   */
+  explicit MappedFile(const std::filesystem::path& path);
+
+  ~MappedFile() noexcept;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief Gets the mapped contents of the file.
+   */
+  std::byte* data() noexcept { return this->_pData; }
+
+  /** @copydoc data */
+  const std::byte* data() const noexcept { return this->_pData; }
+
+  /**
+   * @brief Gets the size of the file, in bytes.
+   */
+  uint64_t size() const noexcept { return this->_size; }
+
+private:
+  MappedFile(
+      const std::filesystem::path& path,
+      uint64_t minimumSize,
+      bool writable);
+
+  void close() noexcept;
+
+  std::byte* _pData;
+  uint64_t _size;
+#ifdef _WIN32
+  void* _fileHandle;
+  void* _mappingHandle;
+#else
+  int _fileDescriptor;
+#endif
+};
+
+} // namespace CesiumAsync
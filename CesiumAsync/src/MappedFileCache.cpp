@@ -0,0 +1,800 @@
+#include "MappedFile.h"
+
+#include <CesiumAsync/CacheItem.h>
+#include <CesiumAsync/HttpHeaders.h>
+#include <CesiumAsync/MappedFileCache.h>
+#include <CesiumUtility/Tracing.h>
+
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace CesiumAsync;
+
+namespace {
+
+// Each record in a segment file starts with this header, followed by the key,
+// the serialized metadata, and then the response data. Records and response
+// data are aligned to RECORD_ALIGNMENT bytes.
+struct RecordHeader {
+  uint32_t magic;
+  uint32_t keyLength;
+  uint32_t metadataLength;
+  uint32_t reserved;
+  uint64_t dataLength;
+  int64_t expiryTime;
+};
+
+static_assert(sizeof(RecordHeader) == 32);
+
+// A record containing a cached response.
+const uint32_t ENTRY_MAGIC = 0x31455243; // "CRE1"
+
+// A record containing only a key, indicating that any earlier record with that
+// key has been removed.
+const uint32_t TOMBSTONE_MAGIC = 0x31545243; // "CRT1"
+
+const uint64_t RECORD_ALIGNMENT = 16;
+
+const std::string SEGMENT_EXTENSION = ".segment";
+
+// Segments that are less than this fraction in use are compacted by prune.
+const double MIN_SEGMENT_USAGE = 0.5;
+
+uint64_t alignRecordSize(uint64_t size) {
+  return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+}
+
+uint64_t getDataOffset(const RecordHeader& header) {
+  return alignRecordSize(
+      sizeof(RecordHeader) + header.keyLength + header.metadataLength);
+}
+
+uint64_t getRecordSize(const RecordHeader& header) {
+  return getDataOffset(header) + alignRecordSize(header.dataLength);
+}
+
+/**
+ * @brief Reads the header of the record at the given offset.
+ *
+ * @return The header, or `std::nullopt` if there is no complete, valid record
+ * at the offset.
+ */
+std::optional<RecordHeader>
+readRecordHeader(const std::byte* pSegment, uint64_t end, uint64_t offset) {
+  if (offset + sizeof(RecordHeader) > end) {
+    return std::nullopt;
+  }
+
+  RecordHeader header;
+  std::memcpy(&header, pSegment + offset, sizeof(RecordHeader));
+  if (header.magic != ENTRY_MAGIC && header.magic != TOMBSTONE_MAGIC) {
+    return std::nullopt;
+  }
+
+  // Check each length on its own first, so that a corrupt length can't make
+  // the sum wrap around.
+  const uint64_t available = end - offset;
+  if (uint64_t(header.keyLength) + header.metadataLength > available ||
+      header.dataLength > available ||
+      getRecordSize(header) > available) {
+    return std::nullopt;
+  }
+
+  return header;
+}
+
+std::string_view
+getRecordKey(const std::byte* pRecord, const RecordHeader& header) {
+  return std::string_view(
+      reinterpret_cast<const char*>(pRecord + sizeof(RecordHeader)),
+      header.keyLength);
+}
+
+/**
+ * @brief Writes a record, making sure its magic number is written last.
+ *
+ * If the process is interrupted while the record is written, the magic
+ * number is still zero and the record is ignored when the segment is loaded.
+ */
+void writeRecord(
+    std::byte* pRecord,
+    const RecordHeader& header,
+    const std::string_view& key,
+    const std::span<const std::byte>& metadata,
+    const std::span<const std::byte>& data) {
+  std::byte* pKey = pRecord + sizeof(RecordHeader);
+  std::copy(
+      reinterpret_cast<const std::byte*>(key.data()),
+      reinterpret_cast<const std::byte*>(key.data()) + key.size(),
+      pKey);
+  std::copy(metadata.begin(), metadata.end(), pKey + key.size());
+  std::copy(data.begin(), data.end(), pRecord + getDataOffset(header));
+
+  std::memcpy(
+      pRecord + sizeof(uint32_t),
+      reinterpret_cast<const std::byte*>(&header) + sizeof(uint32_t),
+      sizeof(RecordHeader) - sizeof(uint32_t));
+  std::memcpy(pRecord, &header.magic, sizeof(uint32_t));
+}
+
+void writeUint32(std::vector<std::byte>& output, uint32_t value) {
+  const size_t offset = output.size();
+  output.resize(offset + sizeof(uint32_t));
+  std::memcpy(output.data() + offset, &value, sizeof(uint32_t));
+}
+
+void writeString(std::vector<std::byte>& output, const std::string& value) {
+  writeUint32(output, uint32_t(value.size()));
+  const size_t offset = output.size();
+  output.resize(offset + value.size());
+  std::memcpy(output.data() + offset, value.data(), value.size());
+}
+
+void writeHeaders(std::vector<std::byte>& output, const HttpHeaders& headers) {
+  writeUint32(output, uint32_t(headers.size()));
+  for (const auto& [name, value] : headers) {
+    writeString(output, name);
+    writeString(output, value);
+  }
+}
+
+/**
+ * @brief Reads the metadata written by {@link serializeMetadata}.
+ */
+class MetadataReader {
+public:
+  MetadataReader(const std::span<const std::byte>& metadata)
+      : _metadata(metadata), _offset(0) {}
+
+  bool readUint32(uint32_t& value) {
+    if (this->_metadata.size() - this->_offset < sizeof(uint32_t)) {
+      return false;
+    }
+    std::memcpy(&value, this->_metadata.data() + this->_offset, sizeof(value));
+    this->_offset += sizeof(uint32_t);
+    return true;
+  }
+
+  bool readString(std::string& value) {
+    uint32_t length = 0;
+    if (!this->readUint32(length) ||
+        this->_metadata.size() - this->_offset < length) {
+      return false;
+    }
+    value.assign(
+        reinterpret_cast<const char*>(this->_metadata.data() + this->_offset),
+        length);
+    this->_offset += length;
+    return true;
+  }
+
+  bool readHeaders(HttpHeaders& headers) {
+    uint32_t count = 0;
+    if (!this->readUint32(count)) {
+      return false;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      std::string name;
+      std::string value;
+      if (!this->readString(name) || !this->readString(value)) {
+        return false;
+      }
+      headers.emplace(std::move(name), std::move(value));
+    }
+    return true;
+  }
+
+private:
+  std::span<const std::byte> _metadata;
+  size_t _offset;
+};
+
+std::vector<std::byte> serializeMetadata(
+    const std::string& url,
+    const std::string& requestMethod,
+    const HttpHeaders& requestHeaders,
+    uint16_t statusCode,
+    const HttpHeaders& responseHeaders) {
+  std::vector<std::byte> result;
+  writeUint32(result, statusCode);
+  writeString(result, url);
+  writeString(result, requestMethod);
+  writeHeaders(result, requestHeaders);
+  writeHeaders(result, responseHeaders);
+  return result;
+}
+
+uint64_t hashKey(const std::string_view& key) {
+  return uint64_t(std::hash<std::string_view>{}(key));
+}
+
+} // namespace
+
+namespace CesiumAsync {
+
+/**
+ * Locking:
+ *  - `_writeMutex` serializes everything that writes to the segment files:
+ *    storing, pruning and compacting, and clearing.
+ *  - `_indexMutex` guards the index and the list of segments. It is only held
+ *    briefly, and never while acquiring `_writeMutex`.
+ *
+ * Records are never modified after they are written, so getEntry reads them
+ * without holding either mutex.
+ */
+struct MappedFileCache::Impl {
+  /**
+   * @brief A segment file and its mapping.
+   *
+   * Each {@link CacheResponse} returned by the cache holds a reference to the
+   * segment that contains its data, so that the mapping outlives it. A segment
+   * that is no longer needed is only deleted when the last reference to it is
+   * released.
+   */
+  struct Segment {
+    Segment(
+        uint32_t segmentId,
+        const std::filesystem::path& segmentPath,
+        uint64_t minimumSize)
+        : id(segmentId),
+          path(segmentPath),
+          pFile(std::make_unique<MappedFile>(segmentPath, minimumSize)),
+          end(0),
+          liveBytes(0),
+          deleteWhenReleased(false) {}
+
+    ~Segment() noexcept {
+      if (!this->deleteWhenReleased) {
+        return;
+      }
+
+      // The file can't be deleted on all platforms while it is mapped.
+      this->pFile.reset();
+      std::error_code error;
+      std::filesystem::remove(this->path, error);
+    }
+
+    uint32_t id;
+    std::filesystem::path path;
+    std::unique_ptr<MappedFile> pFile;
+
+    // The offset just past the last record. Guarded by the write mutex.
+    uint64_t end;
+
+    // The total size of the records that are in the index. Guarded by the
+    // index mutex.
+    uint64_t liveBytes;
+
+    bool deleteWhenReleased;
+  };
+
+  struct IndexEntry {
+    uint32_t segmentId;
+    uint64_t offset;
+    uint64_t size;
+    std::time_t expiryTime;
+    // Increases on every access, so that prune can remove the least recently
+    // used entries.
+    uint64_t lastAccess;
+  };
+
+  Impl(
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const std::string& directory,
+      uint64_t maxItems,
+      uint64_t segmentSize)
+      : _pLogger(pLogger),
+        _directory(directory),
+        _maxItems(maxItems),
+        _segmentSize(segmentSize),
+        _writeMutex(),
+        _pActiveSegment(nullptr),
+        _nextSegmentId(0),
+        _indexMutex(),
+        _index(),
+        _segments(),
+        _accessCount(0) {}
+
+  void loadSegments();
+  void loadSegment(Segment& segment);
+
+  // A segment and an offset in it.
+  using Allocation = std::pair<std::shared_ptr<Segment>, uint64_t>;
+
+  std::optional<Allocation> allocateRecord(uint64_t size);
+  bool appendTombstone(const std::string_view& key);
+  void compactSegment(const std::shared_ptr<Segment>& pSegment);
+  void compact();
+
+  bool
+  recordHasKey(const IndexEntry& entry, const std::string_view& key) const;
+  void removeEntry(
+      std::unordered_map<uint64_t, IndexEntry>::iterator it,
+      std::vector<std::string>& removedKeys);
+
+  std::shared_ptr<spdlog::logger> _pLogger;
+  std::filesystem::path _directory;
+  uint64_t _maxItems;
+  uint64_t _segmentSize;
+
+  std::mutex _writeMutex;
+  std::shared_ptr<Segment> _pActiveSegment;
+  uint32_t _nextSegmentId;
+
+  std::mutex _indexMutex;
+  std::unordered_map<uint64_t, IndexEntry> _index;
+  std::map<uint32_t, std::shared_ptr<Segment>> _segments;
+  uint64_t _accessCount;
+};
+
+void MappedFileCache::Impl::loadSegments() {
+  std::filesystem::create_directories(this->_directory);
+
+  std::vector<std::pair<uint32_t, std::filesystem::path>> paths;
+  for (const std::filesystem::directory_entry& file :
+       std::filesystem::directory_iterator(this->_directory)) {
+    const std::filesystem::path& path = file.path();
+    if (!file.is_regular_file() || path.extension() != SEGMENT_EXTENSION) {
+      continue;
+    }
+
+    const std::string stem = path.stem().string();
+    if (stem.empty() || stem.size() > 9 ||
+        !std::all_of(stem.begin(), stem.end(), [](char c) {
+          return c >= '0' && c <= '9';
+        })) {
+      continue;
+    }
+
+    paths.emplace_back(uint32_t(std::stoul(stem)), path);
+  }
+
+  // Later records replace earlier ones, so the segments must be loaded in the
+  // order they were written.
+  std::sort(paths.begin(), paths.end());
+
+  for (const auto& [id, path] : paths) {
+    std::shared_ptr<Segment> pSegment =
+        std::make_shared<Segment>(id, path, uint64_t(0));
+    this->_segments.emplace(id, pSegment);
+    this->loadSegment(*pSegment);
+    this->_nextSegmentId = id + 1;
+  }
+
+  // Continue appending to the last segment if there is room in it.
+  if (!this->_segments.empty()) {
+    const std::shared_ptr<Segment>& pLast = this->_segments.rbegin()->second;
+    if (pLast->end < pLast->pFile->size()) {
+      this->_pActiveSegment = pLast;
+    }
+  }
+}
+
+void MappedFileCache::Impl::loadSegment(Segment& segment) {
+  const std::byte* pData = segment.pFile->data();
+  const uint64_t size = segment.pFile->size();
+
+  uint64_t offset = 0;
+  std::optional<RecordHeader> header;
+  while ((header = readRecordHeader(pData, size, offset))) {
+    const std::string_view key = getRecordKey(pData + offset, *header);
+    const uint64_t recordSize = getRecordSize(*header);
+    auto it = this->_index.find(hashKey(key));
+
+    if (header->magic == TOMBSTONE_MAGIC) {
+      if (it != this->_index.end() && this->recordHasKey(it->second, key)) {
+        this->_segments.at(it->second.segmentId)->liveBytes -= it->second.size;
+        this->_index.erase(it);
+      }
+    } else {
+      if (it != this->_index.end()) {
+        // Either an older record with the same key or a hash collision. In
+        // both cases the older entry is dropped.
+        this->_segments.at(it->second.segmentId)->liveBytes -= it->second.size;
+      }
+
+      this->_index.insert_or_assign(
+          hashKey(key),
+          IndexEntry{
+              segment.id,
+              offset,
+              recordSize,
+              std::time_t(header->expiryTime),
+              ++this->_accessCount});
+      segment.liveBytes += recordSize;
+    }
+
+    offset += recordSize;
+  }
+
+  segment.end = offset;
+}
+
+bool MappedFileCache::Impl::recordHasKey(
+    const IndexEntry& entry,
+    const std::string_view& key) const {
+  const Segment& segment = *this->_segments.at(entry.segmentId);
+  const std::byte* pRecord = segment.pFile->data() + entry.offset;
+  RecordHeader header;
+  std::memcpy(&header, pRecord, sizeof(RecordHeader));
+  return getRecordKey(pRecord, header) == key;
+}
+
+std::optional<MappedFileCache::Impl::Allocation>
+MappedFileCache::Impl::allocateRecord(uint64_t size) {
+  if (!this->_pActiveSegment ||
+      this->_pActiveSegment->pFile->size() - this->_pActiveSegment->end <
+          size) {
+    const uint32_t id = this->_nextSegmentId++;
+    char name[16];
+    std::snprintf(name, sizeof(name), "%08u", static_cast<unsigned int>(id));
+
+    try {
+      std::shared_ptr<Segment> pSegment = std::make_shared<Segment>(
+          id,
+          this->_directory / (name + SEGMENT_EXTENSION),
+          std::max(size, this->_segmentSize));
+
+      std::lock_guard<std::mutex> indexLock(this->_indexMutex);
+      this->_segments.emplace(id, pSegment);
+      this->_pActiveSegment = std::move(pSegment);
+    } catch (const std::exception& e) {
+      SPDLOG_LOGGER_ERROR(
+          this->_pLogger,
+          "Unable to create a cache segment file: {}",
+          e.what());
+      return std::nullopt;
+    }
+  }
+
+  const uint64_t offset = this->_pActiveSegment->end;
+  this->_pActiveSegment->end += size;
+  return std::make_pair(this->_pActiveSegment, offset);
+}
+
+bool MappedFileCache::Impl::appendTombstone(const std::string_view& key) {
+  RecordHeader header{
+      TOMBSTONE_MAGIC,
+      uint32_t(key.size()),
+      0,
+      0,
+      0,
+      0};
+
+  auto allocation = this->allocateRecord(getRecordSize(header));
+  if (!allocation) {
+    return false;
+  }
+
+  auto& [pSegment, offset] = *allocation;
+  writeRecord(pSegment->pFile->data() + offset, header, key, {}, {});
+  return true;
+}
+
+void MappedFileCache::Impl::removeEntry(
+    std::unordered_map<uint64_t, IndexEntry>::iterator it,
+    std::vector<std::string>& removedKeys) {
+  const Segment& segment = *this->_segments.at(it->second.segmentId);
+  const std::byte* pRecord = segment.pFile->data() + it->second.offset;
+  RecordHeader header;
+  std::memcpy(&header, pRecord, sizeof(RecordHeader));
+  removedKeys.emplace_back(getRecordKey(pRecord, header));
+
+  this->_segments.at(it->second.segmentId)->liveBytes -= it->second.size;
+  this->_index.erase(it);
+}
+
+void MappedFileCache::Impl::compactSegment(
+    const std::shared_ptr<Segment>& pSegment) {
+  const std::byte* pData = pSegment->pFile->data();
+
+  bool isOldestSegment = false;
+  {
+    std::lock_guard<std::mutex> indexLock(this->_indexMutex);
+    isOldestSegment = this->_segments.begin()->first == pSegment->id;
+  }
+
+  uint64_t offset = 0;
+  while (offset < pSegment->end) {
+    RecordHeader header;
+    std::memcpy(&header, pData + offset, sizeof(RecordHeader));
+    const std::string_view key = getRecordKey(pData + offset, header);
+    const uint64_t recordSize = getRecordSize(header);
+    const uint64_t hash = hashKey(key);
+
+    // A record is live if the index still refers to it. A tombstone only needs
+    // to be kept if there could be an older record with the same key in
+    // another segment, and the key hasn't been stored again since.
+    bool keep = false;
+    {
+      std::lock_guard<std::mutex> indexLock(this->_indexMutex);
+      auto it = this->_index.find(hash);
+      if (header.magic == ENTRY_MAGIC) {
+        keep = it != this->_index.end() &&
+               it->second.segmentId == pSegment->id &&
+               it->second.offset == offset;
+      } else {
+        keep = !isOldestSegment && (it == this->_index.end() ||
+                                    !this->recordHasKey(it->second, key));
+      }
+    }
+
+    if (keep) {
+      auto allocation = this->allocateRecord(recordSize);
+      if (!allocation) {
+        // Leave the segment as it is. The entries copied so far are found in
+        // their new location when the cache is loaded again, because it is
+        // later than the old one.
+        return;
+      }
+
+      auto& [pNewSegment, newOffset] = *allocation;
+      std::byte* pRecord = pNewSegment->pFile->data() + newOffset;
+      std::memcpy(
+          pRecord + sizeof(uint32_t),
+          pData + offset + sizeof(uint32_t),
+          recordSize - sizeof(uint32_t));
+      std::memcpy(pRecord, &header.magic, sizeof(uint32_t));
+
+      if (header.magic == ENTRY_MAGIC) {
+        std::lock_guard<std::mutex> indexLock(this->_indexMutex);
+        IndexEntry& entry = this->_index.at(hash);
+        entry.segmentId = pNewSegment->id;
+        entry.offset = newOffset;
+        pSegment->liveBytes -= recordSize;
+        pNewSegment->liveBytes += recordSize;
+      }
+    }
+
+    offset += recordSize;
+  }
+
+  // Responses that refer to the segment keep it alive until they are
+  // destroyed.
+  std::lock_guard<std::mutex> indexLock(this->_indexMutex);
+  pSegment->deleteWhenReleased = true;
+  this->_segments.erase(pSegment->id);
+}
+
+void MappedFileCache::Impl::compact() {
+  std::vector<std::shared_ptr<Segment>> segmentsToCompact;
+  {
+    std::lock_guard<std::mutex> indexLock(this->_indexMutex);
+    for (const auto& [id, pSegment] : this->_segments) {
+      if (pSegment != this->_pActiveSegment &&
+          (pSegment->liveBytes == 0 ||
+           double(pSegment->liveBytes) <
+               MIN_SEGMENT_USAGE * double(pSegment->end))) {
+        segmentsToCompact.emplace_back(pSegment);
+      }
+    }
+  }
+
+  for (const std::shared_ptr<Segment>& pSegment : segmentsToCompact) {
+    this->compactSegment(pSegment);
+  }
+}
+
+MappedFileCache::MappedFileCache(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::string& directory,
+    uint64_t maxItems,
+    uint64_t segmentSize)
+    : _pImpl(
+          std::make_unique<Impl>(pLogger, directory, maxItems, segmentSize)) {
+  this->_pImpl->loadSegments();
+}
+
+MappedFileCache::~MappedFileCache() noexcept = default;
+
+std::optional<CacheItem>
+MappedFileCache::getEntry(const std::string& key) const {
+  CESIUM_TRACE("MappedFileCache::getEntry");
+
+  std::shared_ptr<Impl::Segment> pSegment;
+  uint64_t offset = 0;
+  {
+    std::lock_guard<std::mutex> indexLock(this->_pImpl->_indexMutex);
+    auto it = this->_pImpl->_index.find(hashKey(key));
+    if (it == this->_pImpl->_index.end()) {
+      return std::nullopt;
+    }
+
+    it->second.lastAccess = ++this->_pImpl->_accessCount;
+    pSegment = this->_pImpl->_segments.at(it->second.segmentId);
+    offset = it->second.offset;
+  }
+
+  const std::byte* pRecord = pSegment->pFile->data() + offset;
+  RecordHeader header;
+  std::memcpy(&header, pRecord, sizeof(RecordHeader));
+  if (getRecordKey(pRecord, header) != key) {
+    // A different key with the same hash.
+    return std::nullopt;
+  }
+
+  MetadataReader reader(std::span<const std::byte>(
+      pRecord + sizeof(RecordHeader) + header.keyLength,
+      header.metadataLength));
+
+  uint32_t statusCode = 0;
+  std::string url;
+  std::string requestMethod;
+  HttpHeaders requestHeaders;
+  HttpHeaders responseHeaders;
+  if (!reader.readUint32(statusCode) || !reader.readString(url) ||
+      !reader.readString(requestMethod) ||
+      !reader.readHeaders(requestHeaders) ||
+      !reader.readHeaders(responseHeaders)) {
+    SPDLOG_LOGGER_ERROR(
+        this->_pImpl->_pLogger,
+        "Unable to read cache entry metadata.");
+    return std::nullopt;
+  }
+
+  const std::span<const std::byte> data(
+      pRecord + getDataOffset(header),
+      size_t(header.dataLength));
+
+  return CacheItem{
+      std::time_t(header.expiryTime),
+      CacheRequest{
+          std::move(requestHeaders),
+          std::move(requestMethod),
+          std::move(url)},
+      CacheResponse{
+          uint16_t(statusCode),
+          std::move(responseHeaders),
+          data,
+          std::move(pSegment)}};
+}
+
+bool MappedFileCache::storeEntry(
+    const std::string& key,
+    std::time_t expiryTime,
+    const std::string& url,
+    const std::string& requestMethod,
+    const HttpHeaders& requestHeaders,
+    uint16_t statusCode,
+    const HttpHeaders& responseHeaders,
+    const std::span<const std::byte>& responseData) {
+  CESIUM_TRACE("MappedFileCache::storeEntry");
+
+  const std::vector<std::byte> metadata = serializeMetadata(
+      url,
+      requestMethod,
+      requestHeaders,
+      statusCode,
+      responseHeaders);
+
+  const RecordHeader header{
+      ENTRY_MAGIC,
+      uint32_t(key.size()),
+      uint32_t(metadata.size()),
+      0,
+      uint64_t(responseData.size()),
+      int64_t(expiryTime)};
+  const uint64_t recordSize = getRecordSize(header);
+
+  std::lock_guard<std::mutex> writeLock(this->_pImpl->_writeMutex);
+
+  auto allocation = this->_pImpl->allocateRecord(recordSize);
+  if (!allocation) {
+    return false;
+  }
+
+  auto& [pSegment, offset] = *allocation;
+  writeRecord(
+      pSegment->pFile->data() + offset,
+      header,
+      key,
+      metadata,
+      responseData);
+
+  std::lock_guard<std::mutex> indexLock(this->_pImpl->_indexMutex);
+  const Impl::IndexEntry entry{
+      pSegment->id,
+      offset,
+      recordSize,
+      expiryTime,
+      ++this->_pImpl->_accessCount};
+  auto [it, inserted] = this->_pImpl->_index.try_emplace(hashKey(key), entry);
+  if (!inserted) {
+    this->_pImpl->_segments.at(it->second.segmentId)->liveBytes -=
+        it->second.size;
+    it->second = entry;
+  }
+  pSegment->liveBytes += recordSize;
+
+  return true;
+}
+
+bool MappedFileCache::prune() {
+  CESIUM_TRACE("MappedFileCache::prune");
+
+  std::lock_guard<std::mutex> writeLock(this->_pImpl->_writeMutex);
+
+  std::vector<std::string> removedKeys;
+  {
+    std::lock_guard<std::mutex> indexLock(this->_pImpl->_indexMutex);
+    std::unordered_map<uint64_t, Impl::IndexEntry>& index =
+        this->_pImpl->_index;
+
+    if (index.size() > this->_pImpl->_maxItems) {
+      // delete expired entries first
+      const std::time_t now = std::time(nullptr);
+      for (auto it = index.begin(); it != index.end();) {
+        auto next = std::next(it);
+        if (it->second.expiryTime < now) {
+          this->_pImpl->removeEntry(it, removedKeys);
+        }
+        it = next;
+      }
+    }
+
+    if (index.size() > this->_pImpl->_maxItems) {
+      // delete the least recently used entries if we are still over maximum
+      std::vector<std::pair<uint64_t, uint64_t>> accesses;
+      accesses.reserve(index.size());
+      for (const auto& [hash, entry] : index) {
+        accesses.emplace_back(entry.lastAccess, hash);
+      }
+
+      const size_t removeCount = index.size() - this->_pImpl->_maxItems;
+      std::nth_element(
+          accesses.begin(),
+          accesses.begin() + std::ptrdiff_t(removeCount),
+          accesses.end());
+      for (size_t i = 0; i < removeCount; ++i) {
+        this->_pImpl->removeEntry(index.find(accesses[i].second), removedKeys);
+      }
+    }
+  }
+
+  bool result = true;
+  for (const std::string& key : removedKeys) {
+    result = this->_pImpl->appendTombstone(key) && result;
+  }
+
+  this->_pImpl->compact();
+
+  return result;
+}
+
+bool MappedFileCache::clearAll() {
+  std::lock_guard<std::mutex> writeLock(this->_pImpl->_writeMutex);
+  std::lock_guard<std::mutex> indexLock(this->_pImpl->_indexMutex);
+
+  this->_pImpl->_index.clear();
+  for (auto& [id, pSegment] : this->_pImpl->_segments) {
+    pSegment->deleteWhenReleased = true;
+  }
+  this->_pImpl->_segments.clear();
+  this->_pImpl->_pActiveSegment.reset();
+
+  return true;
+}
+
+} // namespace CesiumAsync
@@ -1,7 +1,10 @@
 #include "CesiumAsync/Impl/QueuedScheduler.h"
 
+#include <CesiumAsync/ITaskProcessor.h>
+
 #include <async++.h>
 
+#include <array>
 #include <condition_variable>
 #include <cstddef>
 #include <memory>
@@ -46,6 +49,9 @@ public:
     tail = (tail + 1) & (items.size() - 1);
   }
 
+  // Get the number of tasks in the queue
+  std::size_t size() const { return (tail - head) & (items.size() - 1); }
+
   // Pop a task from the front of the queue
   async::task_run_handle pop() {
     // See if an item is available
@@ -64,17 +70,34 @@ public:
 namespace CesiumAsync::CesiumImpl {
 
 struct QueuedScheduler::Impl {
-  fifo_queue queue;
+  // One queue for each priority, highest priority first.
+  std::array<fifo_queue, size_t(TaskPriority::Low) + 1> queues;
   std::mutex mutex;
   std::condition_variable conditionVariable;
+
+  async::task_run_handle pop() {
+    for (fifo_queue& queue : this->queues) {
+      async::task_run_handle t = queue.pop();
+      if (t) {
+        return t;
+      }
+    }
+    return async::task_run_handle();
+  }
 };
 
 QueuedScheduler::QueuedScheduler() : _pImpl(std::make_unique<Impl>()) {}
 QueuedScheduler::~QueuedScheduler() = default;
 
 void QueuedScheduler::schedule(async::task_run_handle t) {
+  this->schedule(std::move(t), TaskPriority::Normal);
+}
+
+void QueuedScheduler::schedule(
+    async::task_run_handle t,
+    TaskPriority priority) {
   std::unique_lock<std::mutex> guard(this->_pImpl->mutex);
-  this->_pImpl->queue.push(std::move(t));
+  this->_pImpl->queues[size_t(priority)].push(std::move(t));
 
   // Notify listeners that there is new work.
   this->_pImpl->conditionVariable.notify_all();
@@ -89,12 +112,21 @@ bool QueuedScheduler::dispatchZeroOrOneContinuation() {
   return this->dispatchInternal(false);
 }
 
+size_t QueuedScheduler::getQueuedContinuationCount() const {
+  std::unique_lock<std::mutex> guard(this->_pImpl->mutex);
+  size_t count = 0;
+  for (const fifo_queue& queue : this->_pImpl->queues) {
+    count += queue.size();
+  }
+  return count;
+}
+
 bool QueuedScheduler::dispatchInternal(bool blockIfNoTasks) {
   async::task_run_handle t;
 
   {
     std::unique_lock<std::mutex> guard(this->_pImpl->mutex);
-    t = this->_pImpl->queue.pop();
+    t = this->_pImpl->pop();
     if (blockIfNoTasks && !t) {
       this->_pImpl->conditionVariable.wait(guard);
     }
@@ -0,0 +1,13 @@
+#include "RequestCanceledError.h"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace CesiumAsync {
+std::runtime_error createRequestCanceledError(const std::string& url) {
+  return std::runtime_error(
+      fmt::format("The request for `{}` was canceled.", url));
+}
+} // namespace CesiumAsync
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace CesiumAsync {
+/**
+ * @brief Creates the exception with which a request for the given URL is
+ * rejected when it is canceled before it completes.
+ */
+std::runtime_error createRequestCanceledError(const std::string& url);
+} // namespace CesiumAsync
@@ -13,16 +13,21 @@
 #include <spdlog/spdlog.h>
 #include <sqlite3.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <ctime>
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -73,7 +78,7 @@ const std::string GET_ENTRY_SQL =
 
 const std::string UPDATE_LAST_ACCESSED_TIME_SQL =
     "UPDATE " + CACHE_TABLE + " SET " + CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN +
-    " = strftime('%s','now') WHERE rowid =?";
+    " = ? WHERE " + CACHE_TABLE_KEY_COLUMN + "=?";
 
 // Sql commands for storing response
 const std::string STORE_RESPONSE_SQL =
@@ -103,6 +108,19 @@ const std::string DELETE_LRU_ITEMS_SQL =
 // Sql commands for clean all items
 const std::string CLEAR_ALL_SQL = "DELETE FROM " + CACHE_TABLE;
 
+// Sql commands for grouping writes into a single transaction
+const std::string BEGIN_TRANSACTION_SQL = "BEGIN";
+const std::string COMMIT_TRANSACTION_SQL = "COMMIT";
+const std::string ROLLBACK_TRANSACTION_SQL = "ROLLBACK";
+
+// How long a connection waits for a lock held by another connection before
+// giving up with SQLITE_BUSY.
+const int BUSY_TIMEOUT_MILLISECONDS = 5000;
+
+// The number of last accessed time updates that getEntry queues up before it
+// tries to write them all in one transaction.
+const size_t MAX_PENDING_ACCESSES = 64;
+
 std::string convertHeadersToString(const HttpHeaders& headers) {
   rapidjson::Document document;
   rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
@@ -141,32 +159,230 @@ std::optional<HttpHeaders> convertStringToHeaders(
   return headers;
 }
 
+/**
+ * @brief Opens a connection to the database with the given `sqlite3_open_v2`
+ * flags.
+ */
+SqliteConnectionPtr
+openConnection(const std::string& databaseName, int flags) {
+  CESIUM_SQLITE(sqlite3*) pConnection = nullptr;
+  const int status = CESIUM_SQLITE(sqlite3_open_v2)(
+      databaseName.c_str(),
+      &pConnection,
+      flags,
+      nullptr);
+
+  // Even when it fails, sqlite3_open_v2 usually allocates a connection that
+  // must be closed.
+  SqliteConnectionPtr pResult(pConnection);
+  if (status != SQLITE_OK) {
+    throw std::runtime_error(CESIUM_SQLITE(sqlite3_errstr)(status));
+  }
+
+  CESIUM_SQLITE(sqlite3_busy_timeout)(pConnection, BUSY_TIMEOUT_MILLISECONDS);
+
+  return pResult;
+}
+
+void executeSql(const SqliteConnectionPtr& pConnection, const std::string& sql) {
+  char* pError = nullptr;
+  const int status = CESIUM_SQLITE(sqlite3_exec)(
+      pConnection.get(),
+      sql.c_str(),
+      nullptr,
+      nullptr,
+      &pError);
+  if (status != SQLITE_OK) {
+    std::string errorStr =
+        pError ? pError : CESIUM_SQLITE(sqlite3_errstr)(status);
+    CESIUM_SQLITE(sqlite3_free)(pError);
+    throw std::runtime_error(errorStr);
+  }
+}
+
+/**
+ * @brief Resets a statement without parameters and runs it to completion.
+ *
+ * @return SQLITE_DONE if the statement succeeded, or an error code.
+ */
+int runStatement(const SqliteStatementPtr& pStatement) {
+  const int status = CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+  if (status != SQLITE_OK) {
+    return status;
+  }
+
+  return CESIUM_SQLITE(sqlite3_step)(pStatement.get());
+}
+
+/**
+ * @brief Reads the entry with the given key using a prepared GET_ENTRY_SQL
+ * statement.
+ *
+ * The statement is reset before returning, so that the read transaction does
+ * not stay open and prevent the write-ahead log from being checkpointed.
+ */
+std::optional<CacheItem> readEntry(
+    const SqliteStatementPtr& pStatement,
+    const std::string& key,
+    const std::shared_ptr<spdlog::logger>& pLogger) {
+  int status = CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_clear_bindings)(pStatement.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_bind_text)(
+      pStatement.get(),
+      1,
+      key.c_str(),
+      -1,
+      SQLITE_STATIC);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_step)(pStatement.get());
+  if (status == SQLITE_DONE) {
+    // Cache miss
+    CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+    return std::nullopt;
+  }
+
+  if (status != SQLITE_ROW) {
+    // Something went wrong.
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+    return std::nullopt;
+  }
+
+  // Cache hit - unpack and return it.
+  // parse cache item metadata
+  const std::time_t expiryTime =
+      CESIUM_SQLITE(sqlite3_column_int64)(pStatement.get(), 1);
+
+  // parse response cache
+  std::string serializedResponseHeaders = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStatement.get(), 2));
+  std::optional<HttpHeaders> responseHeaders =
+      convertStringToHeaders(serializedResponseHeaders, pLogger);
+  if (!responseHeaders) {
+    CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+    return std::nullopt;
+  }
+  const uint16_t statusCode = static_cast<uint16_t>(
+      CESIUM_SQLITE(sqlite3_column_int)(pStatement.get(), 3));
+
+  const std::byte* rawResponseData = reinterpret_cast<const std::byte*>(
+      CESIUM_SQLITE(sqlite3_column_blob)(pStatement.get(), 4));
+  const int responseDataSize =
+      CESIUM_SQLITE(sqlite3_column_bytes)(pStatement.get(), 4);
+  std::vector<std::byte> responseData(
+      rawResponseData,
+      rawResponseData + responseDataSize);
+
+  // parse request
+  std::string serializedRequestHeaders = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStatement.get(), 5));
+  std::optional<HttpHeaders> requestHeaders =
+      convertStringToHeaders(serializedRequestHeaders, pLogger);
+  if (!requestHeaders) {
+    CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+    return std::nullopt;
+  }
+
+  std::string requestMethod = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStatement.get(), 6));
+
+  std::string requestUrl = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStatement.get(), 7));
+
+  CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+
+  return CacheItem{
+      expiryTime,
+      CacheRequest{
+          std::move(*requestHeaders),
+          std::move(requestMethod),
+          std::move(requestUrl)},
+      CacheResponse{
+          statusCode,
+          std::move(*responseHeaders),
+          std::move(responseData)}};
+}
+
 } // namespace
 
 namespace CesiumAsync {
 
+/**
+ * The cache uses one connection for writing and a pool of connections for
+ * reading. Because the database is in WAL mode, readers never wait for the
+ * writer or for each other, so cache hits are not held up by concurrent
+ * stores or by pruning.
+ *
+ * Locking:
+ *  - Every operation holds `_connectionMutex` in shared mode. Destroying and
+ *    recreating a corrupt database holds it exclusively.
+ *  - `_writerMutex` guards the writer connection and its statements.
+ *  - `_readersMutex` guards the pool of idle readers.
+ *  - `_pendingAccessesMutex` guards the queued last accessed times.
+ *
+ * A mutex later in this list is never held while acquiring an earlier one.
+ */
 struct SqliteCache::Impl {
+  struct Reader {
+    SqliteConnectionPtr pConnection;
+    SqliteStatementPtr pGetEntryStatement;
+  };
+
   Impl(
       const std::shared_ptr<spdlog::logger>& pLogger,
       const std::string& databaseName,
       uint64_t maxItems)
       : _pLogger(pLogger),
-        _pConnection(nullptr),
         _databaseName(databaseName),
         _maxItems(maxItems),
+        _pConnection(nullptr),
         _getEntryStmtWrapper(),
         _updateLastAccessedTimeStmtWrapper(),
         _storeResponseStmtWrapper(),
         _totalItemsQueryStmtWrapper(),
         _deleteExpiredStmtWrapper(),
         _deleteLRUStmtWrapper(),
-        _clearAllStmtWrapper() {}
+        _clearAllStmtWrapper(),
+        _beginTransactionStmtWrapper(),
+        _commitTransactionStmtWrapper(),
+        _rollbackTransactionStmtWrapper(),
+        _idleReaders(),
+        _readerCount(0),
+        _maxReaders(0),
+        _pendingAccesses() {}
+
+  std::unique_ptr<Reader> acquireReader();
+  void releaseReader(std::unique_ptr<Reader>&& pReader);
+
+  void recordAccess(const std::string& key);
+  int flushPendingAccesses();
+
+  template <typename Func> int runInTransaction(Func&& func);
 
   std::shared_ptr<spdlog::logger> _pLogger;
-  SqliteConnectionPtr _pConnection;
   std::string _databaseName;
   uint64_t _maxItems;
-  mutable std::mutex _mutex;
+
+  std::shared_mutex _connectionMutex;
+
+  // The writer connection.
+  std::mutex _writerMutex;
+  SqliteConnectionPtr _pConnection;
+  // Only used when readers can't be opened, such as for in-memory databases.
   SqliteStatementPtr _getEntryStmtWrapper;
   SqliteStatementPtr _updateLastAccessedTimeStmtWrapper;
   SqliteStatementPtr _storeResponseStmtWrapper;
@@ -174,8 +390,168 @@ struct SqliteCache::Impl {
   SqliteStatementPtr _deleteExpiredStmtWrapper;
   SqliteStatementPtr _deleteLRUStmtWrapper;
   SqliteStatementPtr _clearAllStmtWrapper;
+  SqliteStatementPtr _beginTransactionStmtWrapper;
+  SqliteStatementPtr _commitTransactionStmtWrapper;
+  SqliteStatementPtr _rollbackTransactionStmtWrapper;
+
+  // The reader connections.
+  std::mutex _readersMutex;
+  std::condition_variable _readerAvailable;
+  std::vector<std::unique_ptr<Reader>> _idleReaders;
+  size_t _readerCount;
+  // Zero if reads should use the writer connection instead.
+  size_t _maxReaders;
+
+  // The last accessed times that have not been written yet. Updating them
+  // individually would make every cache hit wait for the writer.
+  std::mutex _pendingAccessesMutex;
+  std::vector<std::pair<std::string, std::time_t>> _pendingAccesses;
 };
 
+std::unique_ptr<SqliteCache::Impl::Reader>
+SqliteCache::Impl::acquireReader() {
+  std::unique_lock<std::mutex> lock(this->_readersMutex);
+  this->_readerAvailable.wait(lock, [this]() {
+    return !this->_idleReaders.empty() ||
+           this->_readerCount < this->_maxReaders;
+  });
+
+  if (!this->_idleReaders.empty()) {
+    std::unique_ptr<Reader> pReader = std::move(this->_idleReaders.back());
+    this->_idleReaders.pop_back();
+    return pReader;
+  }
+
+  // Open a new reader without holding the lock, so that other threads can
+  // use the existing ones in the meantime.
+  ++this->_readerCount;
+  lock.unlock();
+
+  try {
+    std::unique_ptr<Reader> pReader = std::make_unique<Reader>();
+    // A reader is only ever used by one thread at a time, so it doesn't need
+    // SQLite's own mutex, and it never writes.
+    pReader->pConnection = openConnection(
+        this->_databaseName,
+        SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX);
+    pReader->pGetEntryStatement =
+        SqliteHelper::prepareStatement(pReader->pConnection, GET_ENTRY_SQL);
+    return pReader;
+  } catch (const std::exception& e) {
+    SPDLOG_LOGGER_ERROR(
+        this->_pLogger,
+        "Unable to open a cache database reader: {}",
+        e.what());
+
+    lock.lock();
+    --this->_readerCount;
+    this->_readerAvailable.notify_one();
+    return nullptr;
+  }
+}
+
+void SqliteCache::Impl::releaseReader(std::unique_ptr<Reader>&& pReader) {
+  {
+    std::lock_guard<std::mutex> lock(this->_readersMutex);
+    this->_idleReaders.emplace_back(std::move(pReader));
+  }
+  this->_readerAvailable.notify_one();
+}
+
+void SqliteCache::Impl::recordAccess(const std::string& key) {
+  bool shouldFlush = false;
+  {
+    std::lock_guard<std::mutex> lock(this->_pendingAccessesMutex);
+    this->_pendingAccesses.emplace_back(key, std::time(nullptr));
+    shouldFlush = this->_pendingAccesses.size() >= MAX_PENDING_ACCESSES;
+  }
+
+  if (!shouldFlush) {
+    return;
+  }
+
+  // Don't make a cache hit wait for a store or a prune. If the writer is busy,
+  // the accesses are written along with its next write instead.
+  std::unique_lock<std::mutex> writerLock(this->_writerMutex, std::try_to_lock);
+  if (!writerLock.owns_lock()) {
+    return;
+  }
+
+  const int status =
+      this->runInTransaction([this]() { return this->flushPendingAccesses(); });
+  if (status != SQLITE_DONE) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+  }
+}
+
+int SqliteCache::Impl::flushPendingAccesses() {
+  std::vector<std::pair<std::string, std::time_t>> accesses;
+  {
+    std::lock_guard<std::mutex> lock(this->_pendingAccessesMutex);
+    std::swap(accesses, this->_pendingAccesses);
+  }
+
+  for (const auto& [key, accessTime] : accesses) {
+    int status = CESIUM_SQLITE(sqlite3_reset)(
+        this->_updateLastAccessedTimeStmtWrapper.get());
+    if (status != SQLITE_OK) {
+      return status;
+    }
+
+    status = CESIUM_SQLITE(sqlite3_clear_bindings)(
+        this->_updateLastAccessedTimeStmtWrapper.get());
+    if (status != SQLITE_OK) {
+      return status;
+    }
+
+    status = CESIUM_SQLITE(sqlite3_bind_int64)(
+        this->_updateLastAccessedTimeStmtWrapper.get(),
+        1,
+        static_cast<int64_t>(accessTime));
+    if (status != SQLITE_OK) {
+      return status;
+    }
+
+    status = CESIUM_SQLITE(sqlite3_bind_text)(
+        this->_updateLastAccessedTimeStmtWrapper.get(),
+        2,
+        key.c_str(),
+        -1,
+        SQLITE_STATIC);
+    if (status != SQLITE_OK) {
+      return status;
+    }
+
+    status = CESIUM_SQLITE(sqlite3_step)(
+        this->_updateLastAccessedTimeStmtWrapper.get());
+    if (status != SQLITE_DONE) {
+      return status;
+    }
+  }
+
+  return SQLITE_DONE;
+}
+
+template <typename Func> int SqliteCache::Impl::runInTransaction(Func&& func) {
+  int status = runStatement(this->_beginTransactionStmtWrapper);
+  if (status != SQLITE_DONE) {
+    return status;
+  }
+
+  status = func();
+  if (status != SQLITE_DONE) {
+    runStatement(this->_rollbackTransactionStmtWrapper);
+    return status;
+  }
+
+  status = runStatement(this->_commitTransactionStmtWrapper);
+  if (status != SQLITE_DONE) {
+    runStatement(this->_rollbackTransactionStmtWrapper);
+  }
+
+  return status;
+}
+
 SqliteCache::SqliteCache(
     const std::shared_ptr<spdlog::logger>& pLogger,
     const std::string& databaseName,
@@ -185,73 +561,22 @@ SqliteCache::SqliteCache(
 }
 
 void SqliteCache::createConnection() const {
-  CESIUM_SQLITE(sqlite3*) pConnection;
-  int status = CESIUM_SQLITE(
-      sqlite3_open)(this->_pImpl->_databaseName.c_str(), &pConnection);
-  if (status != SQLITE_OK) {
-    throw std::runtime_error(CESIUM_SQLITE(sqlite3_errstr)(status));
-  }
-
-  this->_pImpl->_pConnection =
-      std::unique_ptr<CESIUM_SQLITE(sqlite3), DeleteSqliteConnection>(
-          pConnection);
+  this->_pImpl->_pConnection = openConnection(
+      this->_pImpl->_databaseName,
+      SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
 
   // create cache tables if not exist. Key -> Cache table: one-to-many
   // relationship
-  char* createTableError = nullptr;
-  status = CESIUM_SQLITE(sqlite3_exec)(
-      this->_pImpl->_pConnection.get(),
-      CREATE_CACHE_TABLE_SQL.c_str(),
-      nullptr,
-      nullptr,
-      &createTableError);
-  if (status != SQLITE_OK) {
-    std::string errorStr(createTableError);
-    CESIUM_SQLITE(sqlite3_free)(createTableError);
-    throw std::runtime_error(errorStr);
-  }
+  executeSql(this->_pImpl->_pConnection, CREATE_CACHE_TABLE_SQL);
 
   // turn on WAL mode
-  char* walError = nullptr;
-  status = CESIUM_SQLITE(sqlite3_exec)(
-      this->_pImpl->_pConnection.get(),
-      PRAGMA_WAL_SQL.c_str(),
-      nullptr,
-      nullptr,
-      &walError);
-  if (status != SQLITE_OK) {
-    std::string errorStr(walError);
-    CESIUM_SQLITE(sqlite3_free)(walError);
-    throw std::runtime_error(errorStr);
-  }
+  executeSql(this->_pImpl->_pConnection, PRAGMA_WAL_SQL);
 
   // turn off synchronous mode
-  char* syncError = nullptr;
-  status = CESIUM_SQLITE(sqlite3_exec)(
-      this->_pImpl->_pConnection.get(),
-      PRAGMA_SYNC_SQL.c_str(),
-      nullptr,
-      nullptr,
-      &syncError);
-  if (status != SQLITE_OK) {
-    std::string errorStr(syncError);
-    CESIUM_SQLITE(sqlite3_free)(syncError);
-    throw std::runtime_error(errorStr);
-  }
+  executeSql(this->_pImpl->_pConnection, PRAGMA_SYNC_SQL);
 
   // increase page size
-  char* pageSizeError = nullptr;
-  status = CESIUM_SQLITE(sqlite3_exec)(
-      this->_pImpl->_pConnection.get(),
-      PRAGMA_PAGE_SIZE_SQL.c_str(),
-      nullptr,
-      nullptr,
-      &pageSizeError);
-  if (status != SQLITE_OK) {
-    std::string errorStr(pageSizeError);
-    CESIUM_SQLITE(sqlite3_free)(pageSizeError);
-    throw std::runtime_error(errorStr);
-  }
+  executeSql(this->_pImpl->_pConnection, PRAGMA_PAGE_SIZE_SQL);
 
   // get entry based on key
   this->_pImpl->_getEntryStmtWrapper =
@@ -286,155 +611,68 @@ void SqliteCache::createConnection() const {
   // clear all items
   this->_pImpl->_clearAllStmtWrapper =
       SqliteHelper::prepareStatement(this->_pImpl->_pConnection, CLEAR_ALL_SQL);
-}
 
-SqliteCache::~SqliteCache() = default;
-
-std::optional<CacheItem> SqliteCache::getEntry(const std::string& key) const {
-  CESIUM_TRACE("SqliteCache::getEntry");
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
-
-  // get entry based on key
-  int status =
-      CESIUM_SQLITE(sqlite3_reset)(this->_pImpl->_getEntryStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
-  }
-
-  status = CESIUM_SQLITE(sqlite3_clear_bindings)(
-      this->_pImpl->_getEntryStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
-  }
-
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_getEntryStmtWrapper.get(),
-      1,
-      key.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
-  }
-
-  status =
-      CESIUM_SQLITE(sqlite3_step)(this->_pImpl->_getEntryStmtWrapper.get());
-  if (status == SQLITE_DONE) {
-    // Cache miss
-    return std::nullopt;
-  }
-
-  if (status != SQLITE_ROW) {
-    // Something went wrong.
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
+  // group writes into transactions
+  this->_pImpl->_beginTransactionStmtWrapper = SqliteHelper::prepareStatement(
+      this->_pImpl->_pConnection,
+      BEGIN_TRANSACTION_SQL);
+  this->_pImpl->_commitTransactionStmtWrapper = SqliteHelper::prepareStatement(
+      this->_pImpl->_pConnection,
+      COMMIT_TRANSACTION_SQL);
+  this->_pImpl->_rollbackTransactionStmtWrapper =
+      SqliteHelper::prepareStatement(
+          this->_pImpl->_pConnection,
+          ROLLBACK_TRANSACTION_SQL);
+
+  // An in-memory or temporary database has no file name, and each connection
+  // to it would see a different database. Read with the writer instead.
+  const char* filename = CESIUM_SQLITE(
+      sqlite3_db_filename)(this->_pImpl->_pConnection.get(), "main");
+  if (filename == nullptr || filename[0] == '\0') {
+    this->_pImpl->_maxReaders = 0;
+  } else {
+    this->_pImpl->_maxReaders =
+        std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
   }
+}
 
-  // Cache hit - unpack and return it.
-  const int64_t itemIndex = CESIUM_SQLITE(
-      sqlite3_column_int64)(this->_pImpl->_getEntryStmtWrapper.get(), 0);
-
-  // parse cache item metadata
-  const std::time_t expiryTime = CESIUM_SQLITE(
-      sqlite3_column_int64)(this->_pImpl->_getEntryStmtWrapper.get(), 1);
-
-  // parse response cache
-  std::string serializedResponseHeaders =
-      reinterpret_cast<const char*>(CESIUM_SQLITE(
-          sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 2));
-  std::optional<HttpHeaders> responseHeaders =
-      convertStringToHeaders(serializedResponseHeaders, this->_pImpl->_pLogger);
-  if (!responseHeaders) {
-    return std::nullopt;
+SqliteCache::~SqliteCache() {
+  // Write any last accessed times that are still queued.
+  std::lock_guard<std::mutex> writerLock(this->_pImpl->_writerMutex);
+  if (this->_pImpl->_pConnection) {
+    this->_pImpl->runInTransaction(
+        [this]() { return this->_pImpl->flushPendingAccesses(); });
   }
-  const uint16_t statusCode = static_cast<uint16_t>(CESIUM_SQLITE(
-      sqlite3_column_int)(this->_pImpl->_getEntryStmtWrapper.get(), 3));
+}
 
-  const std::byte* rawResponseData =
-      reinterpret_cast<const std::byte*>(CESIUM_SQLITE(
-          sqlite3_column_blob)(this->_pImpl->_getEntryStmtWrapper.get(), 4));
-  const int responseDataSize = CESIUM_SQLITE(
-      sqlite3_column_bytes)(this->_pImpl->_getEntryStmtWrapper.get(), 4);
-  std::vector<std::byte> responseData(
-      rawResponseData,
-      rawResponseData + responseDataSize);
+std::optional<CacheItem> SqliteCache::getEntry(const std::string& key) const {
+  CESIUM_TRACE("SqliteCache::getEntry");
+  std::shared_lock<std::shared_mutex> connectionLock(
+      this->_pImpl->_connectionMutex);
+
+  std::optional<CacheItem> result;
+  if (this->_pImpl->_maxReaders == 0) {
+    std::lock_guard<std::mutex> writerLock(this->_pImpl->_writerMutex);
+    result = readEntry(
+        this->_pImpl->_getEntryStmtWrapper,
+        key,
+        this->_pImpl->_pLogger);
+  } else {
+    std::unique_ptr<Impl::Reader> pReader = this->_pImpl->acquireReader();
+    if (!pReader) {
+      return std::nullopt;
+    }
 
-  // parse request
-  std::string serializedRequestHeaders =
-      reinterpret_cast<const char*>(CESIUM_SQLITE(
-          sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 5));
-  std::optional<HttpHeaders> requestHeaders =
-      convertStringToHeaders(serializedRequestHeaders, this->_pImpl->_pLogger);
-  if (!requestHeaders) {
-    return std::nullopt;
+    result = readEntry(pReader->pGetEntryStatement, key, this->_pImpl->_pLogger);
+    this->_pImpl->releaseReader(std::move(pReader));
   }
 
-  std::string requestMethod = reinterpret_cast<const char*>(CESIUM_SQLITE(
-      sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 6));
-
-  std::string requestUrl = reinterpret_cast<const char*>(CESIUM_SQLITE(
-      sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 7));
-
   // update the last accessed time
-  int updateStatus = CESIUM_SQLITE(sqlite3_reset)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get());
-  if (updateStatus != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
+  if (result) {
+    this->_pImpl->recordAccess(key);
   }
 
-  updateStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get());
-  if (updateStatus != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
-  }
-
-  updateStatus = CESIUM_SQLITE(sqlite3_bind_int64)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get(),
-      1,
-      itemIndex);
-  if (updateStatus != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
-  }
-
-  updateStatus = CESIUM_SQLITE(sqlite3_step)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get());
-  if (updateStatus != SQLITE_DONE) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
-  }
-
-  return CacheItem{
-      expiryTime,
-      CacheRequest{
-          std::move(*requestHeaders),
-          std::move(requestMethod),
-          std::move(requestUrl)},
-      CacheResponse{
-          statusCode,
-          std::move(*responseHeaders),
-          std::move(responseData)}};
+  return result;
 }
 
 bool SqliteCache::storeEntry(
@@ -447,149 +685,132 @@ bool SqliteCache::storeEntry(
     const HttpHeaders& responseHeaders,
     const std::span<const std::byte>& responseData) {
   CESIUM_TRACE("SqliteCache::storeEntry");
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
 
-  // cache the request with the key
-  int status = CESIUM_SQLITE(sqlite3_reset)(
-      this->_pImpl->_storeResponseStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+  const std::string responseHeaderString =
+      convertHeadersToString(responseHeaders);
+  const std::string requestHeaderString =
+      convertHeadersToString(requestHeaders);
 
-  status = CESIUM_SQLITE(sqlite3_clear_bindings)(
-      this->_pImpl->_storeResponseStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+  int status = SQLITE_DONE;
+  {
+    std::shared_lock<std::shared_mutex> connectionLock(
+        this->_pImpl->_connectionMutex);
+    std::lock_guard<std::mutex> writerLock(this->_pImpl->_writerMutex);
+
+    // Write the queued last accessed times in the same transaction.
+    status = this->_pImpl->runInTransaction([&]() {
+      int result = this->_pImpl->flushPendingAccesses();
+      if (result != SQLITE_DONE) {
+        return result;
+      }
 
-  status = CESIUM_SQLITE(sqlite3_bind_int64)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      1,
-      static_cast<int64_t>(expiryTime));
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      // cache the request with the key
+      SqliteStatementPtr& pStatement = this->_pImpl->_storeResponseStmtWrapper;
+      result = CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  status = CESIUM_SQLITE(sqlite3_bind_int64)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      2,
-      static_cast<int64_t>(std::time(nullptr)));
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      result = CESIUM_SQLITE(sqlite3_clear_bindings)(pStatement.get());
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  std::string responseHeaderString = convertHeadersToString(responseHeaders);
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      3,
-      responseHeaderString.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      result = CESIUM_SQLITE(sqlite3_bind_int64)(
+          pStatement.get(),
+          1,
+          static_cast<int64_t>(expiryTime));
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  status = CESIUM_SQLITE(sqlite3_bind_int)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      4,
-      static_cast<int>(statusCode));
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      result = CESIUM_SQLITE(sqlite3_bind_int64)(
+          pStatement.get(),
+          2,
+          static_cast<int64_t>(std::time(nullptr)));
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  status = CESIUM_SQLITE(sqlite3_bind_blob)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      5,
-      responseData.data(),
-      static_cast<int>(responseData.size()),
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      result = CESIUM_SQLITE(sqlite3_bind_text)(
+          pStatement.get(),
+          3,
+          responseHeaderString.c_str(),
+          -1,
+          SQLITE_STATIC);
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  std::string requestHeaderString = convertHeadersToString(requestHeaders);
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      6,
-      requestHeaderString.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      result = CESIUM_SQLITE(sqlite3_bind_int)(
+          pStatement.get(),
+          4,
+          static_cast<int>(statusCode));
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      7,
-      requestMethod.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
+      result = CESIUM_SQLITE(sqlite3_bind_blob)(
+          pStatement.get(),
+          5,
+          responseData.data(),
+          static_cast<int>(responseData.size()),
+          SQLITE_STATIC);
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      8,
-      url.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+      result = CESIUM_SQLITE(sqlite3_bind_text)(
+          pStatement.get(),
+          6,
+          requestHeaderString.c_str(),
+          -1,
+          SQLITE_STATIC);
+      if (result != SQLITE_OK) {
+        return result;
+      }
+
+      result = CESIUM_SQLITE(sqlite3_bind_text)(
+          pStatement.get(),
+          7,
+          requestMethod.c_str(),
+          -1,
+          SQLITE_STATIC);
+      if (result != SQLITE_OK) {
+        return result;
+      }
+
+      result = CESIUM_SQLITE(sqlite3_bind_text)(
+          pStatement.get(),
+          8,
+          url.c_str(),
+          -1,
+          SQLITE_STATIC);
+      if (result != SQLITE_OK) {
+        return result;
+      }
+
+      result = CESIUM_SQLITE(sqlite3_bind_text)(
+          pStatement.get(),
+          9,
+          key.c_str(),
+          -1,
+          SQLITE_STATIC);
+      if (result != SQLITE_OK) {
+        return result;
+      }
+
+      return CESIUM_SQLITE(sqlite3_step)(pStatement.get());
+    });
   }
 
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
-      9,
-      key.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
+  if (status != SQLITE_DONE) {
     SPDLOG_LOGGER_ERROR(
         this->_pImpl->_pLogger,
         CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
-  }
-
-  status = CESIUM_SQLITE(sqlite3_step)(
-      this->_pImpl->_storeResponseStmtWrapper.get());
-  if (status != SQLITE_DONE) {
     if (status == SQLITE_CORRUPT) {
       destroyDatabase();
     }
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
     return false;
   }
 
@@ -598,167 +819,117 @@ bool SqliteCache::storeEntry(
 
 bool SqliteCache::prune() {
   CESIUM_TRACE("SqliteCache::prune");
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
 
-  int64_t totalItems = 0;
-
-  // query total size of response's data
+  int status = SQLITE_DONE;
   {
-    int totalItemsQueryStatus = CESIUM_SQLITE(sqlite3_reset)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get());
-    if (totalItemsQueryStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(totalItemsQueryStatus));
-      return false;
-    }
-
-    totalItemsQueryStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get());
-    if (totalItemsQueryStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(totalItemsQueryStatus));
-      return false;
-    }
+    std::shared_lock<std::shared_mutex> connectionLock(
+        this->_pImpl->_connectionMutex);
+    std::lock_guard<std::mutex> writerLock(this->_pImpl->_writerMutex);
+
+    // Write the queued last accessed times first, so that the least recently
+    // used items are pruned.
+    status = this->_pImpl->runInTransaction([this]() {
+      int result = this->_pImpl->flushPendingAccesses();
+      if (result != SQLITE_DONE) {
+        return result;
+      }
 
-    totalItemsQueryStatus = CESIUM_SQLITE(sqlite3_step)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get());
+      int64_t totalItems = 0;
+      const int64_t maxItems = static_cast<int64_t>(this->_pImpl->_maxItems);
+
+      // query total size of response's data
+      {
+        SqliteStatementPtr& pStatement =
+            this->_pImpl->_totalItemsQueryStmtWrapper;
+        result = runStatement(pStatement);
+        if (result == SQLITE_DONE) {
+          return SQLITE_DONE;
+        }
+
+        if (result != SQLITE_ROW) {
+          return result;
+        }
+
+        // prune the rows if over maximum
+        totalItems = CESIUM_SQLITE(sqlite3_column_int64)(pStatement.get(), 0);
+        CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+        if (totalItems > 0 && totalItems <= maxItems) {
+          return SQLITE_DONE;
+        }
+      }
 
-    if (totalItemsQueryStatus == SQLITE_DONE) {
-      return true;
-    }
+      // delete expired rows first
+      result = runStatement(this->_pImpl->_deleteExpiredStmtWrapper);
+      if (result != SQLITE_DONE) {
+        return result;
+      }
 
-    if (totalItemsQueryStatus != SQLITE_ROW) {
-      if (totalItemsQueryStatus == SQLITE_CORRUPT) {
-        destroyDatabase();
+      // check if we should delete more
+      const int deletedRows =
+          CESIUM_SQLITE(sqlite3_changes)(this->_pImpl->_pConnection.get());
+      if (totalItems - deletedRows < maxItems) {
+        return SQLITE_DONE;
       }
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(totalItemsQueryStatus));
-      return false;
-    }
 
-    // prune the rows if over maximum
-    totalItems = CESIUM_SQLITE(sqlite3_column_int64)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get(),
-        0);
-    if (totalItems > 0 &&
-        totalItems <= static_cast<int64_t>(this->_pImpl->_maxItems)) {
-      return true;
-    }
-  }
+      totalItems -= deletedRows;
 
-  // delete expired rows first
-  {
-    int deleteExpiredStatus = CESIUM_SQLITE(sqlite3_reset)(
-        this->_pImpl->_deleteExpiredStmtWrapper.get());
-    if (deleteExpiredStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteExpiredStatus));
-      return false;
-    }
+      // delete rows LRU if we are still over maximum
+      SqliteStatementPtr& pStatement = this->_pImpl->_deleteLRUStmtWrapper;
+      result = CESIUM_SQLITE(sqlite3_reset)(pStatement.get());
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-    deleteExpiredStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-        this->_pImpl->_deleteExpiredStmtWrapper.get());
-    if (deleteExpiredStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteExpiredStatus));
-      return false;
-    }
+      result = CESIUM_SQLITE(sqlite3_clear_bindings)(pStatement.get());
+      if (result != SQLITE_OK) {
+        return result;
+      }
 
-    deleteExpiredStatus = CESIUM_SQLITE(sqlite3_step)(
-        this->_pImpl->_deleteExpiredStmtWrapper.get());
-    if (deleteExpiredStatus != SQLITE_DONE) {
-      if (deleteExpiredStatus == SQLITE_CORRUPT) {
-        destroyDatabase();
+      result = CESIUM_SQLITE(
+          sqlite3_bind_int64)(pStatement.get(), 1, totalItems - maxItems);
+      if (result != SQLITE_OK) {
+        return result;
       }
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteExpiredStatus));
-      return false;
-    }
-  }
 
-  // check if we should delete more
-  const int deletedRows =
-      CESIUM_SQLITE(sqlite3_changes)(this->_pImpl->_pConnection.get());
-  if (totalItems - deletedRows < static_cast<int>(this->_pImpl->_maxItems)) {
-    return true;
+      return CESIUM_SQLITE(sqlite3_step)(pStatement.get());
+    });
   }
 
-  totalItems -= deletedRows;
-
-  // delete rows LRU if we are still over maximum
-  {
-    int deleteLLRUStatus =
-        CESIUM_SQLITE(sqlite3_reset)(this->_pImpl->_deleteLRUStmtWrapper.get());
-    if (deleteLLRUStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
-    }
-
-    deleteLLRUStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-        this->_pImpl->_deleteLRUStmtWrapper.get());
-    if (deleteLLRUStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
-    }
-
-    deleteLLRUStatus = CESIUM_SQLITE(sqlite3_bind_int64)(
-        this->_pImpl->_deleteLRUStmtWrapper.get(),
-        1,
-        totalItems - static_cast<int64_t>(this->_pImpl->_maxItems));
-    if (deleteLLRUStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
-    }
-
-    deleteLLRUStatus =
-        CESIUM_SQLITE(sqlite3_step)(this->_pImpl->_deleteLRUStmtWrapper.get());
-    if (deleteLLRUStatus != SQLITE_DONE) {
-      if (deleteLLRUStatus == SQLITE_CORRUPT) {
-        destroyDatabase();
-      }
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
+  if (status != SQLITE_DONE) {
+    SPDLOG_LOGGER_ERROR(
+        this->_pImpl->_pLogger,
+        CESIUM_SQLITE(sqlite3_errstr)(status));
+    if (status == SQLITE_CORRUPT) {
+      destroyDatabase();
     }
+    return false;
   }
 
   return true;
 }
 
 bool SqliteCache::clearAll() {
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
+  int status = SQLITE_DONE;
+  {
+    std::shared_lock<std::shared_mutex> connectionLock(
+        this->_pImpl->_connectionMutex);
+    std::lock_guard<std::mutex> writerLock(this->_pImpl->_writerMutex);
 
-  int status =
-      CESIUM_SQLITE(sqlite3_reset)(this->_pImpl->_clearAllStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    {
+      std::lock_guard<std::mutex> lock(this->_pImpl->_pendingAccessesMutex);
+      this->_pImpl->_pendingAccesses.clear();
+    }
+
+    status = runStatement(this->_pImpl->_clearAllStmtWrapper);
   }
 
-  status =
-      CESIUM_SQLITE(sqlite3_step)(this->_pImpl->_clearAllStmtWrapper.get());
   if (status != SQLITE_DONE) {
-    if (status == SQLITE_CORRUPT) {
-      destroyDatabase();
-    }
     SPDLOG_LOGGER_ERROR(
         this->_pImpl->_pLogger,
         CESIUM_SQLITE(sqlite3_errstr)(status));
+    if (status == SQLITE_CORRUPT) {
+      destroyDatabase();
+    }
     return false;
   }
 
@@ -766,16 +937,41 @@ bool SqliteCache::clearAll() {
 }
 
 void SqliteCache::destroyDatabase() {
-  std::shared_ptr<spdlog::logger> pLogger = _pImpl->_pLogger;
-  std::string databaseName = _pImpl->_databaseName;
-  uint64_t maxItems = _pImpl->_maxItems;
-  _pImpl.reset();
-  _pImpl = std::make_unique<Impl>(pLogger, databaseName, maxItems);
-  if (std::remove(_pImpl->_databaseName.c_str()) != 0) {
+  // Wait for every other operation to finish.
+  std::unique_lock<std::shared_mutex> connectionLock(
+      this->_pImpl->_connectionMutex);
+
+  // Close every connection before deleting the file. No reader can be in use
+  // while the lock is held exclusively.
+  {
+    std::lock_guard<std::mutex> lock(this->_pImpl->_readersMutex);
+    this->_pImpl->_idleReaders.clear();
+    this->_pImpl->_readerCount = 0;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->_pImpl->_pendingAccessesMutex);
+    this->_pImpl->_pendingAccesses.clear();
+  }
+
+  this->_pImpl->_getEntryStmtWrapper.reset();
+  this->_pImpl->_updateLastAccessedTimeStmtWrapper.reset();
+  this->_pImpl->_storeResponseStmtWrapper.reset();
+  this->_pImpl->_totalItemsQueryStmtWrapper.reset();
+  this->_pImpl->_deleteExpiredStmtWrapper.reset();
+  this->_pImpl->_deleteLRUStmtWrapper.reset();
+  this->_pImpl->_clearAllStmtWrapper.reset();
+  this->_pImpl->_beginTransactionStmtWrapper.reset();
+  this->_pImpl->_commitTransactionStmtWrapper.reset();
+  this->_pImpl->_rollbackTransactionStmtWrapper.reset();
+  this->_pImpl->_pConnection.reset();
+
+  if (std::remove(this->_pImpl->_databaseName.c_str()) != 0) {
     SPDLOG_LOGGER_ERROR(
         this->_pImpl->_pLogger,
         "Unable to delete database file.");
   }
+
   createConnection();
 }
 
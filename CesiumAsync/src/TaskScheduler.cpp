@@ -14,6 +14,12 @@ TaskScheduler::TaskScheduler(
     : _pTaskProcessor(pTaskProcessor) {}
 
 void TaskScheduler::schedule(async::task_run_handle t) {
+  this->schedule(std::move(t), CesiumAsync::TaskPriority::Normal);
+}
+
+void TaskScheduler::schedule(
+    async::task_run_handle t,
+    CesiumAsync::TaskPriority priority) {
   // std::function must be copyable, so we can't put a move-only
   // task_run_handle in the capture list of a lambda we want to use with it.
   // So, we wrap it with a copyable type (shared_ptr).
@@ -27,8 +33,16 @@ void TaskScheduler::schedule(async::task_run_handle t) {
   std::shared_ptr<Receiver> pReceiver = std::make_shared<Receiver>();
   pReceiver->taskHandle = std::move(t);
 
-  this->_pTaskProcessor->startTask([this, pReceiver]() mutable {
+  auto task = [this, pReceiver]() mutable {
     auto scope = this->immediate.scope();
     pReceiver->taskHandle.run();
-  });
+  };
+
+  // Tasks without a priority are started the way they always have been, so
+  // task processors that don't support priorities behave exactly as before.
+  if (priority == CesiumAsync::TaskPriority::Normal) {
+    this->_pTaskProcessor->startTask(std::move(task));
+  } else {
+    this->_pTaskProcessor->startPrioritizedTask(std::move(task), priority);
+  }
 }
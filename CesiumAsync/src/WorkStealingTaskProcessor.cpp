@@ -0,0 +1,202 @@
+#include <CesiumAsync/ITaskProcessor.h>
+#include <CesiumAsync/WorkStealingTaskProcessor.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace CesiumAsync {
+
+namespace {
+
+constexpr size_t PriorityCount = size_t(TaskPriority::Low) + 1;
+
+using Task = std::function<void()>;
+
+} // namespace
+
+struct WorkStealingTaskProcessor::Impl {
+  // One queue of tasks for each priority, highest priority first.
+  struct TaskQueues {
+    std::mutex mutex;
+    std::array<std::deque<Task>, PriorityCount> queues;
+  };
+
+  explicit Impl(size_t numberOfThreads) : _workers(numberOfThreads) {
+    for (std::unique_ptr<TaskQueues>& pWorker : this->_workers) {
+      pWorker = std::make_unique<TaskQueues>();
+    }
+  }
+
+  // The processor and queues of the current thread, if it is one of the
+  // threads of a WorkStealingTaskProcessor.
+  struct CurrentThread {
+    Impl* pImpl = nullptr;
+    TaskQueues* pQueues = nullptr;
+  };
+
+  static CurrentThread& getCurrentThread() noexcept {
+    // A static local rather than a static field, for the same reason as in
+    // ImmediateScheduler.
+    static thread_local CurrentThread currentThread;
+    return currentThread;
+  }
+
+  void start(Task&& task, TaskPriority priority) {
+    // Count the task before it can be found, so that a thread that takes it
+    // never makes the count negative.
+    {
+      std::lock_guard<std::mutex> lock(this->_sleepMutex);
+      ++this->_waitingTasks;
+    }
+
+    const CurrentThread& currentThread = getCurrentThread();
+    TaskQueues& queues = currentThread.pImpl == this ? *currentThread.pQueues
+                                                     : this->_shared;
+    {
+      std::lock_guard<std::mutex> lock(queues.mutex);
+      queues.queues[size_t(priority)].emplace_back(std::move(task));
+    }
+
+    this->_wakeUp.notify_one();
+  }
+
+  bool takeTask(TaskQueues& own, Task& task) {
+    for (size_t priority = 0; priority < PriorityCount; ++priority) {
+      // The newest task of this thread's own, then the oldest shared task,
+      // then the oldest task of another thread.
+      if (popBack(own, priority, task) ||
+          popFront(this->_shared, priority, task)) {
+        return true;
+      }
+
+      for (const std::unique_ptr<TaskQueues>& pVictim : this->_workers) {
+        if (pVictim.get() != &own && popFront(*pVictim, priority, task)) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  void run(TaskQueues& own) {
+    CurrentThread& currentThread = getCurrentThread();
+    currentThread.pImpl = this;
+    currentThread.pQueues = &own;
+
+    Task task;
+    while (true) {
+      if (this->takeTask(own, task)) {
+        --this->_waitingTasks;
+        task();
+        task = nullptr;
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(this->_sleepMutex);
+      this->_wakeUp.wait(lock, [this]() {
+        return this->_stopping || this->_waitingTasks > 0;
+      });
+      if (this->_stopping && this->_waitingTasks == 0) {
+        break;
+      }
+    }
+
+    currentThread = CurrentThread();
+  }
+
+  static bool popBack(TaskQueues& queues, size_t priority, Task& task) {
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    std::deque<Task>& queue = queues.queues[priority];
+    if (queue.empty()) {
+      return false;
+    }
+    task = std::move(queue.back());
+    queue.pop_back();
+    return true;
+  }
+
+  static bool popFront(TaskQueues& queues, size_t priority, Task& task) {
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    std::deque<Task>& queue = queues.queues[priority];
+    if (queue.empty()) {
+      return false;
+    }
+    task = std::move(queue.front());
+    queue.pop_front();
+    return true;
+  }
+
+  std::vector<std::unique_ptr<TaskQueues>> _workers;
+  TaskQueues _shared;
+
+  std::mutex _sleepMutex;
+  std::condition_variable _wakeUp;
+  std::atomic<int64_t> _waitingTasks = 0;
+  bool _stopping = false;
+
+  std::vector<std::thread> _threads;
+};
+
+WorkStealingTaskProcessor::WorkStealingTaskProcessor(int32_t numberOfThreads) {
+  if (numberOfThreads <= 0) {
+    numberOfThreads =
+        std::max(int32_t(std::thread::hardware_concurrency()) - 1, 1);
+  }
+
+  this->_pImpl = std::make_shared<Impl>(size_t(numberOfThreads));
+  this->_pImpl->_threads.reserve(size_t(numberOfThreads));
+  for (const std::unique_ptr<Impl::TaskQueues>& pWorker :
+       this->_pImpl->_workers) {
+    this->_pImpl->_threads.emplace_back(
+        [pImpl = this->_pImpl, pQueues = pWorker.get()]() {
+          pImpl->run(*pQueues);
+        });
+  }
+}
+
+WorkStealingTaskProcessor::~WorkStealingTaskProcessor() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(this->_pImpl->_sleepMutex);
+    this->_pImpl->_stopping = true;
+  }
+  this->_pImpl->_wakeUp.notify_all();
+
+  for (std::thread& thread : this->_pImpl->_threads) {
+    // A thread can't wait for itself, which happens when one of this
+    // processor's own tasks releases the last reference to it. That thread
+    // keeps the Impl alive until it has run the remaining tasks.
+    if (thread.get_id() == std::this_thread::get_id()) {
+      thread.detach();
+    } else {
+      thread.join();
+    }
+  }
+}
+
+void WorkStealingTaskProcessor::startTask(std::function<void()> f) {
+  this->_pImpl->start(std::move(f), TaskPriority::Normal);
+}
+
+void WorkStealingTaskProcessor::startPrioritizedTask(
+    std::function<void()> f,
+    TaskPriority priority) {
+  this->_pImpl->start(std::move(f), priority);
+}
+
+int32_t WorkStealingTaskProcessor::getNumberOfThreads() const noexcept {
+  return int32_t(this->_pImpl->_threads.size());
+}
+
+} // namespace CesiumAsync
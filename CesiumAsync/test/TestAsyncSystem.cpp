@@ -1,4 +1,5 @@
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/ITaskProcessor.h>
 #include <CesiumAsync/Promise.h>
 #include <CesiumAsync/SharedFuture.h>
 #include <CesiumAsync/ThreadPool.h>
@@ -6,6 +7,7 @@
 #include <doctest/doctest.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <exception>
 #include <functional>
@@ -24,10 +26,20 @@ class MockTaskProcessor : public ITaskProcessor {
 public:
   std::atomic<int32_t> tasksStarted = 0;
 
+  std::atomic<int32_t> highPriorityTasksStarted = 0;
+
   virtual void startTask(std::function<void()> f) {
     ++tasksStarted;
     std::thread(f).detach();
   }
+
+  virtual void
+  startPrioritizedTask(std::function<void()> f, TaskPriority priority) {
+    if (priority == TaskPriority::High) {
+      ++highPriorityTasksStarted;
+    }
+    this->startTask(std::move(f));
+  }
 };
 
 } // namespace
@@ -46,6 +58,35 @@ TEST_CASE("AsyncSystem") {
     CHECK(executed);
   }
 
+  SUBCASE("passes the priority of worker tasks to the task processor") {
+    bool executed = false;
+
+    asyncSystem
+        .runInWorkerThread(
+            [&executed]() { executed = true; },
+            TaskPriority::High)
+        .wait();
+
+    CHECK(pTaskProcessor->tasksStarted == 1);
+    CHECK(pTaskProcessor->highPriorityTasksStarted == 1);
+    CHECK(executed);
+  }
+
+  SUBCASE("runs prioritized worker tasks immediately in a worker thread") {
+    bool executed = false;
+
+    asyncSystem
+        .runInWorkerThread([asyncSystem, &executed]() {
+          return asyncSystem.runInWorkerThread(
+              [&executed]() { executed = true; },
+              TaskPriority::Low);
+        })
+        .wait();
+
+    CHECK(pTaskProcessor->tasksStarted == 1);
+    CHECK(executed);
+  }
+
   SUBCASE("worker continuations are run via the task processor") {
     bool executed = false;
 
@@ -57,6 +98,21 @@ TEST_CASE("AsyncSystem") {
     CHECK(executed);
   }
 
+  SUBCASE("passes the priority of worker continuations to the task "
+          "processor") {
+    bool executed = false;
+
+    asyncSystem.createResolvedFuture()
+        .thenInWorkerThread(
+            [&executed]() { executed = true; },
+            TaskPriority::High)
+        .wait();
+
+    CHECK(pTaskProcessor->tasksStarted == 1);
+    CHECK(pTaskProcessor->highPriorityTasksStarted == 1);
+    CHECK(executed);
+  }
+
   SUBCASE("runs main thread tasks when instructed") {
     bool executed = false;
 
@@ -70,6 +126,81 @@ TEST_CASE("AsyncSystem") {
     CHECK(pTaskProcessor->tasksStarted == 0);
   }
 
+  SUBCASE("runs main thread tasks in order of priority") {
+    std::vector<TaskPriority> order;
+
+    std::vector<Future<void>> futures;
+    for (TaskPriority priority :
+         {TaskPriority::Low, TaskPriority::Normal, TaskPriority::High}) {
+      futures.emplace_back(asyncSystem.runInMainThread(
+          [&order, priority]() { order.emplace_back(priority); },
+          priority));
+    }
+
+    CHECK(order.empty());
+    asyncSystem.dispatchMainThreadTasks();
+    CHECK(
+        order == std::vector<TaskPriority>{
+                     TaskPriority::High,
+                     TaskPriority::Normal,
+                     TaskPriority::Low});
+  }
+
+  SUBCASE("runs main thread continuations in order of priority") {
+    std::vector<TaskPriority> order;
+
+    std::vector<Promise<void>> promises;
+    std::vector<Future<void>> futures;
+    for (TaskPriority priority :
+         {TaskPriority::Low, TaskPriority::Normal, TaskPriority::High}) {
+      Promise<void>& promise =
+          promises.emplace_back(asyncSystem.createPromise<void>());
+      futures.emplace_back(promise.getFuture().thenInMainThread(
+          [&order, priority]() { order.emplace_back(priority); },
+          priority));
+    }
+
+    // Resolving the promises outside of a main thread dispatch queues the
+    // continuations in the order Low, Normal, High.
+    for (Promise<void>& promise : promises) {
+      promise.resolve();
+    }
+
+    CHECK(order.empty());
+    asyncSystem.dispatchMainThreadTasks();
+    CHECK(
+        order == std::vector<TaskPriority>{
+                     TaskPriority::High,
+                     TaskPriority::Normal,
+                     TaskPriority::Low});
+  }
+
+  SUBCASE("runs main thread tasks within a time budget") {
+    int32_t executed = 0;
+
+    std::vector<Future<void>> futures;
+    for (int32_t i = 0; i < 3; ++i) {
+      futures.emplace_back(asyncSystem.runInMainThread([&executed]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ++executed;
+      }));
+    }
+
+    MainThreadDispatchStatistics statistics =
+        asyncSystem.dispatchMainThreadTasks(1.0);
+    CHECK(executed == 1);
+    CHECK(statistics.tasksDispatched == 1);
+    CHECK(statistics.tasksRemaining == 2);
+    CHECK(statistics.longestTaskMilliseconds >= 5.0);
+    CHECK(
+        statistics.elapsedMilliseconds >= statistics.longestTaskMilliseconds);
+
+    statistics = asyncSystem.dispatchMainThreadTasks(0.0);
+    CHECK(executed == 3);
+    CHECK(statistics.tasksDispatched == 2);
+    CHECK(statistics.tasksRemaining == 0);
+  }
+
   SUBCASE("main thread continuations are run when instructed") {
     bool executed = false;
 
@@ -12,6 +12,7 @@
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
 #include <CesiumAsync/ICacheDatabase.h>
+#include <CesiumAsync/ITaskProcessor.h>
 
 #include <doctest/doctest.h>
 #include <spdlog/spdlog.h>
@@ -19,6 +20,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
@@ -96,6 +98,23 @@ public:
   std::optional<CacheItem> cacheItem;
 };
 
+class PriorityRecordingTaskProcessor : public ITaskProcessor {
+public:
+  virtual void startTask(std::function<void()> f) override {
+    this->priorities.emplace_back(TaskPriority::Normal);
+    f();
+  }
+
+  virtual void startPrioritizedTask(
+      std::function<void()> f,
+      TaskPriority priority) override {
+    this->priorities.emplace_back(priority);
+    f();
+  }
+
+  std::vector<TaskPriority> priorities;
+};
+
 } // namespace
 
 bool runResponseCacheTest(
@@ -559,6 +578,49 @@ TEST_CASE("Test the condition of caching the request") {
   }
 }
 
+TEST_CASE("Test writing responses to the cache") {
+  std::unique_ptr<IAssetResponse> mockResponse =
+      std::make_unique<MockAssetResponse>(
+          static_cast<uint16_t>(200),
+          "app/json",
+          HttpHeaders{
+              {"Content-Type", "app/json"},
+              {"Cache-Control", "max-age=100"}},
+          std::vector<std::byte>{std::byte(1), std::byte(2), std::byte(3)});
+
+  std::shared_ptr<IAssetRequest> mockRequest =
+      std::make_shared<MockAssetRequest>(
+          "GET",
+          "test.com",
+          HttpHeaders{},
+          std::move(mockResponse));
+
+  std::unique_ptr<MockStoreCacheDatabase> ownedMockCacheDatabase =
+      std::make_unique<MockStoreCacheDatabase>();
+  MockStoreCacheDatabase* mockCacheDatabase = ownedMockCacheDatabase.get();
+  std::shared_ptr<CachingAssetAccessor> cacheAssetAccessor =
+      std::make_shared<CachingAssetAccessor>(
+          spdlog::default_logger(),
+          std::make_unique<MockAssetAccessor>(mockRequest),
+          std::move(ownedMockCacheDatabase));
+  std::shared_ptr<PriorityRecordingTaskProcessor> pTaskProcessor =
+      std::make_shared<PriorityRecordingTaskProcessor>();
+
+  AsyncSystem asyncSystem(pTaskProcessor);
+  cacheAssetAccessor
+      ->get(asyncSystem, "test.com", std::vector<IAssetAccessor::THeader>{})
+      .wait();
+
+  // The response is written by a single low-priority worker thread task.
+  CHECK(
+      pTaskProcessor->priorities ==
+      std::vector<TaskPriority>{TaskPriority::Low});
+  REQUIRE(mockCacheDatabase->storeResponseCall);
+  CHECK(
+      mockCacheDatabase->storeRequestParam->responseData ==
+      std::vector<std::byte>{std::byte(1), std::byte(2), std::byte(3)});
+}
+
 TEST_CASE("Test calculation of expiry time for the cached response") {
   SUBCASE("Response has max-age cache control") {
     std::unique_ptr<IAssetResponse> mockResponse =
@@ -0,0 +1,104 @@
+#include <CesiumAsync/CancellationToken.h>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+using namespace CesiumAsync;
+
+TEST_CASE("CancellationToken") {
+  SUBCASE("a default token is never canceled") {
+    CancellationToken token;
+    CHECK(!token.canBeCanceled());
+    CHECK(!token.isCanceled());
+
+    bool called = false;
+    CancellationRegistration registration =
+        token.onCancel([&called]() { called = true; });
+    CHECK(!called);
+  }
+
+  SUBCASE("observes its source") {
+    CancellationSource source;
+    CancellationToken token = source.getToken();
+    CHECK(token.canBeCanceled());
+    CHECK(!token.isCanceled());
+
+    source.cancel();
+    CHECK(token.isCanceled());
+    CHECK(source.isCanceled());
+  }
+
+  SUBCASE("calls callbacks once when canceled") {
+    CancellationSource source;
+    int32_t calls = 0;
+    CancellationRegistration first =
+        source.getToken().onCancel([&calls]() { ++calls; });
+    CancellationRegistration second =
+        source.getToken().onCancel([&calls]() { ++calls; });
+    CHECK(calls == 0);
+
+    source.cancel();
+    CHECK(calls == 2);
+
+    source.cancel();
+    CHECK(calls == 2);
+  }
+
+  SUBCASE("calls a callback immediately if already canceled") {
+    CancellationSource source;
+    source.cancel();
+
+    bool called = false;
+    CancellationRegistration registration =
+        source.getToken().onCancel([&called]() { called = true; });
+    CHECK(called);
+  }
+
+  SUBCASE("does not call a callback that has been unregistered") {
+    CancellationSource source;
+    bool destroyedCalled = false;
+    bool resetCalled = false;
+    bool movedCalled = false;
+    CancellationRegistration moved;
+    {
+      CancellationRegistration destroyed = source.getToken().onCancel(
+          [&destroyedCalled]() { destroyedCalled = true; });
+      CancellationRegistration reset =
+          source.getToken().onCancel([&resetCalled]() { resetCalled = true; });
+      reset.reset();
+      CancellationRegistration registration = source.getToken().onCancel(
+          [&movedCalled]() { movedCalled = true; });
+      moved = std::move(registration);
+    }
+
+    source.cancel();
+    CHECK(!destroyedCalled);
+    CHECK(!resetCalled);
+    CHECK(movedCalled);
+  }
+
+  SUBCASE("waits for a running callback when unregistering") {
+    CancellationSource source;
+    std::atomic<bool> started = false;
+    std::atomic<bool> finished = false;
+    CancellationRegistration registration =
+        source.getToken().onCancel([&started, &finished]() {
+          started = true;
+          std::this_thread::sleep_for(std::chrono::milliseconds(50));
+          finished = true;
+        });
+
+    std::thread canceler([source]() mutable { source.cancel(); });
+    while (!started) {
+      std::this_thread::yield();
+    }
+    registration.reset();
+    CHECK(finished);
+    canceler.join();
+  }
+}
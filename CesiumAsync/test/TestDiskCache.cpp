@@ -9,12 +9,15 @@
 #include <doctest/doctest.h>
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -223,4 +226,108 @@ TEST_CASE("Test disk cache with Sqlite") {
       REQUIRE(cacheItem == std::nullopt);
     }
   }
+
+  SUBCASE("Test concurrent reads and writes") {
+    HttpHeaders responseHeaders{{"Content-Type", "text/html"}};
+    std::vector<std::byte> responseData =
+        {std::byte(0), std::byte(1), std::byte(2), std::byte(3), std::byte(4)};
+    HttpHeaders requestHeaders{{"Request-Header", "Request-Value"}};
+
+    REQUIRE(diskCache.storeEntry(
+        "SharedKey",
+        std::time(nullptr) + 3600,
+        "test.com",
+        "GET",
+        requestHeaders,
+        200,
+        responseHeaders,
+        responseData));
+
+    constexpr size_t threadCount = 4;
+    constexpr size_t iterations = 100;
+    std::atomic<size_t> failures = 0;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&, i]() {
+        for (size_t j = 0; j < iterations; ++j) {
+          std::optional<CacheItem> cacheItem = diskCache.getEntry("SharedKey");
+          if (!cacheItem || cacheItem->cacheResponse.data != responseData) {
+            ++failures;
+          }
+
+          // Stores must be visible to the thread that made them immediately.
+          const std::string key =
+              "TestKey" + std::to_string(i) + "-" + std::to_string(j % 3);
+          if (!diskCache.storeEntry(
+                  key,
+                  std::time(nullptr) + 3600,
+                  "test.com",
+                  "GET",
+                  requestHeaders,
+                  200,
+                  responseHeaders,
+                  responseData) ||
+              !diskCache.getEntry(key)) {
+            ++failures;
+          }
+        }
+      });
+    }
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    CHECK(failures == 0);
+    CHECK(diskCache.prune());
+  }
+}
+
+TEST_CASE("Disk cache read benchmark" * doctest::skip()) {
+  SqliteCache diskCache(spdlog::default_logger(), "test.db", 4096);
+  REQUIRE(diskCache.clearAll());
+
+  HttpHeaders responseHeaders{{"Content-Type", "application/octet-stream"}};
+  std::vector<std::byte> responseData(16384, std::byte(1));
+  HttpHeaders requestHeaders{{"Request-Header", "Request-Value"}};
+
+  constexpr size_t keyCount = 1000;
+  for (size_t i = 0; i < keyCount; ++i) {
+    REQUIRE(diskCache.storeEntry(
+        "TestKey" + std::to_string(i),
+        std::time(nullptr) + 3600,
+        "test.com",
+        "GET",
+        requestHeaders,
+        200,
+        responseHeaders,
+        responseData));
+  }
+
+  constexpr size_t readsPerThread = 10000;
+  for (size_t threadCount : {size_t(1), size_t(2), size_t(4), size_t(8)}) {
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&diskCache, i]() {
+        for (size_t j = 0; j < readsPerThread; ++j) {
+          diskCache.getEntry("TestKey" + std::to_string((i + j) % keyCount));
+        }
+      });
+    }
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    const auto time = std::chrono::steady_clock::now() - start;
+    MESSAGE(
+        threadCount
+        << " threads: "
+        << std::chrono::duration_cast<std::chrono::nanoseconds>(time).count() /
+               int64_t(threadCount * readsPerThread)
+        << "ns per cache hit");
+  }
 }
@@ -0,0 +1,203 @@
+#include "MockAssetAccessor.h"
+#include "MockAssetRequest.h"
+#include "MockAssetResponse.h"
+#include "MockTaskProcessor.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
+#include <CesiumAsync/FileAssetAccessor.h>
+#include <CesiumAsync/HttpHeaders.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <CesiumUtility/ByteBufferPool.h>
+#include <CesiumUtility/Uri.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace CesiumUtility;
+
+namespace {
+
+std::vector<std::byte> createData(size_t size) {
+  std::vector<std::byte> result(size);
+  for (size_t i = 0; i < size; ++i) {
+    result[i] = std::byte((i * 7) & 0xff);
+  }
+  return result;
+}
+
+std::string toFileUrl(const std::filesystem::path& path) {
+  Uri fileUrl("file:///");
+  fileUrl.setPath(Uri::nativePathToUriPath(path.string()));
+  return std::string(fileUrl.toString());
+}
+
+std::string writeFile(
+    const std::filesystem::path& path,
+    const std::vector<std::byte>& data) {
+  std::ofstream writer(path, std::ios::binary | std::ios::trunc);
+  writer.write(
+      reinterpret_cast<const char*>(data.data()),
+      std::streamsize(data.size()));
+  writer.close();
+  return toFileUrl(path);
+}
+
+bool dataEquals(
+    const std::span<const std::byte>& actual,
+    const std::vector<std::byte>& expected) {
+  return std::equal(
+      actual.begin(),
+      actual.end(),
+      expected.begin(),
+      expected.end());
+}
+
+} // namespace
+
+TEST_CASE("FileAssetAccessor") {
+  AsyncSystem asyncSystem(std::make_shared<MockTaskProcessor>());
+
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() / "FileAssetAccessor";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+
+  FileAssetAccessorOptions options;
+  options.minimumMappedSize = 1000;
+  options.pBufferPool = std::make_shared<ByteBufferPool>(1024 * 1024);
+
+  const std::vector<std::byte> small = createData(999);
+  const std::vector<std::byte> large = createData(100000);
+  const std::string smallUrl = writeFile(directory / "small.bin", small);
+  const std::string largeUrl = writeFile(directory / "large.bin", large);
+
+  SUBCASE("reads files into buffers or maps them") {
+    FileAssetAccessor accessor(nullptr, options);
+
+    for (const auto& [url, expected] :
+         {std::pair(smallUrl, small), std::pair(largeUrl, large)}) {
+      std::shared_ptr<IAssetRequest> pRequest =
+          accessor.get(asyncSystem, url, {{"Header", "Value"}})
+              .waitInMainThread();
+      REQUIRE(pRequest);
+      CHECK(pRequest->method() == "GET");
+      CHECK(pRequest->url() == url);
+      CHECK(pRequest->headers().at("Header") == "Value");
+
+      const IAssetResponse* pResponse = pRequest->response();
+      REQUIRE(pResponse);
+      CHECK(pResponse->statusCode() == 200);
+      CHECK(dataEquals(pResponse->data(), expected));
+
+      const std::vector<std::byte> taken = pRequest->takeResponseData();
+      CHECK(taken == expected);
+    }
+  }
+
+  SUBCASE("returns read buffers to the pool") {
+    options.minimumMappedSize = large.size() + 1;
+    FileAssetAccessor accessor(nullptr, options);
+
+    std::shared_ptr<IAssetRequest> pRequest =
+        accessor.get(asyncSystem, largeUrl, {}).waitInMainThread();
+    REQUIRE(pRequest);
+    CHECK(dataEquals(pRequest->response()->data(), large));
+    CHECK(options.pBufferPool->getStatistics().acquired == 1);
+
+    pRequest.reset();
+    CHECK(options.pBufferPool->getStatistics().released == 1);
+  }
+
+  SUBCASE("responds with 404 for missing files") {
+    FileAssetAccessor accessor(nullptr, options);
+
+    std::shared_ptr<IAssetRequest> pRequest =
+        accessor.get(asyncSystem, toFileUrl(directory / "missing.bin"), {})
+            .waitInMainThread();
+    REQUIRE(pRequest);
+    REQUIRE(pRequest->response());
+    CHECK(pRequest->response()->statusCode() == 404);
+    CHECK(pRequest->response()->data().empty());
+  }
+
+  SUBCASE("passes other URLs to the underlying accessor") {
+    auto pMockResponse = std::make_unique<MockAssetResponse>(
+        uint16_t(200),
+        "text/plain",
+        HttpHeaders{},
+        std::vector<std::byte>{});
+    auto pMockRequest = std::make_shared<MockAssetRequest>(
+        "GET",
+        "https://example.com/tileset.json",
+        HttpHeaders{},
+        std::move(pMockResponse));
+    FileAssetAccessor accessor(
+        std::make_shared<MockAssetAccessor>(pMockRequest),
+        options);
+
+    std::shared_ptr<IAssetRequest> pRequest =
+        accessor.get(asyncSystem, "https://example.com/tileset.json", {})
+            .waitInMainThread();
+    CHECK(pRequest == pMockRequest);
+
+    FileAssetAccessor fileOnly(nullptr, options);
+    CHECK_THROWS(
+        fileOnly.get(asyncSystem, "https://example.com/tileset.json", {})
+            .waitInMainThread());
+  }
+
+  SUBCASE("does not read canceled files") {
+    auto pMockRequest = std::make_shared<MockAssetRequest>(
+        "GET",
+        "https://example.com/tileset.json",
+        HttpHeaders{},
+        nullptr);
+    FileAssetAccessor accessor(
+        std::make_shared<MockAssetAccessor>(pMockRequest),
+        options);
+
+    CancellationSource cancellationSource;
+    const CancellationToken token = cancellationSource.getToken();
+
+    std::shared_ptr<IAssetRequest> pRequest =
+        accessor.getCancelable(asyncSystem, smallUrl, {}, token)
+            .waitInMainThread();
+    REQUIRE(pRequest);
+    CHECK(dataEquals(pRequest->response()->data(), small));
+
+    cancellationSource.cancel();
+    CHECK(token.isCanceled());
+    CHECK_THROWS(accessor.getCancelable(asyncSystem, smallUrl, {}, token)
+                     .waitInMainThread());
+    CHECK_THROWS(
+        accessor
+            .getCancelable(
+                asyncSystem,
+                "https://example.com/tileset.json",
+                {},
+                token)
+            .waitInMainThread());
+  }
+
+  SUBCASE("rejects verbs other than GET for files") {
+    FileAssetAccessor accessor(nullptr, options);
+    CHECK_THROWS(
+        accessor.request(asyncSystem, "PUT", smallUrl, {}, small)
+            .waitInMainThread());
+  }
+
+  std::filesystem::remove_all(directory);
+}
@@ -199,4 +199,33 @@ TEST_CASE("GunzipAssetAccessor") {
             pResponse->data().data() + pResponse->data().size()) ==
         asBytes(std::vector<int>{0x01, 0x02, 0x03}));
   }
+
+  SUBCASE("moves the gunzipped data out of the response") {
+    auto pAccessor = std::make_shared<GunzipAssetAccessor>(
+        std::make_shared<MockAssetAccessor>(std::make_shared<MockAssetRequest>(
+            "GET",
+            "https://example.com",
+            HttpHeaders{},
+            std::make_unique<MockAssetResponse>(
+                static_cast<uint16_t>(200),
+                "Application/Whatever",
+                HttpHeaders{},
+                asBytes(std::vector<int>{
+                    0x1F, 0x8B, 0x08, 0x08, 0x34, 0xEE, 0x77, 0x64, 0x00, 0x03,
+                    0x6F, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x74, 0x68, 0x72, 0x65,
+                    0x65, 0x2E, 0x64, 0x61, 0x74, 0x00, 0x63, 0x64, 0x62, 0x06,
+                    0x00, 0x1D, 0x80, 0xBC, 0x55, 0x03, 0x00, 0x00, 0x00})))));
+
+    std::shared_ptr<MockTaskProcessor> mockTaskProcessor =
+        std::make_shared<MockTaskProcessor>();
+    AsyncSystem asyncSystem(mockTaskProcessor);
+
+    auto pCompletedRequest =
+        pAccessor->get(asyncSystem, "https://example.com", {}).wait();
+    const std::byte* pGunzipped = pCompletedRequest->response()->data().data();
+
+    std::vector<std::byte> data = pCompletedRequest->takeResponseData();
+    CHECK(data == asBytes(std::vector<int>{0x01, 0x02, 0x03}));
+    CHECK(data.data() == pGunzipped);
+  }
 }
@@ -0,0 +1,307 @@
+#include <CesiumAsync/CacheItem.h>
+#include <CesiumAsync/HttpHeaders.h>
+#include <CesiumAsync/MappedFileCache.h>
+
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace CesiumAsync;
+
+namespace {
+
+std::vector<std::byte> createData(size_t size, size_t seed) {
+  std::vector<std::byte> result(size);
+  for (size_t i = 0; i < size; ++i) {
+    result[i] = std::byte((i + seed) & 0xff);
+  }
+  return result;
+}
+
+bool storeEntry(
+    MappedFileCache& cache,
+    const std::string& key,
+    const std::vector<std::byte>& data,
+    std::time_t expiryTime = std::time(nullptr) + 3600) {
+  return cache.storeEntry(
+      key,
+      expiryTime,
+      "test.com/" + key,
+      "GET",
+      HttpHeaders{{"Request-Header", "Request-Value"}},
+      200,
+      HttpHeaders{{"Content-Type", "application/octet-stream"}},
+      data);
+}
+
+bool dataEquals(
+    const std::span<const std::byte>& actual,
+    const std::vector<std::byte>& expected) {
+  return std::equal(
+      actual.begin(),
+      actual.end(),
+      expected.begin(),
+      expected.end());
+}
+
+size_t countSegmentFiles(const std::filesystem::path& directory) {
+  return size_t(std::distance(
+      std::filesystem::directory_iterator(directory),
+      std::filesystem::directory_iterator()));
+}
+
+} // namespace
+
+TEST_CASE("Test disk cache with memory-mapped files") {
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() / "CesiumMappedFileCacheTest";
+  std::filesystem::remove_all(directory);
+
+  SUBCASE("Test store and retrieve cache") {
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+
+    const std::vector<std::byte> data = createData(1000, 1);
+    const std::time_t expiryTime = std::time(nullptr) + 100;
+    REQUIRE(storeEntry(cache, "TestKey", data, expiryTime));
+
+    std::optional<CacheItem> cacheItem = cache.getEntry("TestKey");
+    REQUIRE(cacheItem);
+    CHECK(cacheItem->expiryTime == expiryTime);
+
+    const CacheRequest& cacheRequest = cacheItem->cacheRequest;
+    CHECK(
+        cacheRequest.headers ==
+        HttpHeaders{{"Request-Header", "Request-Value"}});
+    CHECK(cacheRequest.method == "GET");
+    CHECK(cacheRequest.url == "test.com/TestKey");
+
+    const CacheResponse& cacheResponse = cacheItem->cacheResponse;
+    CHECK(cacheResponse.statusCode == 200);
+    CHECK(
+        cacheResponse.headers.at("Content-Type") == "application/octet-stream");
+
+    // The data is not copied out of the mapped file.
+    CHECK(cacheResponse.data.empty());
+    CHECK(dataEquals(cacheResponse.getData(), data));
+
+    CHECK(!cache.getEntry("MissingKey"));
+  }
+
+  SUBCASE("Test replacing an entry") {
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+
+    REQUIRE(storeEntry(cache, "TestKey", createData(100, 1)));
+    REQUIRE(storeEntry(cache, "TestKey", createData(200, 2)));
+
+    std::optional<CacheItem> cacheItem = cache.getEntry("TestKey");
+    REQUIRE(cacheItem);
+    CHECK(dataEquals(cacheItem->cacheResponse.getData(), createData(200, 2)));
+  }
+
+  SUBCASE("Test responses outlive the entries they came from") {
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+
+    const std::vector<std::byte> data = createData(1000, 3);
+    REQUIRE(storeEntry(cache, "TestKey", data));
+
+    std::optional<CacheItem> cacheItem = cache.getEntry("TestKey");
+    REQUIRE(cacheItem);
+
+    REQUIRE(cache.clearAll());
+    CHECK(!cache.getEntry("TestKey"));
+    CHECK(dataEquals(cacheItem->cacheResponse.getData(), data));
+  }
+
+  SUBCASE("Test entries are loaded again") {
+    {
+      MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+      for (size_t i = 0; i < 5; ++i) {
+        REQUIRE(storeEntry(
+            cache,
+            "TestKey" + std::to_string(i),
+            createData(100 + i, i)));
+      }
+
+      // Only the three most recently used entries are kept.
+      REQUIRE(cache.prune());
+    }
+
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+    for (size_t i = 0; i < 2; ++i) {
+      CHECK(!cache.getEntry("TestKey" + std::to_string(i)));
+    }
+
+    for (size_t i = 2; i < 5; ++i) {
+      std::optional<CacheItem> cacheItem =
+          cache.getEntry("TestKey" + std::to_string(i));
+      REQUIRE(cacheItem);
+      CHECK(dataEquals(
+          cacheItem->cacheResponse.getData(),
+          createData(100 + i, i)));
+    }
+
+    // New entries are added after the existing ones.
+    REQUIRE(storeEntry(cache, "TestKey5", createData(100, 5)));
+    CHECK(cache.getEntry("TestKey5"));
+    CHECK(cache.getEntry("TestKey4"));
+  }
+
+  SUBCASE("Test prune") {
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+
+    const std::time_t currentTime = std::time(nullptr);
+    const std::time_t interval = -10;
+    for (size_t i = 0; i < 20; ++i) {
+      REQUIRE(storeEntry(
+          cache,
+          "TestKey" + std::to_string(i),
+          createData(5, i),
+          currentTime + interval + static_cast<std::time_t>(i)));
+    }
+
+    // Expired entries are removed first, then the least recently used.
+    REQUIRE(cache.prune());
+    for (size_t i = 0; i <= 16; ++i) {
+      CHECK(!cache.getEntry("TestKey" + std::to_string(i)));
+    }
+
+    for (size_t i = 17; i < 20; ++i) {
+      std::optional<CacheItem> cacheItem =
+          cache.getEntry("TestKey" + std::to_string(i));
+      REQUIRE(cacheItem);
+      CHECK(
+          cacheItem->expiryTime ==
+          currentTime + interval + static_cast<std::time_t>(i));
+    }
+  }
+
+  SUBCASE("Test prune removes least recently used entries") {
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+
+    for (size_t i = 0; i < 4; ++i) {
+      REQUIRE(storeEntry(
+          cache,
+          "TestKey" + std::to_string(i),
+          createData(10, i)));
+    }
+
+    // Reading the oldest entry makes it the most recently used.
+    REQUIRE(cache.getEntry("TestKey0"));
+
+    REQUIRE(cache.prune());
+    CHECK(cache.getEntry("TestKey0"));
+    CHECK(!cache.getEntry("TestKey1"));
+    CHECK(cache.getEntry("TestKey2"));
+    CHECK(cache.getEntry("TestKey3"));
+  }
+
+  SUBCASE("Test prune compacts unused segments") {
+    const size_t segmentSize = 4096;
+    {
+      MappedFileCache cache(
+          spdlog::default_logger(),
+          directory.string(),
+          11,
+          segmentSize);
+
+      // Fill several segments, replacing each entry many times.
+      for (size_t i = 0; i < 100; ++i) {
+        REQUIRE(storeEntry(
+            cache,
+            "TestKey" + std::to_string(i % 10),
+            createData(500, i)));
+      }
+
+      // A response larger than a segment gets a segment of its own.
+      REQUIRE(storeEntry(cache, "LargeKey", createData(3 * segmentSize, 7)));
+
+      const size_t segmentCount = countSegmentFiles(directory);
+      REQUIRE(cache.prune());
+      CHECK(countSegmentFiles(directory) < segmentCount);
+
+      for (size_t i = 90; i < 100; ++i) {
+        std::optional<CacheItem> cacheItem =
+            cache.getEntry("TestKey" + std::to_string(i % 10));
+        REQUIRE(cacheItem);
+        CHECK(dataEquals(
+            cacheItem->cacheResponse.getData(),
+            createData(500, i)));
+      }
+    }
+
+    // The compacted entries are found again.
+    MappedFileCache cache(
+        spdlog::default_logger(),
+        directory.string(),
+        11,
+        segmentSize);
+    for (size_t i = 90; i < 100; ++i) {
+      std::optional<CacheItem> cacheItem =
+          cache.getEntry("TestKey" + std::to_string(i % 10));
+      REQUIRE(cacheItem);
+      CHECK(dataEquals(cacheItem->cacheResponse.getData(), createData(500, i)));
+    }
+    CHECK(cache.getEntry("LargeKey"));
+  }
+
+  SUBCASE("Test records with corrupt lengths are ignored") {
+    {
+      MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+      REQUIRE(storeEntry(cache, "TestKey", createData(100, 1)));
+    }
+
+    // Replace the data length in the header of the record with one that wraps
+    // around when it is added to the offset of the data.
+    {
+      const uint64_t dataLength = 0xFFFFFFFFFFFFFFF0;
+      std::fstream file(
+          directory / "00000000.segment",
+          std::ios::binary | std::ios::in | std::ios::out);
+      REQUIRE(file);
+      file.seekp(16);
+      file.write(
+          reinterpret_cast<const char*>(&dataLength),
+          sizeof(dataLength));
+    }
+
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+    CHECK(!cache.getEntry("TestKey"));
+
+    // The cache still works.
+    const std::vector<std::byte> data = createData(100, 2);
+    REQUIRE(storeEntry(cache, "OtherKey", data));
+    std::optional<CacheItem> cacheItem = cache.getEntry("OtherKey");
+    REQUIRE(cacheItem);
+    CHECK(dataEquals(cacheItem->cacheResponse.getData(), data));
+  }
+
+  SUBCASE("Test clear all") {
+    MappedFileCache cache(spdlog::default_logger(), directory.string(), 3);
+
+    for (size_t i = 0; i < 10; ++i) {
+      REQUIRE(storeEntry(
+          cache,
+          "TestKey" + std::to_string(i),
+          createData(10, i)));
+    }
+
+    REQUIRE(cache.clearAll());
+    for (size_t i = 0; i < 10; ++i) {
+      CHECK(!cache.getEntry("TestKey" + std::to_string(i)));
+    }
+  }
+
+  std::filesystem::remove_all(directory);
+}
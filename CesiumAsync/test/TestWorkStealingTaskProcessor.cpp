@@ -0,0 +1,104 @@
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/ITaskProcessor.h>
+#include <CesiumAsync/WorkStealingTaskProcessor.h>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace CesiumAsync;
+
+TEST_CASE("WorkStealingTaskProcessor") {
+  SUBCASE("runs every task before it is destroyed") {
+    std::atomic<int32_t> tasksRun = 0;
+
+    {
+      WorkStealingTaskProcessor taskProcessor(4);
+      CHECK(taskProcessor.getNumberOfThreads() == 4);
+
+      for (int32_t i = 0; i < 1000; ++i) {
+        taskProcessor.startTask([&tasksRun]() { ++tasksRun; });
+      }
+    }
+
+    CHECK(tasksRun == 1000);
+  }
+
+  SUBCASE("runs tasks started by its own tasks") {
+    std::atomic<int32_t> tasksRun = 0;
+
+    {
+      WorkStealingTaskProcessor taskProcessor(2);
+      for (int32_t i = 0; i < 10; ++i) {
+        taskProcessor.startTask([&taskProcessor, &tasksRun]() {
+          for (int32_t j = 0; j < 100; ++j) {
+            taskProcessor.startPrioritizedTask(
+                [&tasksRun]() { ++tasksRun; },
+                TaskPriority::Low);
+          }
+        });
+      }
+    }
+
+    CHECK(tasksRun == 1000);
+  }
+
+  SUBCASE("runs waiting tasks in order of priority") {
+    std::mutex mutex;
+    std::vector<TaskPriority> order;
+
+    {
+      WorkStealingTaskProcessor taskProcessor(1);
+
+      // Keep the only thread busy until every other task is waiting.
+      std::promise<void> started;
+      std::promise<void> release;
+      std::shared_future<void> released = release.get_future().share();
+      taskProcessor.startTask([&started, released]() {
+        started.set_value();
+        released.wait();
+      });
+      started.get_future().wait();
+
+      for (TaskPriority priority :
+           {TaskPriority::Low, TaskPriority::Normal, TaskPriority::High}) {
+        taskProcessor.startPrioritizedTask(
+            [&mutex, &order, priority]() {
+              std::lock_guard<std::mutex> lock(mutex);
+              order.emplace_back(priority);
+            },
+            priority);
+      }
+
+      release.set_value();
+    }
+
+    CHECK(
+        order == std::vector<TaskPriority>{
+                     TaskPriority::High,
+                     TaskPriority::Normal,
+                     TaskPriority::Low});
+  }
+
+  SUBCASE("runs AsyncSystem worker tasks") {
+    AsyncSystem asyncSystem(std::make_shared<WorkStealingTaskProcessor>(2));
+
+    const std::thread::id mainThreadId = std::this_thread::get_id();
+    const bool ranInOtherThread =
+        asyncSystem
+            .runInWorkerThread(
+                [mainThreadId]() {
+                  return std::this_thread::get_id() != mainThreadId;
+                },
+                TaskPriority::High)
+            .thenInWorkerThread([](bool result) { return result; })
+            .wait();
+    CHECK(ranInOtherThread);
+  }
+}
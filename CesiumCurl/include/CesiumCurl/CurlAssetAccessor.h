@@ -24,12 +24,14 @@ SOFTWARE.
 
 #pragma once
 
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumCurl/Library.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <span>
 #include <string>
@@ -80,11 +82,38 @@ struct CESIUMCURL_API CurlAssetAccessorOptions {
    * false if the initialization and cleanup are done elsewhere.
    */
   bool doGlobalInit{true};
+
+  /**
+   * @brief The most connections to open to a single host at once. Requests
+   * beyond this wait for a connection to become available, or share one over
+   * HTTP/2. If zero, there is no limit.
+   */
+  int64_t maximumConnectionsPerHost{0};
+
+  /**
+   * @brief The most connections to open at once, to all hosts together. If
+   * zero, there is no limit.
+   */
+  int64_t maximumTotalConnections{0};
+
+  /**
+   * @brief Whether to send simultaneous requests to the same host over a
+   * single HTTP/2 connection, when the server and libcurl support it, instead
+   * of opening a connection for each.
+   */
+  bool enableHttp2Multiplexing{true};
 };
 
 /**
  * @brief An implementation of `IAssetAccessor` that can make network and local
  * requests to a variety of servers using libcurl.
+ *
+ * All requests are performed by a single libcurl multi handle on a dedicated
+ * I/O thread, so that a request does not occupy a worker thread while it waits
+ * for the network. Connections are reused across requests. The futures
+ * returned by \ref get and \ref request are resolved on the I/O thread, so
+ * continuations attached to them with `thenImmediately` run there and should
+ * be quick.
  */
 class CESIUMCURL_API CurlAssetAccessor
     : public std::enable_shared_from_this<CurlAssetAccessor>,
@@ -110,6 +139,21 @@ public:
       const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers)
       override;
 
+  /**
+   * @copydoc CesiumAsync::IAssetAccessor::getCancelable
+   *
+   * A request that is canceled is aborted, whether it is still waiting for a
+   * connection or already transferring data, and its future is rejected.
+   * Canceling wakes the I/O thread, so the future is rejected promptly
+   * rather than when the server eventually responds.
+   */
+  CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  getCancelable(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers,
+      const CesiumAsync::CancellationToken& cancellationToken) override;
+
   /** @inheritdoc */
   CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> request(
       const CesiumAsync::AsyncSystem& asyncSystem,
@@ -122,11 +166,10 @@ public:
   void tick() noexcept override;
 
 private:
-  struct CurlCache;
-  class CurlHandle;
+  class CurlMulti;
 
-  std::unique_ptr<CurlCache> _pCurlCache;
   CurlAssetAccessorOptions _options;
+  std::unique_ptr<CurlMulti> _pCurlMulti;
 };
 
 } // namespace CesiumCurl
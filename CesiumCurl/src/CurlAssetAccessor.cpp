@@ -29,16 +29,18 @@ SOFTWARE.
 #define NOMINMAX
 
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
 #include <CesiumAsync/HttpHeaders.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/Promise.h>
 #include <CesiumCurl/CurlAssetAccessor.h>
-#include <CesiumUtility/Tracing.h>
 #include <CesiumUtility/Uri.h>
 
 #include <curl/curl.h>
 #include <curl/easy.h>
+#include <curl/multi.h>
 #include <curl/system.h>
 #include <fmt/format.h>
 
@@ -47,14 +49,17 @@ SOFTWARE.
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <exception>
 #include <filesystem>
-#include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -65,79 +70,6 @@ namespace CesiumCurl {
 
 const auto CURL_BUFFERSIZE = 3145728L; // 3 MiB
 
-// A cache that permits reuse of CURL handles. This is extremely important for
-// performance because libcurl will keep existing connections open if a curl
-// handle is not destroyed ("cleaned up").
-
-struct CurlAssetAccessor::CurlCache {
-  struct CacheEntry {
-    CacheEntry() : curl(nullptr), free(false) {}
-    CacheEntry(CURL* curl_, bool free_) : curl(curl_), free(free_) {}
-    CURL* curl;
-    bool free;
-  };
-  std::mutex cacheMutex;
-  std::vector<CacheEntry> cache;
-  CURL* get() {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-    for (auto& entry : cache) {
-      if (entry.free) {
-        entry.free = false;
-        return entry.curl;
-      }
-    }
-    cache.emplace_back(curl_easy_init(), false);
-    return cache.back().curl;
-  }
-  void release(CURL* curl) {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-    for (auto& entry : cache) {
-      if (curl == entry.curl) {
-        curl_easy_reset(curl);
-        entry.free = true;
-        return;
-      }
-    }
-    throw std::logic_error("releasing a curl handle that is not in the cache");
-  }
-
-  friend class CurlHandle;
-};
-
-// RAII wrapper for the CurlCache.
-class CurlAssetAccessor::CurlHandle {
-public:
-  CurlHandle(CurlAssetAccessor* accessor)
-      : _accessor(accessor), _curl(accessor->_pCurlCache->get()) {}
-
-  ~CurlHandle() {
-    if (this->_accessor) {
-      this->_accessor->_pCurlCache->release(this->_curl);
-    }
-  }
-
-  CURL* operator()() const { return this->_curl; }
-
-  CurlHandle& operator=(CurlHandle&& rhs) noexcept {
-    std::swap(this->_accessor, rhs._accessor);
-    std::swap(this->_curl, rhs._curl);
-    return *this;
-  }
-
-  CurlHandle(CurlHandle&& rhs) noexcept
-      : _accessor(rhs._accessor), _curl(rhs._curl) {
-    rhs._accessor = nullptr;
-    rhs._curl = nullptr;
-  }
-
-  CurlHandle& operator=(const CurlHandle& rhs) = delete;
-  CurlHandle(const CurlHandle& rhs) = delete;
-
-private:
-  CurlAssetAccessor* _accessor;
-  CURL* _curl;
-};
-
 namespace {
 
 class CurlAssetResponse final : public IAssetResponse {
@@ -214,6 +146,13 @@ public:
     return this->_response.get();
   }
 
+  [[nodiscard]] std::vector<std::byte> takeResponseData() override {
+    if (!this->_response) {
+      return {};
+    }
+    return std::move(this->_response->_result);
+  }
+
   void setResponse(std::unique_ptr<CurlAssetResponse> response) {
     this->_response = std::move(response);
   }
@@ -290,11 +229,8 @@ size_t CurlAssetResponse::dataCallback(
   if (!response) {
     return cnt;
   }
-  std::transform(
-      buffer,
-      buffer + cnt,
-      std::back_inserter(response->_result),
-      [](char c) { return std::byte{static_cast<unsigned char>(c)}; });
+  const std::byte* pBytes = reinterpret_cast<const std::byte*>(buffer);
+  response->_result.insert(response->_result.end(), pBytes, pBytes + cnt);
   return cnt;
 }
 
@@ -329,7 +265,6 @@ curl_slist* setCommonOptions(
   curl_easy_setopt(curl, CURLOPT_SSL_OPTIONS, CURLSSLOPT_NATIVE_CA);
   curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
   curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, CURL_BUFFERSIZE);
-  curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, 20L);
   curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, 300L);
   // curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
   curl_slist* list = nullptr;
@@ -344,16 +279,357 @@ curl_slist* setCommonOptions(
   return list;
 }
 
+#if !defined(TARGET_OS_IOS) || __IPHONE_OS_VERSION_MAX_ALLOWED >= 130000
+constexpr std::string_view fileScheme("file:");
+
+bool isFile(const std::string& url) {
+  return Uri(url).getScheme() == fileScheme;
+}
+
+std::string convertFileUriToFilename(const std::string& url) {
+  return Uri::uriPathToNativePath(std::string(Uri(url).getPath()));
+}
+#endif
+
+// A request that has been handed to the I/O thread, along with the promise to
+// resolve when it completes.
+struct Transfer {
+  Transfer(
+      std::shared_ptr<CurlAssetRequest>&& pRequest_,
+      const Promise<std::shared_ptr<IAssetRequest>>& promise_,
+      const CancellationToken& cancellationToken_)
+      : pRequest(std::move(pRequest_)),
+        promise(promise_),
+        cancellationToken(cancellationToken_),
+        pResponse(std::make_unique<CurlAssetResponse>()) {}
+
+  std::shared_ptr<CurlAssetRequest> pRequest;
+  Promise<std::shared_ptr<IAssetRequest>> promise;
+  CancellationToken cancellationToken;
+  std::unique_ptr<CurlAssetResponse> pResponse;
+  CURL* pCurl = nullptr;
+  curl_slist* pHeaderList = nullptr;
+  // Wakes the I/O thread when an active transfer is canceled.
+  CancellationRegistration wakeOnCancel;
+};
+
 } // namespace
 
+// Drives all of the accessor's transfers with a single curl multi handle on a
+// dedicated thread, so that waiting for the network never occupies a worker
+// thread. The multi handle owns the connection cache, which lets transfers
+// reuse each other's connections and multiplex over HTTP/2 connections.
+class CurlAssetAccessor::CurlMulti {
+public:
+  explicit CurlMulti(const CurlAssetAccessorOptions& options)
+      : _options(options), _pMulti(curl_multi_init()), _thread() {
+    // Use `long` to match the documented types of these options.
+    // NOLINTBEGIN(google-runtime-int)
+    curl_multi_setopt(
+        this->_pMulti,
+        CURLMOPT_MAX_HOST_CONNECTIONS,
+        static_cast<long>(options.maximumConnectionsPerHost));
+    curl_multi_setopt(
+        this->_pMulti,
+        CURLMOPT_MAX_TOTAL_CONNECTIONS,
+        static_cast<long>(options.maximumTotalConnections));
+    curl_multi_setopt(
+        this->_pMulti,
+        CURLMOPT_PIPELINING,
+        static_cast<long>(
+            options.enableHttp2Multiplexing ? CURLPIPE_MULTIPLEX
+                                            : CURLPIPE_NOTHING));
+    // NOLINTEND(google-runtime-int)
+
+    this->_thread = std::thread([this]() { this->run(); });
+  }
+
+  ~CurlMulti() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_stopping = true;
+    }
+    curl_multi_wakeup(this->_pMulti);
+    this->_thread.join();
+
+    const std::runtime_error destroyed(
+        "The CurlAssetAccessor was destroyed before the request completed.");
+    for (auto& [pCurl, pTransfer] : this->_active) {
+      curl_multi_remove_handle(this->_pMulti, pCurl);
+      this->recycle(*pTransfer);
+      pTransfer->promise.reject(destroyed);
+    }
+    for (std::unique_ptr<Transfer>& pTransfer : this->_queued) {
+      pTransfer->promise.reject(destroyed);
+    }
+    // Unregister the wake-up callbacks before the multi handle goes away.
+    this->_active.clear();
+    for (CURL* pCurl : this->_freeHandles) {
+      curl_easy_cleanup(pCurl);
+    }
+    curl_multi_cleanup(this->_pMulti);
+  }
+
+  CurlMulti(const CurlMulti&) = delete;
+  CurlMulti& operator=(const CurlMulti&) = delete;
+
+  Future<std::shared_ptr<IAssetRequest>> submit(
+      const AsyncSystem& asyncSystem,
+      std::shared_ptr<CurlAssetRequest>&& pRequest,
+      const CancellationToken& cancellationToken = {}) {
+    Promise<std::shared_ptr<IAssetRequest>> promise =
+        asyncSystem.createPromise<std::shared_ptr<IAssetRequest>>();
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_queued.emplace_back(std::make_unique<Transfer>(
+          std::move(pRequest),
+          promise,
+          cancellationToken));
+    }
+    curl_multi_wakeup(this->_pMulti);
+    return promise.getFuture();
+  }
+
+private:
+  void run() {
+    std::vector<std::unique_ptr<Transfer>> queued;
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        if (this->_stopping) {
+          break;
+        }
+        queued.swap(this->_queued);
+      }
+
+      for (std::unique_ptr<Transfer>& pTransfer : queued) {
+        if (pTransfer->cancellationToken.isCanceled()) {
+          rejectCanceled(*pTransfer);
+        } else {
+          this->start(std::move(pTransfer));
+        }
+      }
+      queued.clear();
+
+      this->abortCanceled();
+
+      int running = 0;
+      curl_multi_perform(this->_pMulti, &running);
+
+      int remaining = 0;
+      while (CURLMsg* pMessage =
+                 curl_multi_info_read(this->_pMulti, &remaining)) {
+        if (pMessage->msg == CURLMSG_DONE) {
+          this->finish(pMessage->easy_handle, pMessage->data.result);
+        }
+      }
+
+      // Sleep until a socket is ready, a timer expires, or a request is
+      // submitted or canceled.
+      curl_multi_poll(this->_pMulti, nullptr, 0, 1000, nullptr);
+    }
+  }
+
+  void start(std::unique_ptr<Transfer>&& pTransfer) {
+    Transfer& transfer = *pTransfer;
+    try {
+      this->configure(transfer);
+    } catch (...) {
+      this->recycle(transfer);
+      transfer.promise.reject(std::current_exception());
+      return;
+    }
+
+    const CURLMcode addResult =
+        curl_multi_add_handle(this->_pMulti, transfer.pCurl);
+    if (addResult != CURLM_OK) {
+      this->recycle(transfer);
+      transfer.promise.reject(std::runtime_error(fmt::format(
+          "{} `{}` failed: {}",
+          transfer.pRequest->method(),
+          transfer.pRequest->url(),
+          curl_multi_strerror(addResult))));
+      return;
+    }
+
+    transfer.wakeOnCancel = transfer.cancellationToken.onCancel(
+        [pMulti = this->_pMulti]() { curl_multi_wakeup(pMulti); });
+    this->_active.emplace(transfer.pCurl, std::move(pTransfer));
+  }
+
+  // Aborts the active transfers whose tokens have been canceled, so that their
+  // connections are free for the transfers that are still wanted.
+  void abortCanceled() {
+    for (auto it = this->_active.begin(); it != this->_active.end();) {
+      Transfer& transfer = *it->second;
+      if (!transfer.cancellationToken.isCanceled()) {
+        ++it;
+        continue;
+      }
+
+      curl_multi_remove_handle(this->_pMulti, transfer.pCurl);
+      this->recycle(transfer);
+      rejectCanceled(transfer);
+      it = this->_active.erase(it);
+    }
+  }
+
+  static void rejectCanceled(Transfer& transfer) {
+    transfer.promise.reject(std::runtime_error(fmt::format(
+        "{} `{}` was canceled.",
+        transfer.pRequest->method(),
+        transfer.pRequest->url())));
+  }
+
+  void configure(Transfer& transfer) {
+    CurlAssetRequest& request = *transfer.pRequest;
+    const std::string& verb = request.method();
+
+    std::optional<CURLoption> verbOption;
+    if (verb == "POST") {
+      verbOption = CURLOPT_POST;
+    } else if (verb == "PUT") {
+      verbOption = CURLOPT_UPLOAD;
+    } else if (verb != "GET") {
+      throw std::runtime_error(
+          fmt::format("CurlAssetAccessor does not support verb `{}`.", verb));
+    }
+
+    // These APIs don't exist in iOS versions prior to 13.
+#if !defined(TARGET_OS_IOS) || __IPHONE_OS_VERSION_MAX_ALLOWED >= 130000
+    // libcurl will not automatically create the target directory when
+    // PUTting to a `file:///` URL. So we do that manually here.
+    if (verbOption && this->_options.allowDirectoryCreation &&
+        isFile(request.url())) {
+      std::filesystem::path filePath = convertFileUriToFilename(request.url());
+      if (filePath.has_parent_path()) {
+        std::filesystem::create_directories(filePath.parent_path());
+      }
+    }
+#endif
+
+    if (this->_freeHandles.empty()) {
+      transfer.pCurl = curl_easy_init();
+    } else {
+      transfer.pCurl = this->_freeHandles.back();
+      this->_freeHandles.pop_back();
+    }
+    CURL* pCurl = transfer.pCurl;
+
+    transfer.pHeaderList = setCommonOptions(
+        pCurl,
+        request.url(),
+        request.headers(),
+        this->_options.userAgent,
+        this->_options.certificatePath,
+        this->_options.certificateFile);
+
+    if (this->_options.enableHttp2Multiplexing) {
+      // Wait for a connection that can be multiplexed rather than opening
+      // another one to the same host.
+      curl_easy_setopt(pCurl, CURLOPT_PIPEWAIT, 1L);
+    }
+
+    if (verbOption) {
+      curl_easy_setopt(pCurl, *verbOption, 1L);
+      curl_easy_setopt(
+          pCurl,
+          CURLOPT_READFUNCTION,
+          CurlAssetRequest::uploadDataCallback);
+      curl_easy_setopt(pCurl, CURLOPT_READDATA, &request);
+      curl_easy_setopt(
+          pCurl,
+          CURLOPT_INFILESIZE_LARGE,
+          curl_off_t(request.contentPayload().size()));
+      curl_easy_setopt(
+          pCurl,
+          CURLOPT_FTP_CREATE_MISSING_DIRS,
+          CURLFTP_CREATE_DIR);
+    }
+
+    transfer.pResponse->setCallbacks(pCurl);
+  }
+
+  void finish(CURL* pCurl, CURLcode result) {
+    auto it = this->_active.find(pCurl);
+    if (it == this->_active.end()) {
+      return;
+    }
+
+    std::unique_ptr<Transfer> pTransfer = std::move(it->second);
+    this->_active.erase(it);
+    curl_multi_remove_handle(this->_pMulti, pCurl);
+
+    Transfer& transfer = *pTransfer;
+    if (result == CURLE_OK) {
+      // Use `long` instead of int64_t to match the documented
+      // `CURLINFO_RESPONSE_CODE` type.
+      // NOLINTNEXTLINE(google-runtime-int)
+      long httpResponseCode = 0;
+      curl_easy_getinfo(pCurl, CURLINFO_RESPONSE_CODE, &httpResponseCode);
+      transfer.pResponse->_statusCode =
+          static_cast<uint16_t>(httpResponseCode);
+      // The response header callback also sets _contentType, so not sure
+      // that this is necessary...
+      char* ct = nullptr;
+      curl_easy_getinfo(pCurl, CURLINFO_CONTENT_TYPE, &ct);
+      if (ct) {
+        transfer.pResponse->_contentType = ct;
+      }
+    }
+
+    this->recycle(transfer);
+
+    if (result == CURLE_OK) {
+      transfer.pRequest->setResponse(std::move(transfer.pResponse));
+      transfer.promise.resolve(std::move(transfer.pRequest));
+    } else {
+      transfer.promise.reject(std::runtime_error(fmt::format(
+          "{} `{}` failed: {}",
+          transfer.pRequest->method(),
+          transfer.pRequest->url(),
+          curl_easy_strerror(result))));
+    }
+  }
+
+  // Returns a transfer's easy handle to the free list. Reusing easy handles
+  // avoids reallocating their buffers for every request.
+  void recycle(Transfer& transfer) noexcept {
+    curl_slist_free_all(transfer.pHeaderList);
+    transfer.pHeaderList = nullptr;
+    if (transfer.pCurl) {
+      curl_easy_reset(transfer.pCurl);
+      this->_freeHandles.emplace_back(transfer.pCurl);
+      transfer.pCurl = nullptr;
+    }
+  }
+
+  const CurlAssetAccessorOptions& _options;
+  CURLM* _pMulti;
+
+  // Guards the members below that are shared with the submitting threads.
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<Transfer>> _queued;
+  bool _stopping = false;
+
+  // Only used by the I/O thread.
+  std::unordered_map<CURL*, std::unique_ptr<Transfer>> _active;
+  std::vector<CURL*> _freeHandles;
+
+  std::thread _thread;
+};
+
 CurlAssetAccessor::CurlAssetAccessor(const CurlAssetAccessorOptions& options)
-    : _pCurlCache(std::make_unique<CurlCache>()), _options(options) {
+    : _options(options), _pCurlMulti() {
   if (this->_options.doGlobalInit) {
     curl_global_init(CURL_GLOBAL_ALL);
   }
+  this->_pCurlMulti = std::make_unique<CurlMulti>(this->_options);
 }
 
 CurlAssetAccessor::~CurlAssetAccessor() {
+  // Finish with libcurl before it is cleaned up.
+  this->_pCurlMulti.reset();
   if (this->_options.doGlobalInit) {
     curl_global_cleanup();
   }
@@ -367,71 +643,24 @@ Future<std::shared_ptr<IAssetRequest>> CurlAssetAccessor::get(
     const AsyncSystem& asyncSystem,
     const std::string& url,
     const std::vector<IAssetAccessor::THeader>& headers) {
-  return asyncSystem.runInWorkerThread(
-      [url,
-       headers,
-       pThis = this->shared_from_this()]() -> std::shared_ptr<IAssetRequest> {
-        CESIUM_TRACE("CurlAssetAccessor::get");
-        std::shared_ptr<CurlAssetRequest> pRequest =
-            std::make_shared<CurlAssetRequest>(
-                "GET",
-                url,
-                headers,
-                pThis->_options.requestHeaders,
-                std::vector<std::byte>());
-
-        CurlHandle curl(pThis.get());
-        curl_slist* list = setCommonOptions(
-            curl(),
-            pRequest->url(),
-            pRequest->headers(),
-            pThis->_options.userAgent,
-            pThis->_options.certificatePath,
-            pThis->_options.certificateFile);
-        std::unique_ptr<CurlAssetResponse> pResponse =
-            std::make_unique<CurlAssetResponse>();
-        pResponse->setCallbacks(curl());
-        CURLcode responseCode = curl_easy_perform(curl());
-        curl_slist_free_all(list);
-        if (responseCode == 0) {
-          // Use `long` instead of int64_t to match the documented
-          // `CURLINFO_RESPONSE_CODE` type.
-          // NOLINTNEXTLINE(google-runtime-int)
-          long httpResponseCode = 0;
-          curl_easy_getinfo(curl(), CURLINFO_RESPONSE_CODE, &httpResponseCode);
-          pResponse->_statusCode = static_cast<uint16_t>(httpResponseCode);
-          // The response header callback also sets _contentType, so not sure
-          // that this is necessary...
-          char* ct = nullptr;
-          curl_easy_getinfo(curl(), CURLINFO_CONTENT_TYPE, &ct);
-          if (ct) {
-            pResponse->_contentType = ct;
-          }
-          pRequest->setResponse(std::move(pResponse));
-          return pRequest;
-        } else {
-          throw std::runtime_error(fmt::format(
-              "{} `{}` failed: {}",
-              pRequest->method(),
-              pRequest->url(),
-              curl_easy_strerror(responseCode)));
-        }
-      });
+  return this->getCancelable(asyncSystem, url, headers, CancellationToken());
 }
 
-#if !defined(TARGET_OS_IOS) || __IPHONE_OS_VERSION_MAX_ALLOWED >= 130000
-namespace {
-constexpr std::string_view fileScheme("file:");
-
-bool isFile(const std::string& url) {
-  return Uri(url).getScheme() == fileScheme;
-}
-
-std::string convertFileUriToFilename(const std::string& url) {
-  return Uri::uriPathToNativePath(std::string(Uri(url).getPath()));
+Future<std::shared_ptr<IAssetRequest>> CurlAssetAccessor::getCancelable(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<IAssetAccessor::THeader>& headers,
+    const CancellationToken& cancellationToken) {
+  return this->_pCurlMulti->submit(
+      asyncSystem,
+      std::make_shared<CurlAssetRequest>(
+          "GET",
+          url,
+          headers,
+          this->_options.requestHeaders,
+          std::vector<std::byte>()),
+      cancellationToken);
 }
-} // namespace
-#endif
 
 Future<std::shared_ptr<IAssetRequest>> CurlAssetAccessor::request(
     const AsyncSystem& asyncSystem,
@@ -439,101 +668,16 @@ Future<std::shared_ptr<IAssetRequest>> CurlAssetAccessor::request(
     const std::string& url,
     const std::vector<IAssetAccessor::THeader>& headers,
     const std::span<const std::byte>& contentPayload) {
-  std::vector<std::byte> payloadCopy(
-      contentPayload.begin(),
-      contentPayload.end());
-  return asyncSystem.runInWorkerThread(
-      [url,
-       headers,
-       verb,
-       payloadCopy = std::move(payloadCopy),
-       pThis = this->shared_from_this()]() mutable
-      -> std::shared_ptr<IAssetRequest> {
-        CESIUM_TRACE("CurlAssetAccessor::request");
-
-        CURLoption verbOption;
-        if (verb == "POST") {
-          verbOption = CURLOPT_POST;
-        } else if (verb == "PUT") {
-          verbOption = CURLOPT_UPLOAD;
-        } else {
-          throw std::runtime_error(fmt::format(
-              "CurlAssetAccessor does not support verb `{}`.",
-              verb));
-        }
-
-        auto pRequest = std::make_shared<CurlAssetRequest>(
-            verb,
-            url,
-            headers,
-            pThis->_options.requestHeaders,
-            std::move(payloadCopy));
-
-    // These APIs don't exist in iOS versions prior to 13.
-#if !defined(TARGET_OS_IOS) || __IPHONE_OS_VERSION_MAX_ALLOWED >= 130000
-        // libcurl will not automatically create the target directory when
-        // PUTting to a `file:///` URL. So we do that manually here.
-        if (pThis->_options.allowDirectoryCreation && isFile(pRequest->url())) {
-          std::filesystem::path filePath =
-              convertFileUriToFilename(pRequest->url());
-          if (filePath.has_parent_path()) {
-            std::filesystem::create_directories(filePath.parent_path());
-          }
-        }
-#endif
-
-        CurlHandle curl(pThis.get());
-
-        curl_slist* list = setCommonOptions(
-            curl(),
-            pRequest->url(),
-            pRequest->headers(),
-            pThis->_options.userAgent,
-            pThis->_options.certificatePath,
-            pThis->_options.certificateFile);
-
-        curl_easy_setopt(curl(), verbOption, 1);
-        curl_easy_setopt(
-            curl(),
-            CURLOPT_READFUNCTION,
-            CurlAssetRequest::uploadDataCallback);
-        curl_easy_setopt(curl(), CURLOPT_READDATA, pRequest.get());
-        curl_easy_setopt(
-            curl(),
-            CURLOPT_INFILESIZE_LARGE,
-            curl_off_t(pRequest->contentPayload().size()));
-        curl_easy_setopt(
-            curl(),
-            CURLOPT_FTP_CREATE_MISSING_DIRS,
-            CURLFTP_CREATE_DIR);
-
-        std::unique_ptr<CurlAssetResponse> pResponse =
-            std::make_unique<CurlAssetResponse>();
-        pResponse->setCallbacks(curl());
-        CURLcode responseCode = curl_easy_perform(curl());
-        curl_slist_free_all(list);
-        if (responseCode == 0) {
-          // Use `long` instead of int64_t to match the documented
-          // `CURLINFO_RESPONSE_CODE` type.
-          // NOLINTNEXTLINE(google-runtime-int)
-          long httpResponseCode = 0;
-          curl_easy_getinfo(curl(), CURLINFO_RESPONSE_CODE, &httpResponseCode);
-          pResponse->_statusCode = static_cast<uint16_t>(httpResponseCode);
-          char* ct = nullptr;
-          curl_easy_getinfo(curl(), CURLINFO_CONTENT_TYPE, &ct);
-          if (ct) {
-            pResponse->_contentType = ct;
-          }
-          pRequest->setResponse(std::move(pResponse));
-          return pRequest;
-        } else {
-          throw std::runtime_error(fmt::format(
-              "{} `{}` failed: {}",
-              pRequest->method(),
-              pRequest->url(),
-              curl_easy_strerror(responseCode)));
-        }
-      });
+  return this->_pCurlMulti->submit(
+      asyncSystem,
+      std::make_shared<CurlAssetRequest>(
+          verb,
+          url,
+          headers,
+          this->_options.requestHeaders,
+          std::vector<std::byte>(
+              contentPayload.begin(),
+              contentPayload.end())));
 }
 
 void CurlAssetAccessor::tick() noexcept {}
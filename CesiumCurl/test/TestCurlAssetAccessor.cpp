@@ -1,4 +1,7 @@
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CancellationToken.h>
+#include <CesiumAsync/FileAssetAccessor.h>
+#include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
 #include <CesiumCurl/CurlAssetAccessor.h>
@@ -9,12 +12,17 @@
 #include <doctest/doctest.h>
 #include <httplib.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <memory>
 #include <span>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace CesiumCurl;
 using namespace CesiumNativeTests;
@@ -170,6 +178,128 @@ TEST_CASE("CurlAssetAccessor") {
     }
   }
 
+  SUBCASE("limits the connections to each host") {
+    std::shared_ptr<httplib::Server> pServer =
+        std::make_shared<httplib::Server>();
+    const int port = pServer->bind_to_any_port("127.0.0.1");
+
+    CesiumUtility::ScopeGuard stopServer([pServer]() { pServer->stop(); });
+
+    std::thread([pServer]() { pServer->listen_after_bind(); }).detach();
+
+    std::atomic<int32_t> active = 0;
+    std::atomic<int32_t> maximumActive = 0;
+    pServer->Get(
+        "/slow",
+        [&active, &maximumActive](
+            const httplib::Request& /* request */,
+            httplib::Response& response) {
+          const int32_t nowActive = ++active;
+          int32_t previous = maximumActive;
+          while (previous < nowActive &&
+                 !maximumActive.compare_exchange_weak(previous, nowActive)) {
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(20));
+          --active;
+          response.set_content("slow", "text/plain");
+        });
+
+    options.maximumConnectionsPerHost = 2;
+    pAssetAccessor = std::make_shared<CurlAssetAccessor>(options);
+
+    std::vector<
+        CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>>
+        futures;
+    for (int32_t i = 0; i < 10; ++i) {
+      futures.emplace_back(pAssetAccessor->get(
+          asyncSystem,
+          fmt::format("http://127.0.0.1:{}/slow", port),
+          {}));
+    }
+
+    for (auto& future : futures) {
+      std::shared_ptr<CesiumAsync::IAssetRequest> pRequest =
+          future.waitInMainThread();
+      REQUIRE(pRequest);
+      REQUIRE(pRequest->response());
+      CHECK_EQ(pRequest->response()->statusCode(), 200);
+    }
+
+    CHECK(maximumActive >= 1);
+    CHECK(maximumActive <= 2);
+  }
+
+  SUBCASE("rejects an active request promptly when it is canceled") {
+    std::shared_ptr<httplib::Server> pServer =
+        std::make_shared<httplib::Server>();
+    const int port = pServer->bind_to_any_port("127.0.0.1");
+
+    CesiumUtility::ScopeGuard stopServer([pServer]() { pServer->stop(); });
+
+    std::thread([pServer]() { pServer->listen_after_bind(); }).detach();
+
+    // The handler outlives this subcase, so it shares the flag.
+    std::shared_ptr<std::atomic<bool>> pReceived =
+        std::make_shared<std::atomic<bool>>(false);
+    pServer->Get(
+        "/slow",
+        [pReceived](
+            const httplib::Request& /* request */,
+            httplib::Response& response) {
+          *pReceived = true;
+          std::this_thread::sleep_for(std::chrono::seconds(3));
+          response.set_content("slow", "text/plain");
+        });
+
+    CesiumAsync::CancellationSource cancellationSource;
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> future =
+        pAssetAccessor->getCancelable(
+            asyncSystem,
+            fmt::format("http://127.0.0.1:{}/slow", port),
+            {},
+            cancellationSource.getToken());
+
+    // Wait until the server is handling the request, so that the I/O thread
+    // is sleeping on the transfer when it is canceled.
+    while (!*pReceived) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const auto start = std::chrono::steady_clock::now();
+    cancellationSource.cancel();
+    CHECK_THROWS(future.waitInMainThread());
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    CHECK(elapsed < std::chrono::milliseconds(500));
+  }
+
+  SUBCASE("rejects requests that fail") {
+    SUBCASE("with an unsupported verb") {
+      CHECK_THROWS(pAssetAccessor
+                       ->request(
+                           asyncSystem,
+                           "DELETE",
+                           "http://127.0.0.1/some/file.txt",
+                           {},
+                           {})
+                       .waitInMainThread());
+    }
+
+    SUBCASE("with a file that does not exist") {
+      std::filesystem::path missingFilePath =
+          std::filesystem::temp_directory_path() / "does-not-exist.txt";
+      std::filesystem::remove(missingFilePath);
+
+      Uri fileUrl("file:///");
+      fileUrl.setPath(Uri::nativePathToUriPath(missingFilePath.string()));
+
+      CHECK_THROWS(
+          pAssetAccessor->get(asyncSystem, std::string(fileUrl.toString()), {})
+              .waitInMainThread());
+    }
+  }
+
   SUBCASE("can do file:/// requests") {
     std::filesystem::path testFilePath =
         std::filesystem::temp_directory_path() / "test.txt";
@@ -293,4 +423,74 @@ TEST_CASE("CurlAssetAccessor") {
       CHECK_EQ(content, "this is the content in the file");
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE(
+    "FileAssetAccessor and CurlAssetAccessor file: benchmark" *
+    doctest::skip()) {
+  CesiumAsync::AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+
+  std::shared_ptr<CurlAssetAccessor> pCurlAccessor =
+      std::make_shared<CurlAssetAccessor>();
+  std::shared_ptr<CesiumAsync::FileAssetAccessor> pFileAccessor =
+      std::make_shared<CesiumAsync::FileAssetAccessor>(pCurlAccessor);
+
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() / "FileAssetAccessorBenchmark";
+  std::filesystem::create_directories(directory);
+  CesiumUtility::ScopeGuard removeDirectory(
+      [directory]() { std::filesystem::remove_all(directory); });
+
+  // Small files are read into buffers and large ones are mapped.
+  constexpr size_t fileCount = 200;
+  for (size_t fileSize : {size_t(16 * 1024), size_t(4 * 1024 * 1024)}) {
+    const std::vector<char> content(fileSize, 'x');
+
+    std::vector<std::string> urls;
+    urls.reserve(fileCount);
+    for (size_t i = 0; i < fileCount; ++i) {
+      const std::filesystem::path path =
+          directory / (std::to_string(i) + ".bin");
+      std::ofstream writer(path, std::ios::binary);
+      writer.write(content.data(), static_cast<int64_t>(content.size()));
+      writer.close();
+
+      Uri fileUrl("file:///");
+      fileUrl.setPath(Uri::nativePathToUriPath(path.string()));
+      urls.emplace_back(fileUrl.toString());
+    }
+
+    for (const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAccessor :
+         {std::shared_ptr<CesiumAsync::IAssetAccessor>(pCurlAccessor),
+          std::shared_ptr<CesiumAsync::IAssetAccessor>(pFileAccessor)}) {
+      const auto start = std::chrono::steady_clock::now();
+
+      std::vector<
+          CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>>
+          futures;
+      futures.reserve(urls.size());
+      for (const std::string& url : urls) {
+        futures.emplace_back(pAccessor->get(asyncSystem, url, {}));
+      }
+
+      const std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>>
+          requests = asyncSystem.all(std::move(futures)).waitInMainThread();
+
+      const auto time = std::chrono::steady_clock::now() - start;
+
+      for (const std::shared_ptr<CesiumAsync::IAssetRequest>& pRequest :
+           requests) {
+        REQUIRE(pRequest->response());
+        CHECK(pRequest->response()->data().size() == fileSize);
+      }
+
+      MESSAGE(
+          (pAccessor == pCurlAccessor ? "CurlAssetAccessor: "
+                                      : "FileAssetAccessor: ")
+          << fileCount << " files of " << fileSize << " bytes in "
+          << std::chrono::duration_cast<std::chrono::microseconds>(time)
+                 .count()
+          << "us");
+    }
+  }
+}
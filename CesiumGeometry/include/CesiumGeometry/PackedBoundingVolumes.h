@@ -0,0 +1,91 @@
+#pragma once
+
+#include <CesiumGeometry/Library.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CesiumGeometry {
+
+class BoundingSphere;
+class OrientedBoundingBox;
+struct CullingVolume;
+
+/**
+ * @brief A set of bounding spheres and oriented bounding boxes, packed into
+ * arrays so that all of them can be tested against a {@link CullingVolume} at
+ * once.
+ *
+ * The volumes are stored as a structure of arrays and tested with a single
+ * branch-free loop, which is considerably faster than testing each volume
+ * individually with `intersectPlane` when there are many of them, such as all
+ * the children of a tile. The results are identical to testing each volume
+ * with {@link BoundingSphere::intersectPlane} or
+ * {@link OrientedBoundingBox::intersectPlane}.
+ *
+ * Instances are intended to be reused: {@link clear} keeps the allocated
+ * capacity.
+ */
+class CESIUMGEOMETRY_API PackedBoundingVolumes final {
+public:
+  /**
+   * @brief Gets the number of volumes in this set.
+   */
+  size_t size() const noexcept { return this->_centerX.size(); }
+
+  /**
+   * @brief Removes all volumes from this set.
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Adds a bounding sphere to the end of this set.
+   *
+   * @param sphere The sphere to add.
+   */
+  void addSphere(const BoundingSphere& sphere);
+
+  /**
+   * @brief Adds an oriented bounding box to the end of this set.
+   *
+   * @param box The box to add.
+   */
+  void addOrientedBox(const OrientedBoundingBox& box);
+
+  /**
+   * @brief Determines which of the volumes in this set are visible in a
+   * culling volume.
+   *
+   * A volume is visible if it is not completely outside any of the planes of
+   * the culling volume. The element of `visible` with the same index as each
+   * visible volume is set to 1. The other elements are not modified, so the
+   * volumes that are visible in any of several culling volumes can be found
+   * by calling this method once for each of them.
+   *
+   * @param cullingVolume The culling volume.
+   * @param visible The visibility of each volume. It must have at least
+   * {@link size} elements.
+   */
+  void computeVisibility(
+      const CullingVolume& cullingVolume,
+      std::span<uint8_t> visible) const noexcept;
+
+private:
+  std::vector<double> _centerX;
+  std::vector<double> _centerY;
+  std::vector<double> _centerZ;
+
+  // The radius of each sphere, or zero for boxes.
+  std::vector<double> _radius;
+
+  // The components of the three half-axes of each box, or zero for spheres.
+  std::vector<double> _halfAxes[9];
+
+  // Whether a volume that exactly touches a plane from outside is culled. This
+  // is true for boxes and false for spheres, matching their intersectPlane.
+  std::vector<uint8_t> _closed;
+};
+
+} // namespace CesiumGeometry
@@ -0,0 +1,121 @@
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumGeometry/CullingVolume.h>
+#include <CesiumGeometry/OrientedBoundingBox.h>
+#include <CesiumGeometry/PackedBoundingVolumes.h>
+#include <CesiumGeometry/Plane.h>
+#include <CesiumUtility/Assert.h>
+
+#include <glm/ext/matrix_double3x3.hpp>
+#include <glm/ext/vector_double3.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CesiumGeometry {
+
+void PackedBoundingVolumes::clear() noexcept {
+  this->_centerX.clear();
+  this->_centerY.clear();
+  this->_centerZ.clear();
+  this->_radius.clear();
+  for (std::vector<double>& component : this->_halfAxes) {
+    component.clear();
+  }
+  this->_closed.clear();
+}
+
+void PackedBoundingVolumes::addSphere(const BoundingSphere& sphere) {
+  const glm::dvec3& center = sphere.getCenter();
+  this->_centerX.emplace_back(center.x);
+  this->_centerY.emplace_back(center.y);
+  this->_centerZ.emplace_back(center.z);
+  this->_radius.emplace_back(sphere.getRadius());
+  for (std::vector<double>& component : this->_halfAxes) {
+    component.emplace_back(0.0);
+  }
+  this->_closed.emplace_back(uint8_t(0));
+}
+
+void PackedBoundingVolumes::addOrientedBox(const OrientedBoundingBox& box) {
+  const glm::dvec3& center = box.getCenter();
+  this->_centerX.emplace_back(center.x);
+  this->_centerY.emplace_back(center.y);
+  this->_centerZ.emplace_back(center.z);
+  this->_radius.emplace_back(0.0);
+
+  const glm::dmat3& halfAxes = box.getHalfAxes();
+  for (glm::length_t axis = 0; axis < 3; ++axis) {
+    for (glm::length_t component = 0; component < 3; ++component) {
+      this->_halfAxes[size_t(axis * 3 + component)].emplace_back(
+          halfAxes[axis][component]);
+    }
+  }
+  this->_closed.emplace_back(uint8_t(1));
+}
+
+void PackedBoundingVolumes::computeVisibility(
+    const CullingVolume& cullingVolume,
+    std::span<uint8_t> visible) const noexcept {
+  CESIUM_ASSERT(visible.size() >= this->size());
+
+  const Plane* planes[] = {
+      &cullingVolume.leftPlane,
+      &cullingVolume.rightPlane,
+      &cullingVolume.topPlane,
+      &cullingVolume.bottomPlane};
+
+  double nx[4];
+  double ny[4];
+  double nz[4];
+  double d[4];
+  for (size_t j = 0; j < 4; ++j) {
+    nx[j] = planes[j]->getNormal().x;
+    ny[j] = planes[j]->getNormal().y;
+    nz[j] = planes[j]->getNormal().z;
+    d[j] = planes[j]->getDistance();
+  }
+
+  const double* cx = this->_centerX.data();
+  const double* cy = this->_centerY.data();
+  const double* cz = this->_centerZ.data();
+  const double* radius = this->_radius.data();
+  const double* halfAxes[9];
+  for (size_t j = 0; j < 9; ++j) {
+    halfAxes[j] = this->_halfAxes[j].data();
+  }
+  const uint8_t* closed = this->_closed.data();
+
+  // Siblings are usually all visible, so each volume is tested against all
+  // four planes rather than stopping at the first plane it is outside of.
+  // The arithmetic is done in the same order as in intersectPlane so that the
+  // results are identical.
+  const size_t count = this->size();
+  for (size_t i = 0; i < count; ++i) {
+    bool outside = false;
+    for (size_t j = 0; j < 4; ++j) {
+      const double effectiveRadius =
+          std::abs(
+              nx[j] * halfAxes[0][i] + ny[j] * halfAxes[1][i] +
+              nz[j] * halfAxes[2][i]) +
+          std::abs(
+              nx[j] * halfAxes[3][i] + ny[j] * halfAxes[4][i] +
+              nz[j] * halfAxes[5][i]) +
+          std::abs(
+              nx[j] * halfAxes[6][i] + ny[j] * halfAxes[7][i] +
+              nz[j] * halfAxes[8][i]) +
+          radius[i];
+      const double distanceToPlane =
+          nx[j] * cx[i] + ny[j] * cy[i] + nz[j] * cz[i] + d[j];
+
+      outside = outside | (distanceToPlane < -effectiveRadius) |
+                ((closed[i] != 0) & (distanceToPlane == -effectiveRadius));
+    }
+
+    visible[i] = uint8_t(visible[i] | uint8_t(!outside));
+  }
+}
+
+} // namespace CesiumGeometry
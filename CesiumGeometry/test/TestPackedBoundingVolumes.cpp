@@ -0,0 +1,205 @@
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumGeometry/CullingResult.h>
+#include <CesiumGeometry/CullingVolume.h>
+#include <CesiumGeometry/OrientedBoundingBox.h>
+#include <CesiumGeometry/PackedBoundingVolumes.h>
+#include <CesiumGeometry/Plane.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double3x3.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace CesiumGeometry;
+using namespace CesiumUtility;
+
+namespace {
+
+template <typename T>
+bool isVisible(const T& volume, const CullingVolume& cullingVolume) {
+  return volume.intersectPlane(cullingVolume.leftPlane) !=
+             CullingResult::Outside &&
+         volume.intersectPlane(cullingVolume.rightPlane) !=
+             CullingResult::Outside &&
+         volume.intersectPlane(cullingVolume.topPlane) !=
+             CullingResult::Outside &&
+         volume.intersectPlane(cullingVolume.bottomPlane) !=
+             CullingResult::Outside;
+}
+
+CullingVolume createTestCullingVolume(const glm::dvec3& direction) {
+  return createCullingVolume(
+      glm::dvec3(0.0),
+      glm::normalize(direction),
+      glm::dvec3(0.0, 0.0, 1.0),
+      Math::degreesToRadians(60.0),
+      Math::degreesToRadians(45.0));
+}
+
+struct TestVolumes {
+  std::vector<BoundingSphere> spheres;
+  std::vector<OrientedBoundingBox> boxes;
+  PackedBoundingVolumes packed;
+};
+
+// Creates alternating spheres and boxes scattered around the origin.
+TestVolumes createTestVolumes(size_t count) {
+  // Use a constant seed so the results are the same every run.
+  std::default_random_engine rand(0x1234abcd);
+  std::uniform_real_distribution<double> position(-100.0, 100.0);
+  std::uniform_real_distribution<double> size(0.1, 10.0);
+
+  TestVolumes result;
+  for (size_t i = 0; i < count; ++i) {
+    const glm::dvec3 center(position(rand), position(rand), position(rand));
+    if (i % 2 == 0) {
+      result.spheres.emplace_back(center, size(rand));
+      result.packed.addSphere(result.spheres.back());
+    } else {
+      const glm::dvec3 x = glm::normalize(
+          glm::dvec3(position(rand), position(rand), position(rand)));
+      const glm::dvec3 y =
+          glm::normalize(glm::cross(x, glm::dvec3(0.0, 0.0, 1.0)));
+      const glm::dvec3 z = glm::cross(x, y);
+      result.boxes.emplace_back(
+          center,
+          glm::dmat3(x * size(rand), y * size(rand), z * size(rand)));
+      result.packed.addOrientedBox(result.boxes.back());
+    }
+  }
+
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("PackedBoundingVolumes") {
+  TestVolumes volumes = createTestVolumes(1000);
+  REQUIRE(volumes.packed.size() == 1000);
+
+  SUBCASE("gives the same result as intersectPlane") {
+    const CullingVolume cullingVolume =
+        createTestCullingVolume(glm::dvec3(1.0, 0.5, 0.2));
+
+    std::vector<uint8_t> visible(volumes.packed.size(), 0);
+    volumes.packed.computeVisibility(cullingVolume, visible);
+
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < visible.size(); ++i) {
+      const bool expected =
+          i % 2 == 0 ? isVisible(volumes.spheres[i / 2], cullingVolume)
+                     : isVisible(volumes.boxes[i / 2], cullingVolume);
+      CHECK((visible[i] != 0) == expected);
+      if (expected) {
+        ++visibleCount;
+      }
+    }
+
+    // Make sure the test is meaningful.
+    CHECK(visibleCount > 0);
+    CHECK(visibleCount < visible.size());
+  }
+
+  SUBCASE("accumulates visibility from multiple culling volumes") {
+    const CullingVolume forward =
+        createTestCullingVolume(glm::dvec3(1.0, 0.0, 0.0));
+    const CullingVolume backward =
+        createTestCullingVolume(glm::dvec3(-1.0, 0.0, 0.0));
+
+    std::vector<uint8_t> visible(volumes.packed.size(), 0);
+    volumes.packed.computeVisibility(forward, visible);
+    volumes.packed.computeVisibility(backward, visible);
+
+    for (size_t i = 0; i < visible.size(); ++i) {
+      const bool expected =
+          i % 2 == 0 ? isVisible(volumes.spheres[i / 2], forward) ||
+                           isVisible(volumes.spheres[i / 2], backward)
+                     : isVisible(volumes.boxes[i / 2], forward) ||
+                           isVisible(volumes.boxes[i / 2], backward);
+      CHECK((visible[i] != 0) == expected);
+    }
+  }
+
+  SUBCASE("uses the same boundary rules as intersectPlane") {
+    const CullingVolume cullingVolume{
+        Plane(glm::dvec3(1.0, 0.0, 0.0), 0.0),
+        Plane(glm::dvec3(1.0, 0.0, 0.0), 0.0),
+        Plane(glm::dvec3(1.0, 0.0, 0.0), 0.0),
+        Plane(glm::dvec3(1.0, 0.0, 0.0), 0.0)};
+
+    // Both volumes touch the plane from outside.
+    PackedBoundingVolumes packed;
+    packed.addSphere(BoundingSphere(glm::dvec3(-1.0, 0.0, 0.0), 1.0));
+    packed.addOrientedBox(
+        OrientedBoundingBox(glm::dvec3(-1.0, 0.0, 0.0), glm::dmat3(1.0)));
+
+    std::vector<uint8_t> visible(packed.size(), 0);
+    packed.computeVisibility(cullingVolume, visible);
+    CHECK(visible[0] == 1);
+    CHECK(visible[1] == 0);
+  }
+
+  SUBCASE("can be cleared and reused") {
+    volumes.packed.clear();
+    CHECK(volumes.packed.size() == 0);
+
+    volumes.packed.addSphere(BoundingSphere(glm::dvec3(10.0, 0.0, 0.0), 1.0));
+    std::vector<uint8_t> visible(volumes.packed.size(), 0);
+    volumes.packed.computeVisibility(
+        createTestCullingVolume(glm::dvec3(1.0, 0.0, 0.0)),
+        visible);
+    CHECK(visible[0] == 1);
+  }
+}
+
+TEST_CASE("PackedBoundingVolumes benchmark" * doctest::skip()) {
+  // Roughly the number of children of a tile in a dense tileset.
+  constexpr size_t volumeCount = 16;
+  constexpr size_t iterations = 1000000;
+
+  const TestVolumes volumes = createTestVolumes(volumeCount);
+  const CullingVolume cullingVolume =
+      createTestCullingVolume(glm::dvec3(1.0, 0.5, 0.2));
+
+  size_t scalarVisible = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    for (const BoundingSphere& sphere : volumes.spheres) {
+      scalarVisible += isVisible(sphere, cullingVolume) ? 1 : 0;
+    }
+    for (const OrientedBoundingBox& box : volumes.boxes) {
+      scalarVisible += isVisible(box, cullingVolume) ? 1 : 0;
+    }
+  }
+  const auto scalarTime = std::chrono::steady_clock::now() - start;
+
+  size_t packedVisible = 0;
+  std::vector<uint8_t> visible(volumeCount);
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    std::fill(visible.begin(), visible.end(), uint8_t(0));
+    volumes.packed.computeVisibility(cullingVolume, visible);
+    for (uint8_t isVolumeVisible : visible) {
+      packedVisible += isVolumeVisible;
+    }
+  }
+  const auto packedTime = std::chrono::steady_clock::now() - start;
+
+  CHECK(scalarVisible == packedVisible);
+  MESSAGE(
+      "intersectPlane: "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(scalarTime)
+             .count()
+      << "ms, PackedBoundingVolumes: "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(packedTime)
+             .count()
+      << "ms");
+}
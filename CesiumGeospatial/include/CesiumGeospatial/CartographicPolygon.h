@@ -6,6 +6,7 @@
 #include <glm/vec2.hpp>
 
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,14 @@ public:
       const std::vector<CesiumGeospatial::CartographicPolygon>&
           cartographicPolygons) noexcept;
 
+  /**
+   * @copydoc rectangleIsWithinPolygons(const CesiumGeospatial::GlobeRectangle&, const std::vector<CesiumGeospatial::CartographicPolygon>&)
+   */
+  static bool rectangleIsWithinPolygons(
+      const CesiumGeospatial::GlobeRectangle& rectangle,
+      std::span<const CesiumGeospatial::CartographicPolygon* const>
+          cartographicPolygons) noexcept;
+
   /**
    * @brief Determines whether a globe rectangle is completely outside all the
    * polygons in a list.
@@ -92,6 +101,14 @@ public:
       const std::vector<CesiumGeospatial::CartographicPolygon>&
           cartographicPolygons) noexcept;
 
+  /**
+   * @copydoc rectangleIsOutsidePolygons(const CesiumGeospatial::GlobeRectangle&, const std::vector<CesiumGeospatial::CartographicPolygon>&)
+   */
+  static bool rectangleIsOutsidePolygons(
+      const CesiumGeospatial::GlobeRectangle& rectangle,
+      std::span<const CesiumGeospatial::CartographicPolygon* const>
+          cartographicPolygons) noexcept;
+
 private:
   std::vector<glm::dvec2> _vertices;
   std::vector<uint32_t> _indices;
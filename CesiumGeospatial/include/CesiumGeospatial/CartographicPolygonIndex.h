@@ -0,0 +1,123 @@
+#pragma once
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/Library.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CesiumGeospatial {
+
+/**
+ * @brief A set of {@link CartographicPolygon} instances with a spatial index
+ * over their bounding rectangles.
+ *
+ * The index is a bounding-rectangle R-tree that is bulk-loaded once, when the
+ * instance is constructed, using the Sort-Tile-Recursive algorithm. It allows
+ * the polygons that may overlap a given {@link GlobeRectangle} to be found
+ * without visiting every polygon in the set, which makes the rectangle tests
+ * in this class much cheaper than the equivalent static functions on
+ * {@link CartographicPolygon} when there are many polygons.
+ *
+ * Bounding rectangles that cross the anti-meridian are stored in the index as
+ * two separate rectangles, one on each side of it.
+ */
+class CESIUMGEOSPATIAL_API CartographicPolygonIndex final {
+public:
+  /**
+   * @brief Constructs a new index over the given polygons.
+   *
+   * @param polygons The polygons to index.
+   */
+  explicit CartographicPolygonIndex(std::vector<CartographicPolygon> polygons);
+
+  /**
+   * @brief Gets the indexed polygons, in the order they were provided to the
+   * constructor.
+   */
+  const std::vector<CartographicPolygon>& getPolygons() const noexcept {
+    return this->_polygons;
+  }
+
+  /**
+   * @brief Finds the polygons whose bounding rectangles may overlap a given
+   * rectangle.
+   *
+   * The result is conservative: it includes every polygon whose bounding
+   * rectangle overlaps the rectangle, and may include some that only touch
+   * it. Polygons without a bounding rectangle are never included.
+   *
+   * @param rectangle The rectangle to query.
+   * @param result Receives pointers to the candidate polygons, in the order
+   * they were provided to the constructor. It is cleared first, so the same
+   * vector can be reused by many queries to avoid allocating.
+   */
+  void findPolygonsOverlapping(
+      const GlobeRectangle& rectangle,
+      std::vector<const CartographicPolygon*>& result) const;
+
+  /**
+   * @brief Determines whether a globe rectangle is completely inside any of the
+   * indexed polygons.
+   *
+   * This gives the same result as
+   * {@link CartographicPolygon::rectangleIsWithinPolygons}, and does not
+   * allocate.
+   *
+   * @param rectangle The {@link GlobeRectangle} to check.
+   * @return True if the rectangle is completely inside a polygon; otherwise,
+   * false.
+   */
+  bool rectangleIsWithinPolygons(const GlobeRectangle& rectangle) const;
+
+  /**
+   * @brief Determines whether a globe rectangle is completely outside all the
+   * indexed polygons.
+   *
+   * This gives the same result as
+   * {@link CartographicPolygon::rectangleIsOutsidePolygons}, and does not
+   * allocate.
+   *
+   * @param rectangle The {@link GlobeRectangle} to check.
+   * @return True if the rectangle is completely outside all the polygons;
+   * otherwise, false.
+   */
+  bool rectangleIsOutsidePolygons(const GlobeRectangle& rectangle) const;
+
+private:
+  struct Box {
+    double west;
+    double south;
+    double east;
+    double north;
+  };
+
+  struct Node {
+    Box box;
+    // The index of the first child in _nodes, or of the first entry in
+    // _entries if this is a leaf.
+    uint32_t first;
+    uint32_t count;
+    bool isLeaf;
+  };
+
+  struct Entry {
+    Box box;
+    uint32_t polygonIndex;
+  };
+
+  // Calls `f` with the index of each polygon with an entry that overlaps the
+  // rectangle, until `f` returns true. A polygon may be passed more than once.
+  // Returns true if `f` did.
+  template <typename Func>
+  bool forEachCandidate(const GlobeRectangle& rectangle, Func&& f) const;
+
+  template <typename Func> bool query(const Box& box, Func& f) const;
+
+  std::vector<CartographicPolygon> _polygons;
+  std::vector<Entry> _entries;
+  std::vector<Node> _nodes;
+};
+
+} // namespace CesiumGeospatial
@@ -7,6 +7,7 @@
 #include <glm/vec3.hpp>
 
 #include <optional>
+#include <span>
 
 // The comments are copied here so that the doc comment always shows up in
 // Intellisense whether the default is toggled or not.
@@ -127,6 +128,38 @@ public:
   std::optional<Cartographic>
   cartesianToCartographic(const glm::dvec3& cartesian) const noexcept;
 
+  /**
+   * @brief Converts many {@link Cartographic} positions to cartesian
+   * representation at once.
+   *
+   * Each result is the same as that of converting the position on its own.
+   *
+   * @param cartographics The {@link Cartographic} positions.
+   * @param cartesians Receives the cartesian representation of each position.
+   * It must be at least as long as `cartographics`.
+   */
+  void cartographicToCartesian(
+      std::span<const Cartographic> cartographics,
+      std::span<glm::dvec3> cartesians) const noexcept;
+
+  /**
+   * @brief Converts many cartesian positions to {@link Cartographic}
+   * representation at once.
+   *
+   * Each result is the same as that of converting the position on its own,
+   * but the Newton iterations of several positions run together in one loop,
+   * which only branches when all of them have converged. This is faster than
+   * converting the positions one at a time.
+   *
+   * @param cartesians The cartesian positions.
+   * @param cartographics Receives the {@link Cartographic} representation of
+   * each position, or the empty optional if it is at the center of this
+   * ellipsoid. It must be at least as long as `cartesians`.
+   */
+  void cartesianToCartographic(
+      std::span<const glm::dvec3> cartesians,
+      std::span<std::optional<Cartographic>> cartographics) const noexcept;
+
   /**
    * @brief Scales the given cartesian position along the geodetic surface
    * normal so that it is on the surface of this ellipsoid.
@@ -185,6 +218,10 @@ public:
   };
 
 private:
+  Cartographic surfacePointToCartographic(
+      const glm::dvec3& cartesian,
+      const glm::dvec3& surfacePoint) const noexcept;
+
   glm::dvec3 _radii;
   glm::dvec3 _radiiSquared;
   glm::dvec3 _oneOverRadii;
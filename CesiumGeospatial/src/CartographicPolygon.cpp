@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -115,6 +116,135 @@ computeBoundingRectangle(const std::vector<glm::dvec2>& polygon) {
 
   return CesiumGeospatial::GlobeRectangle(west, south, east, north);
 }
+
+struct RectangleEdges {
+  explicit RectangleEdges(const GlobeRectangle& rectangle) noexcept
+      : corners{
+            glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
+            glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
+            glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
+            glm::dvec2(rectangle.getEast(), rectangle.getSouth())},
+        edges{
+            corners[1] - corners[0],
+            corners[2] - corners[1],
+            corners[3] - corners[2],
+            corners[0] - corners[3]} {}
+
+  glm::dvec2 corners[4];
+  glm::dvec2 edges[4];
+};
+
+bool polygonPerimeterIntersectsRectangle(
+    const RectangleEdges& rectangle,
+    const std::vector<glm::dvec2>& vertices) noexcept {
+  for (size_t j = 0; j < vertices.size(); ++j) {
+    const glm::dvec2& a = vertices[j];
+    const glm::dvec2& b = vertices[(j + 1) % vertices.size()];
+
+    const glm::dvec2 ba = a - b;
+
+    // Check each rectangle edge.
+    for (size_t k = 0; k < 4; ++k) {
+      const glm::dvec2& cd = rectangle.edges[k];
+      const glm::dmat2 lineSegmentMatrix(cd, ba);
+      const glm::dvec2 ca = a - rectangle.corners[k];
+
+      // s and t are calculated such that:
+      // line_intersection = a + t * ab = c + s * cd
+      const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
+
+      // check that the intersection is within the line segments
+      if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+bool pointIsInPolygon(
+    const glm::dvec2& point,
+    const CartographicPolygon& polygon) noexcept {
+  const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+  const std::vector<uint32_t>& indices = polygon.getIndices();
+  for (size_t j = 2; j < indices.size(); j += 3) {
+    if (IntersectionTests::pointInTriangle(
+            point,
+            vertices[indices[j - 2]],
+            vertices[indices[j - 1]],
+            vertices[indices[j]])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool rectangleIsWithinPolygon(
+    const GlobeRectangle& rectangle,
+    const RectangleEdges& rectangleEdges,
+    const CartographicPolygon& polygon) noexcept {
+  const std::optional<CesiumGeospatial::GlobeRectangle>&
+      polygonBoundingRectangle = polygon.getBoundingRectangle();
+  if (!polygonBoundingRectangle ||
+      !rectangle.computeIntersection(*polygonBoundingRectangle)) {
+    return false;
+  }
+
+  // First check if an arbitrary point on the bounding globe rectangle is
+  // inside the polygon. If it is outside, then this polygon does not entirely
+  // cull the tile.
+  if (!pointIsInPolygon(rectangleEdges.corners[0], polygon)) {
+    return false;
+  }
+
+  // Check if the polygon perimeter intersects the bounding globe rectangle
+  // edges. If there is no intersection with the perimeter and at least one
+  // point is inside the polygon, the tile is completely inside this polygon.
+  return !polygonPerimeterIntersectsRectangle(
+      rectangleEdges,
+      polygon.getVertices());
+}
+
+bool rectangleIsOutsidePolygon(
+    const GlobeRectangle& rectangle,
+    const RectangleEdges& rectangleEdges,
+    const CartographicPolygon& polygon) noexcept {
+  const std::optional<CesiumGeospatial::GlobeRectangle>&
+      polygonBoundingRectangle = polygon.getBoundingRectangle();
+  if (!polygonBoundingRectangle ||
+      !rectangle.computeIntersection(*polygonBoundingRectangle)) {
+    return true;
+  }
+
+  const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+  const glm::dvec2* corners = rectangleEdges.corners;
+
+  // Check if an arbitrary point on the polygon is in the globe rectangle.
+  if (IntersectionTests::pointInTriangle(
+          vertices[0],
+          corners[0],
+          corners[1],
+          corners[2]) ||
+      IntersectionTests::pointInTriangle(
+          vertices[0],
+          corners[0],
+          corners[2],
+          corners[3])) {
+    return false;
+  }
+
+  // Check if an arbitrary point on the bounding globe rectangle is
+  // inside the polygon.
+  if (pointIsInPolygon(corners[0], polygon)) {
+    return false;
+  }
+
+  // Now we know the rectangle does not fully contain the polygon and the
+  // polygon does not fully contain the rectangle. Now check if the polygon
+  // perimeter intersects the bounding globe rectangle edges.
+  return !polygonPerimeterIntersectsRectangle(rectangleEdges, vertices);
+}
 } // namespace
 
 CartographicPolygon::CartographicPolygon(const std::vector<glm::dvec2>& polygon)
@@ -125,89 +255,24 @@ CartographicPolygon::CartographicPolygon(const std::vector<glm::dvec2>& polygon)
 /*static*/ bool CartographicPolygon::rectangleIsWithinPolygons(
     const CesiumGeospatial::GlobeRectangle& rectangle,
     const std::vector<CartographicPolygon>& cartographicPolygons) noexcept {
-
-  glm::dvec2 rectangleCorners[] = {
-      glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
-      glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getSouth())};
-
-  glm::dvec2 rectangleEdges[] = {
-      rectangleCorners[1] - rectangleCorners[0],
-      rectangleCorners[2] - rectangleCorners[1],
-      rectangleCorners[3] - rectangleCorners[2],
-      rectangleCorners[0] - rectangleCorners[3]};
-
-  // Iterate through all polygons.
-  for (const auto& selection : cartographicPolygons) {
-    const std::optional<CesiumGeospatial::GlobeRectangle>&
-        polygonBoundingRectangle = selection.getBoundingRectangle();
-    if (!polygonBoundingRectangle ||
-        !rectangle.computeIntersection(*polygonBoundingRectangle)) {
-      continue;
-    }
-
-    const std::vector<glm::dvec2>& vertices = selection.getVertices();
-    const std::vector<uint32_t>& indices = selection.getIndices();
-
-    // First check if an arbitrary point on the bounding globe rectangle is
-    // inside the polygon.
-    bool inside = false;
-    for (size_t j = 2; j < indices.size(); j += 3) {
-      if (IntersectionTests::pointInTriangle(
-              rectangleCorners[0],
-              vertices[indices[j - 2]],
-              vertices[indices[j - 1]],
-              vertices[indices[j]])) {
-        inside = true;
-        break;
-      }
-    }
-
-    // If the arbitrary point was outside, then this polygon does not entirely
-    // cull the tile.
-    if (!inside) {
-      continue;
-    }
-
-    // Check if the polygon perimeter intersects the bounding globe rectangle
-    // edges.
-    bool intersectionFound = false;
-    for (size_t j = 0; j < vertices.size(); ++j) {
-      const glm::dvec2& a = vertices[j];
-      const glm::dvec2& b = vertices[(j + 1) % vertices.size()];
-
-      const glm::dvec2 ba = a - b;
-
-      // Check each rectangle edge.
-      for (size_t k = 0; k < 4; ++k) {
-        const glm::dvec2& cd = rectangleEdges[k];
-        const glm::dmat2 lineSegmentMatrix(cd, ba);
-        const glm::dvec2 ca = a - rectangleCorners[k];
-
-        // s and t are calculated such that:
-        // line_intersection = a + t * ab = c + s * cd
-        const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
-
-        // check that the intersection is within the line segments
-        if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
-          intersectionFound = true;
-          break;
-        }
-      }
-
-      if (intersectionFound) {
-        break;
-      }
+  const RectangleEdges rectangleEdges(rectangle);
+  for (const CartographicPolygon& polygon : cartographicPolygons) {
+    if (rectangleIsWithinPolygon(rectangle, rectangleEdges, polygon)) {
+      return true;
     }
+  }
+  return false;
+}
 
-    // There is no intersection with the perimeter and at least one point is
-    // inside the polygon so the tile is completely inside this polygon.
-    if (!intersectionFound) {
+/*static*/ bool CartographicPolygon::rectangleIsWithinPolygons(
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    std::span<const CartographicPolygon* const> cartographicPolygons) noexcept {
+  const RectangleEdges rectangleEdges(rectangle);
+  for (const CartographicPolygon* pPolygon : cartographicPolygons) {
+    if (rectangleIsWithinPolygon(rectangle, rectangleEdges, *pPolygon)) {
       return true;
     }
   }
-
   return false;
 }
 
@@ -215,84 +280,24 @@ CartographicPolygon::CartographicPolygon(const std::vector<glm::dvec2>& polygon)
     const CesiumGeospatial::GlobeRectangle& rectangle,
     const std::vector<CesiumGeospatial::CartographicPolygon>&
         cartographicPolygons) noexcept {
-
-  glm::dvec2 rectangleCorners[] = {
-      glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
-      glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
-      glm::dvec2(rectangle.getEast(), rectangle.getSouth())};
-
-  glm::dvec2 rectangleEdges[] = {
-      rectangleCorners[1] - rectangleCorners[0],
-      rectangleCorners[2] - rectangleCorners[1],
-      rectangleCorners[3] - rectangleCorners[2],
-      rectangleCorners[0] - rectangleCorners[3]};
-
-  // Iterate through all polygons.
-  for (const auto& selection : cartographicPolygons) {
-    const std::optional<CesiumGeospatial::GlobeRectangle>&
-        polygonBoundingRectangle = selection.getBoundingRectangle();
-    if (!polygonBoundingRectangle ||
-        !rectangle.computeIntersection(*polygonBoundingRectangle)) {
-      continue;
-    }
-
-    const std::vector<glm::dvec2>& vertices = selection.getVertices();
-    const std::vector<uint32_t>& indices = selection.getIndices();
-
-    // Check if an arbitrary point on the polygon is in the globe rectangle.
-    if (IntersectionTests::pointInTriangle(
-            vertices[0],
-            rectangleCorners[0],
-            rectangleCorners[1],
-            rectangleCorners[2]) ||
-        IntersectionTests::pointInTriangle(
-            vertices[0],
-            rectangleCorners[0],
-            rectangleCorners[2],
-            rectangleCorners[3])) {
+  const RectangleEdges rectangleEdges(rectangle);
+  for (const CartographicPolygon& polygon : cartographicPolygons) {
+    if (!rectangleIsOutsidePolygon(rectangle, rectangleEdges, polygon)) {
       return false;
     }
+  }
+  return true;
+}
 
-    // Check if an arbitrary point on the bounding globe rectangle is
-    // inside the polygon.
-    for (size_t j = 2; j < indices.size(); j += 3) {
-      if (IntersectionTests::pointInTriangle(
-              rectangleCorners[0],
-              vertices[indices[j - 2]],
-              vertices[indices[j - 1]],
-              vertices[indices[j]])) {
-        return false;
-      }
-    }
-
-    // Now we know the rectangle does not fully contain the polygon and the
-    // polygon does not fully contain the rectangle. Now check if the polygon
-    // perimeter intersects the bounding globe rectangle edges.
-    for (size_t j = 0; j < vertices.size(); ++j) {
-      const glm::dvec2& a = vertices[j];
-      const glm::dvec2& b = vertices[(j + 1) % vertices.size()];
-
-      const glm::dvec2 ba = a - b;
-
-      // Check each rectangle edge.
-      for (size_t k = 0; k < 4; ++k) {
-        const glm::dvec2& cd = rectangleEdges[k];
-        const glm::dmat2 lineSegmentMatrix(cd, ba);
-        const glm::dvec2 ca = a - rectangleCorners[k];
-
-        // s and t are calculated such that:
-        // line_intersection = a + t * ab = c + s * cd
-        const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
-
-        // check that the intersection is within the line segments
-        if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
-          return false;
-        }
-      }
+/*static*/ bool CartographicPolygon::rectangleIsOutsidePolygons(
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    std::span<const CartographicPolygon* const> cartographicPolygons) noexcept {
+  const RectangleEdges rectangleEdges(rectangle);
+  for (const CartographicPolygon* pPolygon : cartographicPolygons) {
+    if (!rectangleIsOutsidePolygon(rectangle, rectangleEdges, *pPolygon)) {
+      return false;
     }
   }
-
   return true;
 }
 
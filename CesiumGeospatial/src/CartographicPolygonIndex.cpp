@@ -0,0 +1,288 @@
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Assert.h>
+#include <CesiumUtility/Math.h>
+
+#include <glm/common.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace CesiumUtility;
+
+namespace CesiumGeospatial {
+
+namespace {
+
+// The maximum number of children of each node in the tree.
+constexpr size_t NODE_CAPACITY = 16;
+
+// An upper bound on the depth of the tree. With sixteen children per node,
+// nine levels are enough for the 2^33 entries of 2^32 split polygons.
+constexpr size_t MAX_DEPTH = 9;
+
+template <typename TBox> double centerX(const TBox& box) {
+  return 0.5 * (box.west + box.east);
+}
+
+template <typename TBox> double centerY(const TBox& box) {
+  return 0.5 * (box.south + box.north);
+}
+
+template <typename TBox> bool overlaps(const TBox& a, const TBox& b) {
+  return a.west <= b.east && b.west <= a.east && a.south <= b.north &&
+         b.south <= a.north;
+}
+
+template <typename TBox> void expand(TBox& box, const TBox& other) {
+  box.west = glm::min(box.west, other.west);
+  box.south = glm::min(box.south, other.south);
+  box.east = glm::max(box.east, other.east);
+  box.north = glm::max(box.north, other.north);
+}
+
+/**
+ * @brief Orders items using the Sort-Tile-Recursive algorithm, so that each
+ * run of NODE_CAPACITY consecutive items is spatially compact.
+ */
+template <typename T> void sortTileRecursive(std::vector<T>& items) {
+  const size_t nodeCount = (items.size() + NODE_CAPACITY - 1) / NODE_CAPACITY;
+  const size_t sliceCount = size_t(std::ceil(std::sqrt(double(nodeCount))));
+  const size_t sliceSize = sliceCount * NODE_CAPACITY;
+
+  std::sort(items.begin(), items.end(), [](const T& a, const T& b) {
+    return centerX(a.box) < centerX(b.box);
+  });
+
+  for (size_t start = 0; start < items.size(); start += sliceSize) {
+    const size_t end = glm::min(start + sliceSize, items.size());
+    std::sort(
+        items.begin() + std::ptrdiff_t(start),
+        items.begin() + std::ptrdiff_t(end),
+        [](const T& a, const T& b) { return centerY(a.box) < centerY(b.box); });
+  }
+}
+
+} // namespace
+
+CartographicPolygonIndex::CartographicPolygonIndex(
+    std::vector<CartographicPolygon> polygons)
+    : _polygons(std::move(polygons)), _entries(), _nodes() {
+  this->_entries.reserve(this->_polygons.size());
+
+  for (size_t i = 0; i < this->_polygons.size(); ++i) {
+    const std::optional<GlobeRectangle>& maybeRectangle =
+        this->_polygons[i].getBoundingRectangle();
+    if (!maybeRectangle) {
+      continue;
+    }
+
+    const GlobeRectangle& rectangle = *maybeRectangle;
+    const uint32_t polygonIndex = uint32_t(i);
+
+    if (rectangle.getWest() <= rectangle.getEast()) {
+      this->_entries.emplace_back(Entry{
+          Box{rectangle.getWest(),
+              rectangle.getSouth(),
+              rectangle.getEast(),
+              rectangle.getNorth()},
+          polygonIndex});
+    } else {
+      // Split rectangles that cross the anti-meridian.
+      this->_entries.emplace_back(Entry{
+          Box{rectangle.getWest(),
+              rectangle.getSouth(),
+              Math::OnePi,
+              rectangle.getNorth()},
+          polygonIndex});
+      this->_entries.emplace_back(Entry{
+          Box{-Math::OnePi,
+              rectangle.getSouth(),
+              rectangle.getEast(),
+              rectangle.getNorth()},
+          polygonIndex});
+    }
+  }
+
+  if (this->_entries.empty()) {
+    return;
+  }
+
+  // Build the leaves from runs of spatially-sorted entries.
+  sortTileRecursive(this->_entries);
+
+  std::vector<Node> level;
+  for (size_t start = 0; start < this->_entries.size();
+       start += NODE_CAPACITY) {
+    const size_t end = glm::min(start + NODE_CAPACITY, this->_entries.size());
+    Node node{
+        this->_entries[start].box,
+        uint32_t(start),
+        uint32_t(end - start),
+        true};
+    for (size_t i = start + 1; i < end; ++i) {
+      expand(node.box, this->_entries[i].box);
+    }
+    level.emplace_back(node);
+  }
+
+  // Build each level of the tree from runs of spatially-sorted nodes in the
+  // level below, until only the root remains. The children of every node are
+  // contiguous in _nodes, and the root is the last node.
+  std::vector<Node> parents;
+  while (level.size() > 1) {
+    sortTileRecursive(level);
+
+    const size_t base = this->_nodes.size();
+    this->_nodes.insert(this->_nodes.end(), level.begin(), level.end());
+
+    parents.clear();
+    for (size_t start = 0; start < level.size(); start += NODE_CAPACITY) {
+      const size_t end = glm::min(start + NODE_CAPACITY, level.size());
+      Node node{
+          level[start].box,
+          uint32_t(base + start),
+          uint32_t(end - start),
+          false};
+      for (size_t i = start + 1; i < end; ++i) {
+        expand(node.box, level[i].box);
+      }
+      parents.emplace_back(node);
+    }
+
+    std::swap(level, parents);
+  }
+
+  this->_nodes.emplace_back(level.front());
+}
+
+template <typename Func>
+bool CartographicPolygonIndex::forEachCandidate(
+    const GlobeRectangle& rectangle,
+    Func&& f) const {
+  if (this->_nodes.empty()) {
+    return false;
+  }
+
+  if (rectangle.getWest() <= rectangle.getEast()) {
+    return this->query(
+        Box{rectangle.getWest(),
+            rectangle.getSouth(),
+            rectangle.getEast(),
+            rectangle.getNorth()},
+        f);
+  }
+
+  return this->query(
+             Box{rectangle.getWest(),
+                 rectangle.getSouth(),
+                 Math::OnePi,
+                 rectangle.getNorth()},
+             f) ||
+         this->query(
+             Box{-Math::OnePi,
+                 rectangle.getSouth(),
+                 rectangle.getEast(),
+                 rectangle.getNorth()},
+             f);
+}
+
+template <typename Func>
+bool CartographicPolygonIndex::query(const Box& box, Func& f) const {
+  // Each level of the tree leaves at most NODE_CAPACITY - 1 siblings on the
+  // stack, and the tree is never deeper than MAX_DEPTH, so a fixed-size stack
+  // is enough and the query never allocates.
+  std::array<uint32_t, MAX_DEPTH * (NODE_CAPACITY - 1) + 1> stack;
+  size_t stackSize = 0;
+  stack[stackSize++] = uint32_t(this->_nodes.size() - 1);
+
+  while (stackSize > 0) {
+    const Node& node = this->_nodes[stack[--stackSize]];
+
+    if (!overlaps(node.box, box)) {
+      continue;
+    }
+
+    const uint32_t end = node.first + node.count;
+    if (node.isLeaf) {
+      for (uint32_t i = node.first; i < end; ++i) {
+        const Entry& entry = this->_entries[i];
+        if (overlaps(entry.box, box) && f(entry.polygonIndex)) {
+          return true;
+        }
+      }
+    } else {
+      for (uint32_t i = node.first; i < end; ++i) {
+        CESIUM_ASSERT(stackSize < stack.size());
+        stack[stackSize++] = i;
+      }
+    }
+  }
+
+  return false;
+}
+
+void CartographicPolygonIndex::findPolygonsOverlapping(
+    const GlobeRectangle& rectangle,
+    std::vector<const CartographicPolygon*>& result) const {
+  result.clear();
+
+  this->forEachCandidate(rectangle, [this, &result](uint32_t polygonIndex) {
+    result.emplace_back(&this->_polygons[polygonIndex]);
+    return false;
+  });
+
+  // A polygon may be found more than once if it or the rectangle crosses the
+  // anti-meridian. The polygons are stored in a vector, so sorting the
+  // pointers also reports the polygons in their original order.
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+
+  // The tree is conservative, so use the exact test that the polygon
+  // functions use to decide whether the rectangles actually overlap.
+  result.erase(
+      std::remove_if(
+          result.begin(),
+          result.end(),
+          [&rectangle](const CartographicPolygon* pPolygon) {
+            return !rectangle.computeIntersection(
+                *pPolygon->getBoundingRectangle());
+          }),
+      result.end());
+}
+
+bool CartographicPolygonIndex::rectangleIsWithinPolygons(
+    const GlobeRectangle& rectangle) const {
+  // Test each candidate as it is found, rather than collecting them, so that
+  // this doesn't allocate. Testing a polygon twice doesn't change the result.
+  return this->forEachCandidate(
+      rectangle,
+      [this, &rectangle](uint32_t polygonIndex) {
+        const CartographicPolygon* pPolygon = &this->_polygons[polygonIndex];
+        return CartographicPolygon::rectangleIsWithinPolygons(
+            rectangle,
+            std::span<const CartographicPolygon* const>(&pPolygon, 1));
+      });
+}
+
+bool CartographicPolygonIndex::rectangleIsOutsidePolygons(
+    const GlobeRectangle& rectangle) const {
+  return !this->forEachCandidate(
+      rectangle,
+      [this, &rectangle](uint32_t polygonIndex) {
+        const CartographicPolygon* pPolygon = &this->_polygons[polygonIndex];
+        return !CartographicPolygon::rectangleIsOutsidePolygons(
+            rectangle,
+            std::span<const CartographicPolygon* const>(&pPolygon, 1));
+      });
+}
+
+} // namespace CesiumGeospatial
@@ -1,5 +1,6 @@
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 #include <glm/common.hpp>
@@ -7,13 +8,120 @@
 #include <glm/geometric.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <optional>
+#include <span>
 
 using namespace CesiumUtility;
 
 namespace CesiumGeospatial {
 
+namespace {
+// The number of positions that the batch conversions iterate on together. A
+// batch keeps iterating until its slowest position has converged, so a larger
+// batch spends more iterations on positions that are already done.
+constexpr size_t batchSize = 8;
+
+// Scales up to batchSize positions to the geodetic surface, like
+// Ellipsoid::scaleToGeodeticSurface. The Newton iterations of all of the
+// positions run in lockstep, but each position keeps the result of the
+// iteration in which it would have stopped on its own.
+void scaleToGeodeticSurfaceBatch(
+    std::span<const glm::dvec3> cartesians,
+    const glm::dvec3& oneOverRadii,
+    const glm::dvec3& oneOverRadiiSquared,
+    double centerToleranceSquared,
+    std::span<std::optional<glm::dvec3>> results) {
+  std::array<double, batchSize> x2{};
+  std::array<double, batchSize> y2{};
+  std::array<double, batchSize> z2{};
+  std::array<double, batchSize> lambda{};
+  std::array<double, batchSize> correction{};
+  std::array<double, batchSize> xMultiplier{};
+  std::array<double, batchSize> yMultiplier{};
+  std::array<double, batchSize> zMultiplier{};
+  std::array<bool, batchSize> iterated{};
+  std::array<bool, batchSize> active{};
+
+  bool anyActive = false;
+  for (size_t i = 0; i < cartesians.size(); ++i) {
+    const glm::dvec3& cartesian = cartesians[i];
+
+    x2[i] = cartesian.x * cartesian.x * oneOverRadii.x * oneOverRadii.x;
+    y2[i] = cartesian.y * cartesian.y * oneOverRadii.y * oneOverRadii.y;
+    z2[i] = cartesian.z * cartesian.z * oneOverRadii.z * oneOverRadii.z;
+
+    const double squaredNorm = x2[i] + y2[i] + z2[i];
+    const double ratio = sqrt(1.0 / squaredNorm);
+    const glm::dvec3 intersection = cartesian * ratio;
+
+    // If the position is near the center, the iteration will not converge.
+    if (squaredNorm < centerToleranceSquared) {
+      results[i] = !std::isfinite(ratio) ? std::optional<glm::dvec3>()
+                                         : intersection;
+      continue;
+    }
+
+    const glm::dvec3 gradient = intersection * oneOverRadiiSquared * 2.0;
+    lambda[i] = ((1.0 - ratio) * glm::length(cartesian)) /
+                (0.5 * glm::length(gradient));
+    iterated[i] = true;
+    active[i] = true;
+    anyActive = true;
+  }
+
+  while (anyActive) {
+    anyActive = false;
+
+    for (size_t i = 0; i < batchSize; ++i) {
+      const double nextLambda = lambda[i] - correction[i];
+
+      const double xM = 1.0 / (1.0 + nextLambda * oneOverRadiiSquared.x);
+      const double yM = 1.0 / (1.0 + nextLambda * oneOverRadiiSquared.y);
+      const double zM = 1.0 / (1.0 + nextLambda * oneOverRadiiSquared.z);
+
+      const double xM2 = xM * xM;
+      const double yM2 = yM * yM;
+      const double zM2 = zM * zM;
+
+      const double xM3 = xM2 * xM;
+      const double yM3 = yM2 * yM;
+      const double zM3 = zM2 * zM;
+
+      const double func = x2[i] * xM2 + y2[i] * yM2 + z2[i] * zM2 - 1.0;
+      const double denominator = x2[i] * xM3 * oneOverRadiiSquared.x +
+                                 y2[i] * yM3 * oneOverRadiiSquared.y +
+                                 z2[i] * zM3 * oneOverRadiiSquared.z;
+      const double derivative = -2.0 * denominator;
+
+      // Positions that have already converged keep their multipliers.
+      const bool wasActive = active[i];
+      lambda[i] = wasActive ? nextLambda : lambda[i];
+      correction[i] = wasActive ? func / derivative : correction[i];
+      xMultiplier[i] = wasActive ? xM : xMultiplier[i];
+      yMultiplier[i] = wasActive ? yM : yMultiplier[i];
+      zMultiplier[i] = wasActive ? zM : zMultiplier[i];
+
+      active[i] = wasActive && glm::abs(func) > Math::Epsilon12;
+      anyActive = anyActive || active[i];
+    }
+  }
+
+  for (size_t i = 0; i < cartesians.size(); ++i) {
+    const glm::dvec3& cartesian = cartesians[i];
+    if (iterated[i]) {
+      results[i] = glm::dvec3(
+          cartesian.x * xMultiplier[i],
+          cartesian.y * yMultiplier[i],
+          cartesian.z * zMultiplier[i]);
+    }
+  }
+}
+} // namespace
+
 const Ellipsoid Ellipsoid::WGS84(6378137.0, 6378137.0, 6356752.3142451793);
 const Ellipsoid Ellipsoid::UNIT_SPHERE(1.0, 1.0, 1.0);
 
@@ -44,6 +152,16 @@ glm::dvec3 Ellipsoid::cartographicToCartesian(
   return k + n;
 }
 
+void Ellipsoid::cartographicToCartesian(
+    std::span<const Cartographic> cartographics,
+    std::span<glm::dvec3> cartesians) const noexcept {
+  CESIUM_ASSERT(cartesians.size() >= cartographics.size());
+
+  for (size_t i = 0; i < cartographics.size(); ++i) {
+    cartesians[i] = this->cartographicToCartesian(cartographics[i]);
+  }
+}
+
 std::optional<Cartographic>
 Ellipsoid::cartesianToCartographic(const glm::dvec3& cartesian) const noexcept {
   std::optional<glm::dvec3> p = this->scaleToGeodeticSurface(cartesian);
@@ -52,8 +170,41 @@ Ellipsoid::cartesianToCartographic(const glm::dvec3& cartesian) const noexcept {
     return std::optional<Cartographic>();
   }
 
-  const glm::dvec3 n = this->geodeticSurfaceNormal(p.value());
-  const glm::dvec3 h = cartesian - p.value();
+  return this->surfacePointToCartographic(cartesian, p.value());
+}
+
+void Ellipsoid::cartesianToCartographic(
+    std::span<const glm::dvec3> cartesians,
+    std::span<std::optional<Cartographic>> cartographics) const noexcept {
+  CESIUM_ASSERT(cartographics.size() >= cartesians.size());
+
+  std::array<std::optional<glm::dvec3>, batchSize> surfacePoints;
+
+  for (size_t begin = 0; begin < cartesians.size(); begin += batchSize) {
+    const size_t count = std::min(batchSize, cartesians.size() - begin);
+    const std::span<const glm::dvec3> batch = cartesians.subspan(begin, count);
+
+    scaleToGeodeticSurfaceBatch(
+        batch,
+        this->_oneOverRadii,
+        this->_oneOverRadiiSquared,
+        this->_centerToleranceSquared,
+        std::span(surfacePoints).first(count));
+
+    for (size_t i = 0; i < count; ++i) {
+      const std::optional<glm::dvec3>& p = surfacePoints[i];
+      cartographics[begin + i] =
+          p ? this->surfacePointToCartographic(batch[i], *p)
+            : std::optional<Cartographic>();
+    }
+  }
+}
+
+Cartographic Ellipsoid::surfacePointToCartographic(
+    const glm::dvec3& cartesian,
+    const glm::dvec3& surfacePoint) const noexcept {
+  const glm::dvec3 n = this->geodeticSurfaceNormal(surfacePoint);
+  const glm::dvec3 h = cartesian - surfacePoint;
 
   const double longitude = glm::atan(n.y, n.x);
   const double latitude = glm::asin(n.z);
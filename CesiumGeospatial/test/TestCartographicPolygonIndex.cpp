@@ -0,0 +1,119 @@
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/vector_double2.hpp>
+#include <glm/trigonometric.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace {
+
+std::vector<CartographicPolygon> createRandomPolygons(size_t count) {
+  // Use a constant seed so the results are the same every run.
+  std::default_random_engine rand(0xabcdabcd);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  std::vector<CartographicPolygon> polygons;
+  polygons.reserve(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const double centerX = -Math::OnePi + unit(rand) * Math::TwoPi;
+    const double centerY = -1.4 + unit(rand) * 2.8;
+    const double radius = 0.2 * unit(rand);
+
+    std::vector<glm::dvec2> vertices;
+    for (size_t j = 0; j < 6; ++j) {
+      const double angle = Math::TwoPi * double(j) / 6.0;
+      vertices.emplace_back(
+          Math::convertLongitudeRange(centerX + radius * glm::cos(angle)),
+          centerY + radius * glm::sin(angle));
+    }
+
+    polygons.emplace_back(vertices);
+  }
+
+  return polygons;
+}
+
+std::vector<const CartographicPolygon*> findOverlappingLinear(
+    const std::vector<CartographicPolygon>& polygons,
+    const GlobeRectangle& rectangle) {
+  std::vector<const CartographicPolygon*> result;
+  for (const CartographicPolygon& polygon : polygons) {
+    if (polygon.getBoundingRectangle() &&
+        rectangle.computeIntersection(*polygon.getBoundingRectangle())) {
+      result.emplace_back(&polygon);
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("CartographicPolygonIndex") {
+  SUBCASE("finds nothing when there are no polygons") {
+    CartographicPolygonIndex index({});
+    std::vector<const CartographicPolygon*> result;
+    index.findPolygonsOverlapping(GlobeRectangle::MAXIMUM, result);
+    CHECK(result.empty());
+    CHECK(!index.rectangleIsWithinPolygons(GlobeRectangle::MAXIMUM));
+    CHECK(index.rectangleIsOutsidePolygons(GlobeRectangle::MAXIMUM));
+  }
+
+  SUBCASE("finds the same polygons as a linear search") {
+    CartographicPolygonIndex index(createRandomPolygons(2000));
+    const std::vector<CartographicPolygon>& polygons = index.getPolygons();
+
+    std::default_random_engine rand(0x12345678);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::vector<const CartographicPolygon*> result;
+    for (size_t i = 0; i < 1000; ++i) {
+      // Some of these rectangles cross the anti-meridian.
+      const double west = -Math::OnePi + unit(rand) * Math::TwoPi;
+      const double east =
+          Math::convertLongitudeRange(west + unit(rand) * 0.5);
+      const double south = -1.5 + unit(rand) * 2.5;
+      const double north = south + unit(rand) * 0.5;
+      const GlobeRectangle rectangle(west, south, east, north);
+
+      index.findPolygonsOverlapping(rectangle, result);
+      CHECK(result == findOverlappingLinear(polygons, rectangle));
+
+      CHECK(
+          index.rectangleIsWithinPolygons(rectangle) ==
+          CartographicPolygon::rectangleIsWithinPolygons(rectangle, polygons));
+      CHECK(
+          index.rectangleIsOutsidePolygons(rectangle) ==
+          CartographicPolygon::rectangleIsOutsidePolygons(rectangle, polygons));
+    }
+  }
+
+  SUBCASE("finds polygons that cross the anti-meridian") {
+    CartographicPolygonIndex index({CartographicPolygon(
+        {glm::dvec2(Math::degreesToRadians(170.0), 0.0),
+         glm::dvec2(Math::degreesToRadians(-170.0), 0.0),
+         glm::dvec2(Math::degreesToRadians(-170.0), 0.1),
+         glm::dvec2(Math::degreesToRadians(170.0), 0.1)})});
+
+    std::vector<const CartographicPolygon*> result;
+
+    index.findPolygonsOverlapping(
+        GlobeRectangle::fromDegrees(160.0, 0.0, -160.0, 1.0),
+        result);
+    CHECK(result.size() == 1);
+
+    index.findPolygonsOverlapping(
+        GlobeRectangle::fromDegrees(0.0, 0.0, 10.0, 1.0),
+        result);
+    CHECK(result.empty());
+  }
+}
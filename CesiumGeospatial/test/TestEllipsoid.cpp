@@ -0,0 +1,65 @@
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/vector_double3.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+TEST_CASE("Ellipsoid batch conversions") {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+
+  // Enough positions for several full batches and a partial one, including
+  // some at and near the center of the ellipsoid.
+  std::vector<Cartographic> cartographics;
+  for (double longitude = -3.1; longitude <= 3.1; longitude += 0.7) {
+    for (double latitude = -1.5; latitude <= 1.5; latitude += 0.5) {
+      for (double height : {-1000.0, 0.0, 123.4, 9000000.0}) {
+        cartographics.emplace_back(longitude, latitude, height);
+      }
+    }
+  }
+
+  std::vector<glm::dvec3> cartesians(cartographics.size());
+  ellipsoid.cartographicToCartesian(cartographics, cartesians);
+
+  for (size_t i = 0; i < cartographics.size(); ++i) {
+    CHECK(cartesians[i] == ellipsoid.cartographicToCartesian(cartographics[i]));
+  }
+
+  cartesians.insert(cartesians.begin() + 3, glm::dvec3(0.0));
+  cartesians.insert(cartesians.begin() + 10, glm::dvec3(0.1, 0.0, 0.0));
+
+  std::vector<std::optional<Cartographic>> results(cartesians.size());
+  ellipsoid.cartesianToCartographic(cartesians, results);
+
+  for (size_t i = 0; i < cartesians.size(); ++i) {
+    const std::optional<Cartographic> expected =
+        ellipsoid.cartesianToCartographic(cartesians[i]);
+    REQUIRE(results[i].has_value() == expected.has_value());
+    if (expected) {
+      CHECK(Math::equalsEpsilon(
+          results[i]->longitude,
+          expected->longitude,
+          Math::Epsilon14));
+      CHECK(Math::equalsEpsilon(
+          results[i]->latitude,
+          expected->latitude,
+          Math::Epsilon14));
+      CHECK(Math::equalsEpsilon(
+          results[i]->height,
+          expected->height,
+          Math::Epsilon12,
+          Math::Epsilon6));
+    }
+  }
+
+  CHECK(!results[3]);
+  CHECK(results[10]);
+}
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <CesiumGltf/Library.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace CesiumGltf {
@@ -15,5 +17,43 @@ struct CESIUMGLTF_API BufferCesium final {
    * @brief The buffer's data.
    */
   std::vector<std::byte> data;
+
+  /**
+   * @brief The pool that {@link data} is returned to when this object is
+   * destroyed, or nullptr if it is simply freed.
+   */
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pDataPool;
+
+  /**
+   * @brief Constructs an empty instance.
+   */
+  BufferCesium() = default;
+
+  /**
+   * @brief Copy constructor.
+   */
+  BufferCesium(const BufferCesium& rhs) = default;
+
+  /**
+   * @brief Move constructor.
+   */
+  BufferCesium(BufferCesium&& rhs) noexcept = default;
+
+  /**
+   * @brief Copy assignment operator.
+   */
+  BufferCesium& operator=(const BufferCesium& rhs) = default;
+
+  /**
+   * @brief Move assignment operator. The data that this object held before is
+   * returned to its {@link pDataPool} if there is one.
+   */
+  BufferCesium& operator=(BufferCesium&& rhs) noexcept;
+
+  /**
+   * @brief Destroys the instance, returning its data to {@link pDataPool} if
+   * there is one.
+   */
+  ~BufferCesium() noexcept;
 };
 } // namespace CesiumGltf
@@ -2,10 +2,12 @@
 
 #include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumGltf/Library.h>
+#include <CesiumUtility/ByteBufferPool.h>
 #include <CesiumUtility/SharedAsset.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace CesiumGltf {
@@ -112,11 +114,47 @@ struct CESIUMGLTF_API ImageAsset final
    */
   int64_t sizeBytes = -1;
 
+  /**
+   * @brief The pool that {@link pixelData} is returned to when this image is
+   * destroyed, or nullptr if it is simply freed.
+   *
+   * Code that replaces `pixelData` should allocate the new buffer from this
+   * pool, if there is one.
+   */
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pPixelDataPool;
+
   /**
    * @brief Constructs an empty image asset.
    */
   ImageAsset() = default;
 
+  /**
+   * @brief Copy constructor.
+   */
+  ImageAsset(const ImageAsset& rhs) = default;
+
+  /**
+   * @brief Move constructor.
+   */
+  ImageAsset(ImageAsset&& rhs) noexcept = default;
+
+  /**
+   * @brief Copy assignment operator.
+   */
+  ImageAsset& operator=(const ImageAsset& rhs) = default;
+
+  /**
+   * @brief Move assignment operator. The pixel data that this image held
+   * before is returned to its {@link pPixelDataPool} if there is one.
+   */
+  ImageAsset& operator=(ImageAsset&& rhs) noexcept;
+
+  /**
+   * @brief Destroys the image, returning its pixel data to
+   * {@link pPixelDataPool} if there is one.
+   */
+  ~ImageAsset() noexcept;
+
   /**
    * @brief Converts this image to the given number of channels.
    *
@@ -0,0 +1,25 @@
+#include <CesiumGltf/BufferCesium.h>
+#include <CesiumUtility/ByteBufferPool.h>
+
+#include <utility>
+
+namespace CesiumGltf {
+
+BufferCesium& BufferCesium::operator=(BufferCesium&& rhs) noexcept {
+  if (this != &rhs) {
+    if (this->pDataPool) {
+      this->pDataPool->release(std::move(this->data));
+    }
+    this->data = std::move(rhs.data);
+    this->pDataPool = std::move(rhs.pDataPool);
+  }
+  return *this;
+}
+
+BufferCesium::~BufferCesium() noexcept {
+  if (this->pDataPool) {
+    this->pDataPool->release(std::move(this->data));
+  }
+}
+
+} // namespace CesiumGltf
@@ -1,4 +1,5 @@
 #include <CesiumGltf/ImageAsset.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -7,6 +8,31 @@
 
 namespace CesiumGltf {
 
+ImageAsset& ImageAsset::operator=(ImageAsset&& rhs) noexcept {
+  if (this != &rhs) {
+    if (this->pPixelDataPool) {
+      this->pPixelDataPool->release(std::move(this->pixelData));
+    }
+    this->width = rhs.width;
+    this->height = rhs.height;
+    this->channels = rhs.channels;
+    this->bytesPerChannel = rhs.bytesPerChannel;
+    this->compressedPixelFormat = rhs.compressedPixelFormat;
+    this->mipPositions = std::move(rhs.mipPositions);
+    this->pixelData = std::move(rhs.pixelData);
+    this->sizeBytes = rhs.sizeBytes;
+    this->pPixelDataPool = std::move(rhs.pPixelDataPool);
+    CesiumUtility::SharedAsset<ImageAsset>::operator=(std::move(rhs));
+  }
+  return *this;
+}
+
+ImageAsset::~ImageAsset() noexcept {
+  if (this->pPixelDataPool) {
+    this->pPixelDataPool->release(std::move(this->pixelData));
+  }
+}
+
 void ImageAsset::changeNumberOfChannels(
     int32_t newChannels,
     std::byte defaultValue) {
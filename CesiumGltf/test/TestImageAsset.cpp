@@ -1,7 +1,12 @@
 #include <CesiumGltf/ImageAsset.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <doctest/doctest.h>
 
+#include <cstddef>
+#include <memory>
+#include <utility>
+
 TEST_CASE("ImageAsset::changeNumberOfChannels") {
   SUBCASE("Converts to fewer channels") {
     CesiumGltf::ImageAsset asset;
@@ -61,4 +66,29 @@ TEST_CASE("ImageAsset::changeNumberOfChannels") {
     CHECK(asset.channels == 2);
     CHECK(asset.pixelData.size() == 8);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("ImageAsset move assignment returns its pixel data to its pool") {
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pPool =
+      std::make_shared<CesiumUtility::ByteBufferPool>(1024 * 1024);
+  const size_t size = CesiumUtility::ByteBufferPool::MinimumPooledSize;
+
+  CesiumGltf::ImageAsset target;
+  target.pixelData = pPool->acquire(size);
+  target.pPixelDataPool = pPool;
+  const std::byte* pOldData = target.pixelData.data();
+
+  CesiumGltf::ImageAsset source;
+  source.width = 2;
+  source.pixelData = pPool->acquire(size);
+  const std::byte* pNewData = source.pixelData.data();
+
+  target = std::move(source);
+  CHECK(target.width == 2);
+  CHECK(target.pixelData.data() == pNewData);
+  CHECK(target.pPixelDataPool == nullptr);
+
+  // The old pixel data is waiting in the pool, ready to be reused.
+  CHECK(pPool->getStatistics().released == 1);
+  CHECK(pPool->acquire(size).data() == pOldData);
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <CesiumGltfContent/Library.h>
+
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CesiumGeometry {
+class Ray;
+}
+
+namespace CesiumGltf {
+struct Model;
+}
+
+namespace CesiumGltfContent {
+
+/**
+ * @brief A bounding volume hierarchy (BVH) over the triangles of each mesh
+ * primitive in a glTF.
+ *
+ * Passing one to {@link GltfUtilities::intersectRayGltfModel} lets it find the
+ * triangles a ray may hit in O(log n) time, instead of testing every triangle
+ * of the model. Building it takes O(n log n) time, so it is worthwhile when
+ * many rays are intersected with the same model.
+ *
+ * The BVH of each primitive is in the coordinate system of the primitive's
+ * positions, so it stays valid when the model is transformed. It does not
+ * stay valid when the model's meshes, accessors, or buffers are modified.
+ */
+class CESIUMGLTFCONTENT_API GltfTriangleBvh {
+public:
+  /**
+   * @brief Builds the BVH of every triangle primitive in a model.
+   *
+   * Primitives that are not triangles, or whose positions can't be read, are
+   * left out.
+   *
+   * @param model The model.
+   */
+  explicit GltfTriangleBvh(const CesiumGltf::Model& model);
+
+  /**
+   * @brief Finds the closest intersection of a ray with the triangles of a
+   * primitive.
+   *
+   * @param meshId The index of the mesh in the model.
+   * @param primitiveId The index of the primitive in the mesh.
+   * @param ray The ray, in the coordinate system of the primitive's positions.
+   * @param cullBackFaces Ignore triangles that face away from the ray. Front
+   * faces use CCW winding order.
+   * @param tClosest Set to the parametric distance along the ray of the
+   * closest intersection, or to -1.0 if there is none.
+   * @param warnings Warnings about the primitive's triangles are added to this
+   * list.
+   * @return False if the BVH has no triangles for this primitive, in which case
+   * `tClosest` and `warnings` are not modified.
+   */
+  bool intersectRayPrimitive(
+      int32_t meshId,
+      int32_t primitiveId,
+      const CesiumGeometry::Ray& ray,
+      bool cullBackFaces,
+      double& tClosest,
+      std::vector<std::string>& warnings) const;
+
+  /**
+   * @brief Gets the approximate number of bytes of memory used by this BVH.
+   */
+  int64_t getSizeBytes() const noexcept;
+
+private:
+  struct Node {
+    glm::vec3 minimum;
+    glm::vec3 maximum;
+    // For a leaf, the index of the first triangle. Otherwise, the index of the
+    // second child; the first child immediately follows this node.
+    uint32_t index;
+    // The number of triangles in a leaf, or zero for an inner node.
+    uint32_t triangleCount;
+  };
+
+  struct Triangle {
+    glm::vec3 p0;
+    glm::vec3 p1;
+    glm::vec3 p2;
+  };
+
+  struct Primitive {
+    bool isBuilt;
+    // The index of the root node, or -1 if there are no triangles.
+    int64_t rootNode;
+    std::vector<std::string> warnings;
+  };
+
+  void buildPrimitive(
+      Primitive& primitive,
+      std::vector<Triangle>&& triangles);
+  uint32_t buildNode(
+      std::vector<Triangle>& triangles,
+      size_t triangleOffset,
+      size_t begin,
+      size_t end);
+
+  // The index of the first primitive of each mesh in _primitives.
+  std::vector<size_t> _meshOffsets;
+  std::vector<Primitive> _primitives;
+  std::vector<Node> _nodes;
+  std::vector<Triangle> _triangles;
+};
+
+} // namespace CesiumGltfContent
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <CesiumGeometry/Ray.h>
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
@@ -8,6 +9,7 @@
 #include <glm/fwd.hpp>
 
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -18,11 +20,9 @@ struct Model;
 struct Node;
 } // namespace CesiumGltf
 
-namespace CesiumGeometry {
-class Ray;
-} // namespace CesiumGeometry
-
 namespace CesiumGltfContent {
+class GltfTriangleBvh;
+
 /**
  * A collection of utility functions that are used to process and transform a
  * gltf model
@@ -342,12 +342,40 @@ struct CESIUMGLTFCONTENT_API GltfUtilities {
    * @param cullBackFaces Ignore triangles that face away from ray. Front faces
    * use CCW winding order.
    * @param gltfTransform Optional matrix to apply to entire gltf model.
+   * @param pTriangleBvh Optional {@link GltfTriangleBvh} built from `gltf`.
+   * When provided, only the triangles that the ray may hit are tested. The
+   * result is the same as without it.
    * @returns IntersectResult describing outcome
    */
   static IntersectResult intersectRayGltfModel(
       const CesiumGeometry::Ray& ray,
       const CesiumGltf::Model& gltf,
       bool cullBackFaces = true,
-      const glm::dmat4x4& gltfTransform = glm::dmat4(1.0));
+      const glm::dmat4x4& gltfTransform = glm::dmat4(1.0),
+      const GltfTriangleBvh* pTriangleBvh = nullptr);
+
+  /**
+   * @brief Intersects many rays with a glTF model and returns the first
+   * intersection point of each.
+   *
+   * The result for each ray is the same as that of
+   * {@link intersectRayGltfModel}, but the scene graph is only traversed once,
+   * and the transformation of each primitive is only computed once, for all of
+   * the rays.
+   *
+   * @param rays The rays in world space.
+   * @param gltf The glTF model to intersect.
+   * @param cullBackFaces Ignore triangles that face away from the rays. Front
+   * faces use CCW winding order.
+   * @param gltfTransform Optional matrix to apply to entire gltf model.
+   * @param pTriangleBvh Optional {@link GltfTriangleBvh} built from `gltf`.
+   * @returns An IntersectResult for each ray, in the same order as `rays`.
+   */
+  static std::vector<IntersectResult> intersectRaysGltfModel(
+      std::span<const CesiumGeometry::Ray> rays,
+      const CesiumGltf::Model& gltf,
+      bool cullBackFaces = true,
+      const glm::dmat4x4& gltfTransform = glm::dmat4(1.0),
+      const GltfTriangleBvh* pTriangleBvh = nullptr);
 };
 } // namespace CesiumGltfContent
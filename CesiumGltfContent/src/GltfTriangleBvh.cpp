@@ -0,0 +1,459 @@
+#include "createPositionView.h"
+
+#include <CesiumGeometry/IntersectionTests.h>
+#include <CesiumGeometry/Ray.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Mesh.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
+#include <CesiumUtility/Tracing.h>
+
+#include <glm/common.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_float3.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace CesiumGltf;
+
+namespace CesiumGltfContent {
+
+namespace {
+
+// Leaves with more triangles than this are split.
+const size_t maximumLeafTriangles = 4;
+
+// Deep enough for a tree of 2^32 triangles split at the median.
+const size_t maximumTraversalDepth = 64;
+
+bool isTriangleMode(int32_t mode) {
+  return mode == MeshPrimitive::Mode::TRIANGLES ||
+         mode == MeshPrimitive::Mode::TRIANGLE_STRIP ||
+         mode == MeshPrimitive::Mode::TRIANGLE_FAN;
+}
+
+template <typename TPositionView>
+glm::vec3 getPosition(const TPositionView& positionView, int64_t index) {
+  const auto& position = positionView[index];
+  return glm::vec3(
+      static_cast<float>(position.value[0]),
+      static_cast<float>(position.value[1]),
+      static_cast<float>(position.value[2]));
+}
+
+// Visits the vertex indices of each triangle in the same order as
+// GltfUtilities::intersectRayGltfModel. Returns true if any index is out of
+// range for the positions; those triangles are skipped.
+template <typename TGetIndex, typename TCallback>
+bool forEachTriangle(
+    int32_t mode,
+    int64_t indexCount,
+    int64_t positionCount,
+    TGetIndex&& getIndex,
+    TCallback&& callback) {
+  bool foundInvalidIndex = false;
+
+  auto visit = [positionCount, &foundInvalidIndex, &callback](
+                   int64_t i0,
+                   int64_t i1,
+                   int64_t i2) {
+    if (i0 < 0 || i0 >= positionCount || i1 < 0 || i1 >= positionCount ||
+        i2 < 0 || i2 >= positionCount) {
+      foundInvalidIndex = true;
+      return;
+    }
+    callback(i0, i1, i2);
+  };
+
+  if (mode == MeshPrimitive::Mode::TRIANGLES) {
+    for (int64_t i = 2; i < indexCount; i += 3) {
+      visit(getIndex(i - 2), getIndex(i - 1), getIndex(i));
+    }
+  } else if (mode == MeshPrimitive::Mode::TRIANGLE_STRIP) {
+    for (int64_t i = 2; i < indexCount; ++i) {
+      if (i % 2) {
+        visit(getIndex(i - 2), getIndex(i), getIndex(i - 1));
+      } else {
+        visit(getIndex(i - 2), getIndex(i - 1), getIndex(i));
+      }
+    }
+  } else {
+    const int64_t i0 = getIndex(0);
+    for (int64_t i = 2; i < indexCount; ++i) {
+      visit(i0, getIndex(i - 1), getIndex(i));
+    }
+  }
+
+  return foundInvalidIndex;
+}
+
+template <typename TPositionView, typename TTriangle>
+void gatherTriangles(
+    const Model& model,
+    const MeshPrimitive& primitive,
+    const TPositionView& positionView,
+    std::vector<TTriangle>& triangles,
+    std::vector<std::string>& warnings) {
+  auto addTriangle =
+      [&positionView, &triangles](int64_t i0, int64_t i1, int64_t i2) {
+        triangles.emplace_back(TTriangle{
+            getPosition(positionView, i0),
+            getPosition(positionView, i1),
+            getPosition(positionView, i2)});
+      };
+
+  if (primitive.indices == -1) {
+    if (positionView.size() < 3) {
+      warnings.emplace_back("Skipping mesh with less than 3 vertex positions");
+      return;
+    }
+
+    forEachTriangle(
+        primitive.mode,
+        positionView.size(),
+        positionView.size(),
+        [](int64_t i) { return i; },
+        addTriangle);
+    return;
+  }
+
+  const Accessor* pIndexAccessor =
+      Model::getSafe(&model.accessors, primitive.indices);
+  if (!pIndexAccessor) {
+    warnings.emplace_back("Skipping mesh with an invalid index accessor id");
+    return;
+  }
+
+  if (pIndexAccessor->componentType == Accessor::ComponentType::FLOAT) {
+    warnings.emplace_back("Skipping mesh with an invalid index component type");
+    return;
+  }
+
+  createAccessorView(
+      model,
+      *pIndexAccessor,
+      [&positionView, &primitive, &addTriangle, &warnings](
+          const auto& indexView) {
+        if (indexView.status() != AccessorViewStatus::Valid) {
+          warnings.emplace_back(
+              "Could not create accessor view for mesh indices");
+          return;
+        }
+
+        if (indexView.size() < 3) {
+          warnings.emplace_back(
+              "Skipping indexed mesh with less than 3 indices");
+          return;
+        }
+
+        const bool foundInvalidIndex = forEachTriangle(
+            primitive.mode,
+            indexView.size(),
+            positionView.size(),
+            [&indexView](int64_t i) {
+              return static_cast<int64_t>(indexView[i].value[0]);
+            },
+            addTriangle);
+        if (foundInvalidIndex) {
+          warnings.emplace_back(
+              "Found one or more invalid index values for indexed mesh");
+        }
+      });
+}
+
+bool rayIntersectsBox(
+    const glm::dvec3& origin,
+    const glm::dvec3& direction,
+    const glm::vec3& minimum,
+    const glm::vec3& maximum,
+    double& tNear) {
+  double tEnter = 0.0;
+  double tExit = std::numeric_limits<double>::max();
+
+  for (glm::length_t i = 0; i < 3; ++i) {
+    const double low = static_cast<double>(minimum[i]);
+    const double high = static_cast<double>(maximum[i]);
+    if (direction[i] == 0.0) {
+      if (origin[i] < low || origin[i] > high) {
+        return false;
+      }
+      continue;
+    }
+
+    double t0 = (low - origin[i]) / direction[i];
+    double t1 = (high - origin[i]) / direction[i];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+
+    tEnter = std::max(tEnter, t0);
+    tExit = std::min(tExit, t1);
+    if (tEnter > tExit) {
+      return false;
+    }
+  }
+
+  tNear = tEnter;
+  return true;
+}
+
+} // namespace
+
+GltfTriangleBvh::GltfTriangleBvh(const Model& model)
+    : _meshOffsets(), _primitives(), _nodes(), _triangles() {
+  CESIUM_TRACE("CesiumGltfContent::GltfTriangleBvh");
+
+  this->_meshOffsets.reserve(model.meshes.size());
+  for (const Mesh& mesh : model.meshes) {
+    this->_meshOffsets.emplace_back(this->_primitives.size());
+
+    for (const MeshPrimitive& meshPrimitive : mesh.primitives) {
+      Primitive& primitive =
+          this->_primitives.emplace_back(Primitive{false, -1, {}});
+
+      if (!isTriangleMode(meshPrimitive.mode)) {
+        continue;
+      }
+
+      auto positionIt = meshPrimitive.attributes.find("POSITION");
+      if (positionIt == meshPrimitive.attributes.end()) {
+        continue;
+      }
+
+      const Accessor* pPositionAccessor =
+          Model::getSafe(&model.accessors, positionIt->second);
+      if (!pPositionAccessor ||
+          pPositionAccessor->type != Accessor::Type::VEC3) {
+        continue;
+      }
+
+      std::vector<Triangle> triangles;
+      createPositionView(
+          model,
+          *pPositionAccessor,
+          [&model, &meshPrimitive, &primitive, &triangles](
+              const auto& positionView) {
+            if (positionView.status() != AccessorViewStatus::Valid) {
+              primitive.warnings.emplace_back(
+                  "Skipping mesh with an invalid position component type");
+              return;
+            }
+
+            gatherTriangles(
+                model,
+                meshPrimitive,
+                positionView,
+                triangles,
+                primitive.warnings);
+          });
+
+      this->buildPrimitive(primitive, std::move(triangles));
+    }
+  }
+}
+
+bool GltfTriangleBvh::intersectRayPrimitive(
+    int32_t meshId,
+    int32_t primitiveId,
+    const CesiumGeometry::Ray& ray,
+    bool cullBackFaces,
+    double& tClosest,
+    std::vector<std::string>& warnings) const {
+  if (meshId < 0 || size_t(meshId) >= this->_meshOffsets.size() ||
+      primitiveId < 0) {
+    return false;
+  }
+
+  const size_t primitiveIndex =
+      this->_meshOffsets[size_t(meshId)] + size_t(primitiveId);
+  const size_t meshEnd = size_t(meshId) + 1 < this->_meshOffsets.size()
+                             ? this->_meshOffsets[size_t(meshId) + 1]
+                             : this->_primitives.size();
+  if (primitiveIndex >= meshEnd) {
+    return false;
+  }
+
+  const Primitive& primitive = this->_primitives[primitiveIndex];
+  if (!primitive.isBuilt) {
+    return false;
+  }
+
+  warnings.insert(
+      warnings.end(),
+      primitive.warnings.begin(),
+      primitive.warnings.end());
+
+  tClosest = -1.0;
+  if (primitive.rootNode < 0) {
+    return true;
+  }
+
+  const glm::dvec3& origin = ray.getOrigin();
+  const glm::dvec3& direction = ray.getDirection();
+
+  std::array<uint32_t, maximumTraversalDepth> stack;
+  size_t stackSize = 0;
+  stack[stackSize++] = uint32_t(primitive.rootNode);
+
+  while (stackSize > 0) {
+    const uint32_t nodeIndex = stack[--stackSize];
+    const Node& node = this->_nodes[nodeIndex];
+
+    if (node.triangleCount > 0) {
+      for (uint32_t i = 0; i < node.triangleCount; ++i) {
+        const Triangle& triangle = this->_triangles[node.index + i];
+        const std::optional<double> t =
+            CesiumGeometry::IntersectionTests::rayTriangleParametric(
+                ray,
+                glm::dvec3(triangle.p0),
+                glm::dvec3(triangle.p1),
+                glm::dvec3(triangle.p2),
+                cullBackFaces);
+        if (t && *t >= 0.0 && (tClosest == -1.0 || *t < tClosest)) {
+          tClosest = *t;
+        }
+      }
+      continue;
+    }
+
+    // Visit the nearer child first, so that the farther one can more often be
+    // skipped because it starts beyond the closest hit found so far.
+    const std::array<uint32_t, 2> children{nodeIndex + 1, node.index};
+    std::array<double, 2> tNear{0.0, 0.0};
+    std::array<bool, 2> hit{false, false};
+    for (size_t i = 0; i < 2; ++i) {
+      const Node& child = this->_nodes[children[i]];
+      hit[i] = rayIntersectsBox(
+                   origin,
+                   direction,
+                   child.minimum,
+                   child.maximum,
+                   tNear[i]) &&
+               (tClosest == -1.0 || tNear[i] <= tClosest);
+    }
+
+    if (hit[0] && hit[1]) {
+      const size_t nearer = tNear[0] <= tNear[1] ? 0 : 1;
+      stack[stackSize++] = children[1 - nearer];
+      stack[stackSize++] = children[nearer];
+    } else if (hit[0]) {
+      stack[stackSize++] = children[0];
+    } else if (hit[1]) {
+      stack[stackSize++] = children[1];
+    }
+  }
+
+  return true;
+}
+
+int64_t GltfTriangleBvh::getSizeBytes() const noexcept {
+  int64_t bytes = int64_t(sizeof(GltfTriangleBvh));
+  bytes += int64_t(this->_meshOffsets.capacity() * sizeof(size_t));
+  bytes += int64_t(this->_primitives.capacity() * sizeof(Primitive));
+  bytes += int64_t(this->_nodes.capacity() * sizeof(Node));
+  bytes += int64_t(this->_triangles.capacity() * sizeof(Triangle));
+  for (const Primitive& primitive : this->_primitives) {
+    for (const std::string& warning : primitive.warnings) {
+      bytes += int64_t(sizeof(std::string) + warning.capacity());
+    }
+  }
+  return bytes;
+}
+
+void GltfTriangleBvh::buildPrimitive(
+    Primitive& primitive,
+    std::vector<Triangle>&& triangles) {
+  primitive.isBuilt = true;
+  if (triangles.empty()) {
+    return;
+  }
+
+  const size_t triangleOffset = this->_triangles.size();
+  primitive.rootNode =
+      int64_t(this->buildNode(triangles, triangleOffset, 0, triangles.size()));
+  this->_triangles.insert(
+      this->_triangles.end(),
+      triangles.begin(),
+      triangles.end());
+}
+
+uint32_t GltfTriangleBvh::buildNode(
+    std::vector<Triangle>& triangles,
+    size_t triangleOffset,
+    size_t begin,
+    size_t end) {
+  glm::vec3 minimum(std::numeric_limits<float>::max());
+  glm::vec3 maximum(std::numeric_limits<float>::lowest());
+  glm::vec3 centroidMinimum(std::numeric_limits<float>::max());
+  glm::vec3 centroidMaximum(std::numeric_limits<float>::lowest());
+
+  for (size_t i = begin; i < end; ++i) {
+    const Triangle& triangle = triangles[i];
+    minimum = glm::min(
+        minimum,
+        glm::min(triangle.p0, glm::min(triangle.p1, triangle.p2)));
+    maximum = glm::max(
+        maximum,
+        glm::max(triangle.p0, glm::max(triangle.p1, triangle.p2)));
+
+    const glm::vec3 centroid = triangle.p0 + triangle.p1 + triangle.p2;
+    centroidMinimum = glm::min(centroidMinimum, centroid);
+    centroidMaximum = glm::max(centroidMaximum, centroid);
+  }
+
+  // Pad the box slightly so that rounding in the ray-box test can't reject a
+  // triangle that the ray-triangle test would accept.
+  const glm::vec3 extent = maximum - minimum;
+  const float padding = 1e-5f * std::max({extent.x, extent.y, extent.z});
+  minimum -= padding;
+  maximum += padding;
+
+  const uint32_t nodeIndex = uint32_t(this->_nodes.size());
+  this->_nodes.emplace_back(Node{minimum, maximum, 0, 0});
+
+  const glm::vec3 centroidExtent = centroidMaximum - centroidMinimum;
+  glm::length_t axis = 0;
+  if (centroidExtent.y > centroidExtent[axis]) {
+    axis = 1;
+  }
+  if (centroidExtent.z > centroidExtent[axis]) {
+    axis = 2;
+  }
+
+  // Make a leaf when there are few triangles, or when they can't be told
+  // apart by their centroids.
+  if (end - begin <= maximumLeafTriangles || centroidExtent[axis] <= 0.0f) {
+    Node& node = this->_nodes[nodeIndex];
+    node.index = uint32_t(triangleOffset + begin);
+    node.triangleCount = uint32_t(end - begin);
+    return nodeIndex;
+  }
+
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(
+      triangles.begin() + ptrdiff_t(begin),
+      triangles.begin() + ptrdiff_t(middle),
+      triangles.begin() + ptrdiff_t(end),
+      [axis](const Triangle& a, const Triangle& b) {
+        return (a.p0[axis] + a.p1[axis] + a.p2[axis]) <
+               (b.p0[axis] + b.p1[axis] + b.p2[axis]);
+      });
+
+  this->buildNode(triangles, triangleOffset, begin, middle);
+  const uint32_t secondChild =
+      this->buildNode(triangles, triangleOffset, middle, end);
+  this->_nodes[nodeIndex].index = secondChild;
+  return nodeIndex;
+}
+
+} // namespace CesiumGltfContent
@@ -1,3 +1,5 @@
+#include "createPositionView.h"
+
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/IntersectionTests.h>
 #include <CesiumGeometry/Ray.h>
@@ -32,6 +34,7 @@
 #include <CesiumGltf/PropertyTexture.h>
 #include <CesiumGltf/Skin.h>
 #include <CesiumGltf/Texture.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 #include <CesiumGltfContent/SkirtMeshMetadata.h>
 #include <CesiumUtility/Assert.h>
@@ -55,6 +58,7 @@
 #include <cstring>
 #include <limits>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -263,20 +267,35 @@ GltfUtilities::computeBoundingRegion(
           vertexEnd = positionView.size();
         }
 
-        for (int64_t i = vertexBegin; i < vertexEnd; ++i) {
-          // Get the ECEF position
-          const glm::vec3 position = positionView[i];
-          const glm::dvec3 positionEcef =
-              glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
-
-          // Convert it to cartographic
-          std::optional<CesiumGeospatial::Cartographic> cartographic =
-              ellipsoid.cartesianToCartographic(positionEcef);
-          if (!cartographic) {
-            continue;
+        // Convert the positions to cartographic a chunk at a time, which is
+        // much faster than converting them one by one.
+        const int64_t chunkSize = 256;
+        std::vector<glm::dvec3> positionsEcef(size_t(chunkSize));
+        std::vector<std::optional<CesiumGeospatial::Cartographic>>
+            cartographics(size_t(chunkSize));
+
+        for (int64_t chunkBegin = vertexBegin; chunkBegin < vertexEnd;
+             chunkBegin += chunkSize) {
+          const size_t count =
+              size_t(std::min(chunkSize, vertexEnd - chunkBegin));
+
+          // Get the ECEF positions
+          for (size_t i = 0; i < count; ++i) {
+            const glm::vec3 position = positionView[chunkBegin + int64_t(i)];
+            positionsEcef[i] =
+                glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
           }
 
-          computedBounds.expandToIncludePosition(*cartographic);
+          // Convert them to cartographic
+          ellipsoid.cartesianToCartographic(
+              std::span<const glm::dvec3>(positionsEcef).first(count),
+              cartographics);
+
+          for (size_t i = 0; i < count; ++i) {
+            if (cartographics[i]) {
+              computedBounds.expandToIncludePosition(*cartographics[i]);
+            }
+          }
         }
       });
 
@@ -1251,46 +1270,17 @@ void GltfUtilities::compactBuffer(
 
 namespace {
 
-template <typename TCallback>
-std::invoke_result_t<TCallback, AccessorView<AccessorTypes::VEC3<float>>>
-createPositionView(
-    const Model& model,
-    const Accessor& accessor,
-    TCallback&& callback) {
-  assert(accessor.type == Accessor::Type::VEC3);
-
-  switch (accessor.componentType) {
-  case Accessor::ComponentType::BYTE:
-    return callback(AccessorView<AccessorTypes::VEC3<int8_t>>(model, accessor));
-  case Accessor::ComponentType::UNSIGNED_BYTE:
-    return callback(
-        AccessorView<AccessorTypes::VEC3<uint8_t>>(model, accessor));
-  case Accessor::ComponentType::SHORT:
-    return callback(
-        AccessorView<AccessorTypes::VEC3<int16_t>>(model, accessor));
-  case Accessor::ComponentType::UNSIGNED_SHORT:
-    return callback(
-        AccessorView<AccessorTypes::VEC3<uint16_t>>(model, accessor));
-  case Accessor::ComponentType::UNSIGNED_INT:
-    return callback(
-        AccessorView<AccessorTypes::VEC3<uint32_t>>(model, accessor));
-  case Accessor::ComponentType::FLOAT:
-    return callback(AccessorView<AccessorTypes::VEC3<float>>(model, accessor));
-  default:
-    return callback(AccessorView<AccessorTypes::VEC3<float>>(
-        AccessorViewStatus::InvalidComponentType));
-  }
-}
-
 std::optional<glm::dvec3> intersectRayScenePrimitive(
     const CesiumGeometry::Ray& ray,
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
     const Accessor& positionAccessor,
-    const glm::dmat4x4& primitiveToWorld,
+    const glm::dmat4x4& worldToPrimitive,
     bool cullBackFaces,
+    const GltfTriangleBvh* pTriangleBvh,
+    int32_t meshId,
+    int32_t primitiveId,
     std::vector<std::string>& warnings) {
-  glm::dmat4x4 worldToPrimitive = glm::inverse(primitiveToWorld);
   CesiumGeometry::Ray transformedRay = ray.transform(worldToPrimitive);
 
   // Ignore primitive if we have an AABB from the accessor min/max and the ray
@@ -1315,6 +1305,18 @@ std::optional<glm::dvec3> intersectRayScenePrimitive(
 
   double tClosest = -1.0;
 
+  if (pTriangleBvh && pTriangleBvh->intersectRayPrimitive(
+                          meshId,
+                          primitiveId,
+                          transformedRay,
+                          cullBackFaces,
+                          tClosest,
+                          warnings)) {
+    if (tClosest == -1.0)
+      return std::optional<glm::dvec3>();
+    return transformedRay.pointFromDistance(tClosest);
+  }
+
   // Support all variations of position component types
   //
   // From the glTF spec...
@@ -1417,28 +1419,58 @@ GltfUtilities::IntersectResult GltfUtilities::intersectRayGltfModel(
     const CesiumGeometry::Ray& ray,
     const CesiumGltf::Model& gltf,
     bool cullBackFaces,
-    const glm::dmat4x4& gltfTransform) {
+    const glm::dmat4x4& gltfTransform,
+    const GltfTriangleBvh* pTriangleBvh) {
+  std::vector<IntersectResult> results = intersectRaysGltfModel(
+      std::span<const CesiumGeometry::Ray>(&ray, 1),
+      gltf,
+      cullBackFaces,
+      gltfTransform,
+      pTriangleBvh);
+  return std::move(results[0]);
+}
+
+std::vector<GltfUtilities::IntersectResult>
+GltfUtilities::intersectRaysGltfModel(
+    std::span<const CesiumGeometry::Ray> rays,
+    const CesiumGltf::Model& gltf,
+    bool cullBackFaces,
+    const glm::dmat4x4& gltfTransform,
+    const GltfTriangleBvh* pTriangleBvh) {
+  std::vector<IntersectResult> results(rays.size());
+
   // We can't currently intersect a ray with a model if the model has any funny
   // business with its vertex positions or if it uses instancing.
   for (const std::string& unsupportedExtension :
        intersectGltfUnsupportedExtensions) {
     if (gltf.isExtensionRequired(unsupportedExtension)) {
-      return IntersectResult{
-          std::nullopt,
-          {fmt::format(
-              "Cannot intersect a ray with a glTF model with the {} extension.",
-              unsupportedExtension)}};
+      for (IntersectResult& result : results) {
+        result.warnings.emplace_back(fmt::format(
+            "Cannot intersect a ray with a glTF model with the {} extension.",
+            unsupportedExtension));
+      }
+      return results;
     }
   }
 
   glm::dmat4x4 rootTransform = applyRtcCenter(gltf, gltfTransform);
   rootTransform = applyGltfUpAxisTransform(gltf, rootTransform);
 
-  IntersectResult result;
+  // Warnings about a primitive itself apply to every ray.
+  const auto addWarning = [&results](const std::string& warning) {
+    for (IntersectResult& result : results) {
+      result.warnings.emplace_back(warning);
+    }
+  };
 
   gltf.forEachPrimitiveInScene(
       -1,
-      [ray, cullBackFaces, rootTransform, &result](
+      [rays,
+       cullBackFaces,
+       rootTransform,
+       pTriangleBvh,
+       &results,
+       &addWarning](
           const CesiumGltf::Model& model,
           const CesiumGltf::Node& /*node*/,
           const CesiumGltf::Mesh& mesh,
@@ -1455,92 +1487,89 @@ GltfUtilities::IntersectResult GltfUtilities::intersectRayGltfModel(
         // Skip primitives that can't access positions
         auto positionAccessorIt = primitive.attributes.find("POSITION");
         if (positionAccessorIt == primitive.attributes.end()) {
-          result.warnings.emplace_back(
-              "Skipping mesh without a position attribute");
+          addWarning("Skipping mesh without a position attribute");
           return;
         }
         int positionAccessorID = positionAccessorIt->second;
         const Accessor* pPositionAccessor =
             Model::getSafe(&model.accessors, positionAccessorID);
         if (!pPositionAccessor) {
-          result.warnings.emplace_back(
-              "Skipping mesh with an invalid position accessor id");
+          addWarning("Skipping mesh with an invalid position accessor id");
           return;
         }
 
         // From the glTF spec, the POSITION accessor must use VEC3
         // But we should still protect against malformed gltfs
         if (pPositionAccessor->type != AccessorSpec::Type::VEC3) {
-          result.warnings.emplace_back(
-              "Skipping mesh with a non-vec3 position accessor");
+          addWarning("Skipping mesh with a non-vec3 position accessor");
           return;
         }
 
-        glm::dmat4x4 primitiveToWorld = rootTransform * nodeTransform;
-
-        std::optional<glm::dvec3> primitiveHitPoint;
-        primitiveHitPoint = intersectRayScenePrimitive(
-            ray,
-            model,
-            primitive,
-            *pPositionAccessor,
-            primitiveToWorld,
-            cullBackFaces,
-            result.warnings);
-
-        if (!primitiveHitPoint.has_value())
-          return;
+        const glm::dmat4x4 primitiveToWorld = rootTransform * nodeTransform;
+        const glm::dmat4x4 worldToPrimitive = glm::inverse(primitiveToWorld);
 
-        // We have a hit, determine if it's the closest one
-
-        // Normalize the homogeneous coordinates
-        // Ex. transformed by projection matrx
-        glm::dvec4 homogeneousWorldPoint =
-            primitiveToWorld * glm::dvec4(*primitiveHitPoint, 1.0);
-        bool needsWDivide =
-            homogeneousWorldPoint.w != 1.0 && homogeneousWorldPoint.w != 0.0;
-        if (needsWDivide) {
-          homogeneousWorldPoint.x /= homogeneousWorldPoint.w;
-          homogeneousWorldPoint.y /= homogeneousWorldPoint.w;
-          homogeneousWorldPoint.z /= homogeneousWorldPoint.w;
-        }
-        glm::dvec3 worldPoint(
-            homogeneousWorldPoint.x,
-            homogeneousWorldPoint.y,
-            homogeneousWorldPoint.z);
-
-        glm::dvec3 rayToWorldPoint = worldPoint - ray.getOrigin();
-        double rayToWorldPointDistanceSq =
-            glm::dot(rayToWorldPoint, rayToWorldPoint);
-
-        // Use in result if it's first
         int32_t meshId = static_cast<int32_t>(&mesh - &model.meshes[0]);
         int32_t primitiveId =
             static_cast<int32_t>(&primitive - &mesh.primitives[0]);
 
-        if (!result.hit.has_value()) {
-          result.hit = RayGltfHit{
-              std::move(*primitiveHitPoint),
-              std::move(primitiveToWorld),
-              std::move(worldPoint),
-              rayToWorldPointDistanceSq,
+        for (size_t i = 0; i < rays.size(); ++i) {
+          const CesiumGeometry::Ray& ray = rays[i];
+          IntersectResult& result = results[i];
+
+          std::optional<glm::dvec3> primitiveHitPoint;
+          primitiveHitPoint = intersectRayScenePrimitive(
+              ray,
+              model,
+              primitive,
+              *pPositionAccessor,
+              worldToPrimitive,
+              cullBackFaces,
+              pTriangleBvh,
               meshId,
-              primitiveId};
-          return;
-        }
+              primitiveId,
+              result.warnings);
 
-        // Use in result if it's closer
-        if (rayToWorldPointDistanceSq < result.hit->rayToWorldPointDistanceSq) {
-          result.hit->primitivePoint = std::move(*primitiveHitPoint);
-          result.hit->primitiveToWorld = std::move(primitiveToWorld);
-          result.hit->worldPoint = std::move(worldPoint);
-          result.hit->rayToWorldPointDistanceSq = rayToWorldPointDistanceSq;
-          result.hit->meshId = meshId;
-          result.hit->primitiveId = primitiveId;
+          if (!primitiveHitPoint.has_value())
+            continue;
+
+          // We have a hit, determine if it's the closest one
+
+          // Normalize the homogeneous coordinates
+          // Ex. transformed by projection matrx
+          glm::dvec4 homogeneousWorldPoint =
+              primitiveToWorld * glm::dvec4(*primitiveHitPoint, 1.0);
+          bool needsWDivide =
+              homogeneousWorldPoint.w != 1.0 && homogeneousWorldPoint.w != 0.0;
+          if (needsWDivide) {
+            homogeneousWorldPoint.x /= homogeneousWorldPoint.w;
+            homogeneousWorldPoint.y /= homogeneousWorldPoint.w;
+            homogeneousWorldPoint.z /= homogeneousWorldPoint.w;
+          }
+          glm::dvec3 worldPoint(
+              homogeneousWorldPoint.x,
+              homogeneousWorldPoint.y,
+              homogeneousWorldPoint.z);
+
+          glm::dvec3 rayToWorldPoint = worldPoint - ray.getOrigin();
+          double rayToWorldPointDistanceSq =
+              glm::dot(rayToWorldPoint, rayToWorldPoint);
+
+          // Use in result if it's first, or if it's closer
+          if (!result.hit.has_value() ||
+              rayToWorldPointDistanceSq <
+                  result.hit->rayToWorldPointDistanceSq) {
+            result.hit = RayGltfHit{
+                std::move(*primitiveHitPoint),
+                primitiveToWorld,
+                std::move(worldPoint),
+                rayToWorldPointDistanceSq,
+                meshId,
+                primitiveId};
+          }
         }
       });
 
-  return result;
+  return results;
 }
 
 } // namespace CesiumGltfContent
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Model.h>
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+namespace CesiumGltfContent {
+
+/**
+ * @brief Creates an {@link CesiumGltf::AccessorView} for a `VEC3` position
+ * accessor with any component type, and passes it to the callback.
+ *
+ * If the component type is not valid for positions, the view passed to the
+ * callback has the status `InvalidComponentType`.
+ */
+template <typename TCallback>
+std::invoke_result_t<
+    TCallback,
+    CesiumGltf::AccessorView<CesiumGltf::AccessorTypes::VEC3<float>>>
+createPositionView(
+    const CesiumGltf::Model& model,
+    const CesiumGltf::Accessor& accessor,
+    TCallback&& callback) {
+  using namespace CesiumGltf;
+
+  assert(accessor.type == Accessor::Type::VEC3);
+
+  switch (accessor.componentType) {
+  case Accessor::ComponentType::BYTE:
+    return callback(AccessorView<AccessorTypes::VEC3<int8_t>>(model, accessor));
+  case Accessor::ComponentType::UNSIGNED_BYTE:
+    return callback(
+        AccessorView<AccessorTypes::VEC3<uint8_t>>(model, accessor));
+  case Accessor::ComponentType::SHORT:
+    return callback(
+        AccessorView<AccessorTypes::VEC3<int16_t>>(model, accessor));
+  case Accessor::ComponentType::UNSIGNED_SHORT:
+    return callback(
+        AccessorView<AccessorTypes::VEC3<uint16_t>>(model, accessor));
+  case Accessor::ComponentType::UNSIGNED_INT:
+    return callback(
+        AccessorView<AccessorTypes::VEC3<uint32_t>>(model, accessor));
+  case Accessor::ComponentType::FLOAT:
+    return callback(AccessorView<AccessorTypes::VEC3<float>>(model, accessor));
+  default:
+    return callback(AccessorView<AccessorTypes::VEC3<float>>(
+        AccessorViewStatus::InvalidComponentType));
+  }
+}
+
+} // namespace CesiumGltfContent
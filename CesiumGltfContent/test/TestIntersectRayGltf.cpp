@@ -3,6 +3,7 @@
 #include <CesiumGltf/Accessor.h>
 #include <CesiumGltf/Mesh.h>
 #include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltfContent/GltfTriangleBvh.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumNativeTests/readFile.h>
@@ -12,11 +13,13 @@
 #include <glm/common.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/vector_double3.hpp>
+#include <glm/geometric.hpp>
 #include <glm/vector_relational.hpp>
 
 #include <cstddef>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 using namespace CesiumUtility;
 using namespace CesiumGltf;
@@ -230,3 +233,122 @@ TEST_CASE("GltfUtilities::intersectRayGltfModel") {
   checkBadUnitCube("cubeInvalidVertCount.glb", false);
   checkBadUnitCube("cubeSomeBadIndices.glb", true);
 }
+
+namespace {
+void checkBvhMatchesBruteForce(const std::string& testModelName) {
+  GltfReader reader;
+  Model testModel =
+      *reader
+           .readGltf(readFile(
+               std::filesystem::path(CesiumGltfContent_TEST_DATA_DIR) /
+               testModelName))
+           .model;
+
+  const GltfTriangleBvh bvh(testModel);
+  CHECK(bvh.getSizeBytes() > 0);
+
+  glm::dmat4x4 transform(1.0);
+  transform[3] = glm::dvec4(10.0, -20.0, 30.0, 1.0);
+
+  const std::vector<glm::dvec3> directions{
+      glm::dvec3(0.0, 0.0, -1.0),
+      glm::dvec3(0.0, 0.0, 1.0),
+      glm::dvec3(1.0, 0.0, 0.0),
+      glm::normalize(glm::dvec3(0.3, -0.2, -1.0)),
+      glm::normalize(glm::dvec3(-1.0, 1.0, 1.0))};
+
+  for (const glm::dvec3& direction : directions) {
+    for (double x = -0.7; x <= 0.7; x += 0.1) {
+      for (double y = -0.7; y <= 0.7; y += 0.1) {
+        const glm::dvec3 target =
+            glm::dvec3(transform[3]) + glm::dvec3(x, y, 0.5 * (x - y));
+        const Ray ray(target - 3.0 * direction, direction);
+
+        for (const bool cullBackFaces : {true, false}) {
+          GltfUtilities::IntersectResult expected =
+              GltfUtilities::intersectRayGltfModel(
+                  ray,
+                  testModel,
+                  cullBackFaces,
+                  transform);
+          GltfUtilities::IntersectResult actual =
+              GltfUtilities::intersectRayGltfModel(
+                  ray,
+                  testModel,
+                  cullBackFaces,
+                  transform,
+                  &bvh);
+
+          CHECK(actual.warnings == expected.warnings);
+          REQUIRE(actual.hit.has_value() == expected.hit.has_value());
+          if (expected.hit) {
+            CHECK(actual.hit->worldPoint == expected.hit->worldPoint);
+            CHECK(actual.hit->meshId == expected.hit->meshId);
+            CHECK(actual.hit->primitiveId == expected.hit->primitiveId);
+          }
+        }
+      }
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("GltfUtilities::intersectRayGltfModel with a GltfTriangleBvh") {
+  checkBvhMatchesBruteForce("cube.glb");
+  checkBvhMatchesBruteForce("cubeIndexed.glb");
+  checkBvhMatchesBruteForce("cubeStrip.glb");
+  checkBvhMatchesBruteForce("cubeStripIndexed.glb");
+  checkBvhMatchesBruteForce("cubeFan.glb");
+  checkBvhMatchesBruteForce("cubeFanIndexed.glb");
+  checkBvhMatchesBruteForce("cubeQuantized.glb");
+  checkBvhMatchesBruteForce("cubeTranslated.glb");
+  checkBvhMatchesBruteForce("cubeInvalidVertCount.glb");
+  checkBvhMatchesBruteForce("cubeSomeBadIndices.glb");
+}
+
+TEST_CASE("GltfUtilities::intersectRaysGltfModel") {
+  GltfReader reader;
+  Model testModel =
+      *reader
+           .readGltf(readFile(
+               std::filesystem::path(CesiumGltfContent_TEST_DATA_DIR) /
+               "cubeTranslated.glb"))
+           .model;
+  const GltfTriangleBvh bvh(testModel);
+
+  std::vector<Ray> rays;
+  for (double x = -1.0; x <= 1.0; x += 0.25) {
+    for (double y = -1.0; y <= 1.0; y += 0.25) {
+      rays.emplace_back(glm::dvec3(x, y, 2.0), glm::dvec3(0.0, 0.0, -1.0));
+    }
+  }
+
+  const std::vector<const GltfTriangleBvh*> triangleBvhs{&bvh, nullptr};
+  for (const GltfTriangleBvh* pTriangleBvh : triangleBvhs) {
+    std::vector<GltfUtilities::IntersectResult> results =
+        GltfUtilities::intersectRaysGltfModel(
+            rays,
+            testModel,
+            true,
+            glm::dmat4(1.0),
+            pTriangleBvh);
+    REQUIRE(results.size() == rays.size());
+
+    for (size_t i = 0; i < rays.size(); ++i) {
+      GltfUtilities::IntersectResult expected =
+          GltfUtilities::intersectRayGltfModel(
+              rays[i],
+              testModel,
+              true,
+              glm::dmat4(1.0),
+              pTriangleBvh);
+      CHECK(results[i].warnings == expected.warnings);
+      REQUIRE(results[i].hit.has_value() == expected.hit.has_value());
+      if (expected.hit) {
+        CHECK(results[i].hit->worldPoint == expected.hit->worldPoint);
+        CHECK(results[i].hit->meshId == expected.hit->meshId);
+        CHECK(results[i].hit->primitiveId == expected.hit->primitiveId);
+      }
+    }
+  }
+}
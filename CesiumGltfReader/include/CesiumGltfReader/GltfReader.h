@@ -13,6 +13,7 @@
 #include <CesiumJsonReader/IExtensionJsonHandler.h>
 #include <CesiumJsonReader/JsonReaderOptions.h>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -108,6 +109,37 @@ struct CESIUMGLTFREADER_API GltfReaderOptions {
    */
   CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets;
 
+  /**
+   * @brief The gpu-compressed pixel format to compress decoded images into,
+   * or GpuCompressedPixelFormat::NONE to leave them uncompressed.
+   *
+   * Images that are decoded into raw pixels, such as JPEGs and PNGs, are
+   * compressed with {@link ImageDecoder::compressImage} right after they are
+   * decoded, along with a full chain of mipmaps. Images that are already
+   * gpu-compressed, such as transcoded KTX v2 images, are not affected.
+   */
+  CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat =
+      CesiumGltf::GpuCompressedPixelFormat::NONE;
+
+  /**
+   * @brief The largest width or height, in pixels, of decoded images, or 0 to
+   * decode images at their full size.
+   *
+   * Larger images are halved in size until they fit. JPEGs are scaled while
+   * they are decoded, so this also makes decoding them faster. See
+   * {@link ImageDecoder::readImage}.
+   */
+  int32_t maximumImageDimension = 0;
+
+  /**
+   * @brief The pool to allocate the pixel data of decoded images and the data
+   * of glTF buffers from, or nullptr to allocate them normally.
+   *
+   * The storage is returned to the pool when the images and buffers are
+   * destroyed, so that loading the next model can reuse it.
+   */
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pByteBufferPool;
+
   /**
    * The shared asset system that will be used to store all of the shared assets
    * that might appear in this glTF.
@@ -120,6 +152,19 @@ struct CESIUMGLTFREADER_API GltfReaderOptions {
    * be properly resolved. If false, any external schemas will be ignored.
    */
   bool resolveExternalStructuralMetadata = true;
+
+  /**
+   * @brief Whether the embedded images and Draco-compressed primitives of a
+   * model are decoded in parallel on the worker threads of the
+   * {@link CesiumAsync::AsyncSystem}.
+   *
+   * This only affects the methods that take an `AsyncSystem`, such as
+   * {@link GltfReader::loadGltf}. Each image and each primitive is decoded by
+   * its own worker thread task, and the results are added to the model in the
+   * same order as when this is false. The remaining steps, such as decoding
+   * data URLs and `EXT_meshopt_compression`, still happen one after another.
+   */
+  bool parallelPostprocessing = false;
 };
 
 /**
@@ -153,6 +198,59 @@ public:
       const std::span<const std::byte>& data,
       const GltfReaderOptions& options = GltfReaderOptions()) const;
 
+  /**
+   * @brief Reads a glTF or binary glTF (GLB) from a buffer that is owned by
+   * the caller and no longer needed.
+   *
+   * For a GLB, the binary chunk is adopted as the data of the first buffer in
+   * the model instead of being copied out, so the GLB is never held in memory
+   * twice.
+   *
+   * @param data The buffer from which to read the glTF. Its contents are
+   * unspecified after this method returns.
+   * @param options Options for how to read the glTF.
+   * @return The result of reading the glTF.
+   */
+  GltfReaderResult readGltf(
+      std::vector<std::byte>&& data,
+      const GltfReaderOptions& options = GltfReaderOptions()) const;
+
+  /**
+   * @brief Reads a glTF or binary glTF (GLB) from a buffer, post-processing
+   * it with the worker threads of the given async system.
+   *
+   * The glTF is parsed in the calling thread. When
+   * {@link GltfReaderOptions::parallelPostprocessing} is false, it is also
+   * post-processed there and the returned future is already resolved.
+   *
+   * @param asyncSystem The async system whose worker threads decode the
+   * embedded images and Draco-compressed primitives.
+   * @param data The buffer from which to read the glTF.
+   * @param options Options for how to read the glTF.
+   * @return A future that resolves to the result of reading the glTF.
+   */
+  CesiumAsync::Future<GltfReaderResult> readGltf(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::span<const std::byte>& data,
+      const GltfReaderOptions& options = GltfReaderOptions()) const;
+
+  /**
+   * @brief Reads a glTF or binary glTF (GLB) from a buffer that is owned by
+   * the caller and no longer needed, post-processing it with the worker
+   * threads of the given async system.
+   *
+   * @param asyncSystem The async system whose worker threads decode the
+   * embedded images and Draco-compressed primitives.
+   * @param data The buffer from which to read the glTF. Its contents are
+   * unspecified after this method returns.
+   * @param options Options for how to read the glTF.
+   * @return A future that resolves to the result of reading the glTF.
+   */
+  CesiumAsync::Future<GltfReaderResult> readGltf(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      std::vector<std::byte>&& data,
+      const GltfReaderOptions& options = GltfReaderOptions()) const;
+
   /**
    * @brief Reads a glTF or binary glTF file from a URL and resolves external
    * buffers and images.
@@ -178,8 +276,24 @@ public:
    * @param readGltf The result of reading the glTF.
    * @param options The options to use in post-processing.
    */
-  void
-  postprocessGltf(GltfReaderResult& readGltf, const GltfReaderOptions& options);
+  void postprocessGltf(
+      GltfReaderResult& readGltf,
+      const GltfReaderOptions& options) const;
+
+  /**
+   * @brief Performs post-load processing on a glTF, decoding its embedded
+   * images and Draco-compressed primitives in parallel when
+   * {@link GltfReaderOptions::parallelPostprocessing} is true.
+   *
+   * @param asyncSystem The async system whose worker threads do the decoding.
+   * @param readGltf The result of reading the glTF.
+   * @param options The options to use in post-processing.
+   * @return A future that resolves to the post-processed result.
+   */
+  CesiumAsync::Future<GltfReaderResult> postprocessGltf(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      GltfReaderResult&& readGltf,
+      const GltfReaderOptions& options) const;
 
   /**
    * @brief Accepts the result of {@link readGltf} and resolves any remaining
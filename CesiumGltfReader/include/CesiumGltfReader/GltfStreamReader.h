@@ -0,0 +1,101 @@
+#pragma once
+
+#include <CesiumGltfReader/GltfReader.h>
+#include <CesiumGltfReader/Library.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CesiumGltfReader {
+
+/**
+ * @brief Reads a binary glTF (GLB) incrementally, as its bytes arrive.
+ *
+ * Unlike {@link GltfReader::readGltf}, this never needs the complete GLB in
+ * memory. The JSON chunk is parsed as soon as it has been received, and the
+ * binary chunk is written directly into the data of the first buffer of the
+ * model. When {@link GltfReaderOptions::decodeEmbeddedImages} is true, each
+ * image stored in the binary chunk is decoded as soon as all of its bytes have
+ * arrived, while the rest of the chunk is still being received.
+ *
+ * The remaining post-processing, such as Draco decoding, happens in
+ * {@link finish}.
+ *
+ * If the data turns out not to be a GLB, it is collected and read as a JSON
+ * glTF when {@link finish} is called.
+ *
+ * An instance may only be used by one thread at a time.
+ */
+class CESIUMGLTFREADER_API GltfStreamReader {
+public:
+  /**
+   * @brief Constructs a new instance.
+   *
+   * @param reader The reader that provides the JSON extensions and
+   * post-processing. It must outlive this instance.
+   * @param options Options for how to read the glTF.
+   */
+  GltfStreamReader(
+      const GltfReader& reader,
+      const GltfReaderOptions& options = GltfReaderOptions());
+
+  /**
+   * @brief Reads the next bytes of the glTF.
+   *
+   * @param data The bytes that follow those passed to the previous call. They
+   * are copied as needed, so they do not need to outlive this call.
+   */
+  void append(const std::span<const std::byte>& data);
+
+  /**
+   * @brief Gets the number of bytes that have been passed to {@link append}.
+   */
+  uint64_t getBytesReceived() const noexcept { return this->_bytesReceived; }
+
+  /**
+   * @brief Completes reading the glTF after all of its bytes have been passed
+   * to {@link append}.
+   *
+   * This may only be called once.
+   *
+   * @return The result of reading the glTF.
+   */
+  GltfReaderResult finish();
+
+private:
+  enum class State {
+    Header,
+    JsonChunkHeader,
+    JsonChunk,
+    BinaryChunkHeader,
+    BinaryChunk,
+    Json,
+    Done
+  };
+
+  bool fill(std::span<const std::byte>& data, size_t size);
+  void readHeader();
+  void readJsonChunkHeader();
+  void readJsonChunk();
+  void readBinaryChunkHeader();
+  bool readBinaryChunk(std::span<const std::byte>& data);
+  void fail(std::string&& error);
+  void decodeReadyImages();
+
+  const GltfReader& _reader;
+  GltfReaderOptions _options;
+  State _state;
+  std::vector<std::byte> _pending;
+  uint64_t _bytesReceived;
+  uint64_t _glbLength;
+  uint64_t _chunkStart;
+  uint64_t _chunkLength;
+  uint64_t _chunkBytesRead;
+  GltfReaderResult _result;
+  std::vector<size_t> _pendingImages;
+};
+
+} // namespace CesiumGltfReader
@@ -2,8 +2,11 @@
 
 #include <CesiumGltf/ImageAsset.h>
 #include <CesiumGltfReader/Library.h>
+#include <CesiumUtility/ByteBufferPool.h>
 #include <CesiumUtility/IntrusivePointer.h>
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
@@ -45,15 +48,31 @@ public:
    * The [stb_image](https://github.com/nothings/stb) library is used to decode
    * images in `JPG`, `PNG`, `TGA`, `BMP`, `PSD`, `GIF`, `HDR`, or `PIC` format.
    *
+   * When `maximumDimension` is greater than zero, images that are decoded to
+   * raw pixels are halved in size until neither their width nor their height
+   * is larger than it. JPEGs decoded by libjpeg-turbo are scaled by up to 1/8
+   * while they are decoded, which is much faster than decoding them at full
+   * size. Other images are decoded at full size and then resized. KTX v2
+   * images that are transcoded to a GPU compressed format, or that have
+   * mipmaps, are never resized.
+   *
    * @param data The buffer from which to read the image.
    * @param ktx2TranscodeTargets The compression format to transcode
    * KTX v2 textures into. If this is std::nullopt, KTX v2 textures will be
    * fully decompressed into raw pixels.
+   * @param maximumDimension The largest width or height, in pixels, of the
+   * decoded image, or 0 to decode the image at its full size.
+   * @param pPixelDataPool The pool to allocate the pixel data of the image
+   * from, and to return it to when the image is destroyed. If nullptr, the
+   * pixel data is allocated normally.
    * @return The result of reading the image.
    */
   static ImageReaderResult readImage(
       const std::span<const std::byte>& data,
-      const CesiumGltf::Ktx2TranscodeTargets& ktx2TranscodeTargets);
+      const CesiumGltf::Ktx2TranscodeTargets& ktx2TranscodeTargets,
+      int32_t maximumDimension = 0,
+      const std::shared_ptr<CesiumUtility::ByteBufferPool>& pPixelDataPool =
+          nullptr);
 
   /**
    * @brief Generate mipmaps for this image.
@@ -61,11 +80,48 @@ public:
    * Does nothing if mipmaps already exist or the compressedPixelFormat is not
    * GpuCompressedPixelFormat::NONE.
    *
-   * @param image The image to generate mipmaps for.   *
+   * Each mip level of an 8-bit image whose dimensions are even, or one, is
+   * built by averaging each 2x2 block of the previous level, which is much
+   * faster than general resampling. This is the case for every level of a
+   * power-of-two image. Other levels are resampled with
+   * [stb_image_resize2](https://github.com/nothings/stb).
+   *
+   * @param image The image to generate mipmaps for.
+   * @param gammaCorrect Whether the color channels of the image are sRGB
+   * encoded and must be averaged in linear space. The alpha channel of
+   * two- and four-channel images is always averaged linearly.
    * @return A string describing the error, if unable to generate mipmaps.
    */
-  static std::optional<std::string>
-  generateMipMaps(CesiumGltf::ImageAsset& image);
+  static std::optional<std::string> generateMipMaps(
+      CesiumGltf::ImageAsset& image,
+      bool gammaCorrect = false);
+
+  /**
+   * @brief Compresses a decoded image into a GPU compressed pixel format.
+   *
+   * Mipmaps are generated first, if the image does not already have them, and
+   * every mip level is compressed. Edge blocks of mips that are smaller than,
+   * or not a multiple of, four pixels are padded by repeating the last row
+   * and column.
+   *
+   * The [stb_dxt](https://github.com/nothings/stb) library is used, so only
+   * {@link CesiumGltf::GpuCompressedPixelFormat::BC1_RGB} and
+   * {@link CesiumGltf::GpuCompressedPixelFormat::BC3_RGBA} are supported.
+   * `BC1_RGB` ignores the alpha channel.
+   *
+   * Does nothing if `format` is GpuCompressedPixelFormat::NONE, if the image
+   * is already compressed, or if its width or height is not a multiple of
+   * four, because graphics APIs require that of the base level of a block
+   * compressed texture.
+   *
+   * @param image The image to compress. It must have four 8-bit channels.
+   * @param format The format to compress the image into.
+   * @return A string describing the error, if unable to compress the image. The
+   * image is not modified in that case, except that it may have gained mipmaps.
+   */
+  static std::optional<std::string> compressImage(
+      CesiumGltf::ImageAsset& image,
+      CesiumGltf::GpuCompressedPixelFormat format);
 
   /**
    * @brief Resize an image, without validating the provided pointers or ranges.
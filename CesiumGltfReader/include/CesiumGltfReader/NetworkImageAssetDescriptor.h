@@ -7,6 +7,7 @@
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumUtility/Result.h>
 
+#include <cstdint>
 #include <memory>
 
 namespace CesiumAsync {
@@ -28,6 +29,19 @@ struct NetworkImageAssetDescriptor
    */
   CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets{};
 
+  /**
+   * @brief The GPU texture format to compress the image into after it is
+   * decoded, or GpuCompressedPixelFormat::NONE to leave it uncompressed.
+   */
+  CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat =
+      CesiumGltf::GpuCompressedPixelFormat::NONE;
+
+  /**
+   * @brief The largest width or height, in pixels, of the decoded image, or 0
+   * to decode it at its full size.
+   */
+  int32_t maximumImageDimension = 0;
+
   /**
    * @brief Determines if this descriptor is identical to another one.
    */
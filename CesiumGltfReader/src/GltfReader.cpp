@@ -2,6 +2,7 @@
 #include "applyKhrTextureTransform.h"
 #include "decodeDataUrls.h"
 #include "decodeDraco.h"
+#include "decodeEmbeddedImage.h"
 #include "decodeMeshOpt.h"
 #include "dequantizeMeshData.h"
 #include "registerReaderExtensions.h"
@@ -29,6 +30,7 @@
 #include <CesiumGltfReader/NetworkSchemaAssetDescriptor.h>
 #include <CesiumJsonReader/JsonReader.h>
 #include <CesiumJsonReader/JsonReaderOptions.h>
+#include <CesiumUtility/ByteBufferPool.h>
 #include <CesiumUtility/ErrorList.h>
 #include <CesiumUtility/Result.h>
 #include <CesiumUtility/Tracing.h>
@@ -114,9 +116,12 @@ std::string toMagicString(uint32_t i) {
   return stream.str();
 }
 
+// If `pStorage` is not nullptr, `data` must view its contents, and the GLB
+// binary chunk is moved out of it instead of copied.
 GltfReaderResult readBinaryGltf(
     const CesiumJsonReader::JsonReaderOptions& context,
-    const std::span<const std::byte>& data) {
+    const std::span<const std::byte>& data,
+    std::vector<std::byte>* pStorage = nullptr) {
   CESIUM_TRACE("CesiumGltfReader::GltfReader::readBinaryGltf");
 
   if (data.size() < sizeof(GlbHeader) + sizeof(ChunkHeader)) {
@@ -243,19 +248,27 @@ GltfReaderResult readBinaryGltf(
           std::to_string(binaryChunkSize) + ")");
     }
 
-    buffer.cesium.data = std::vector<std::byte>(
-        binaryChunk.begin(),
-        binaryChunk.begin() + (ptrdiff_t)buffer.byteLength);
+    if (pStorage) {
+      // Shift the binary chunk to the start of the storage and adopt it. This
+      // reuses the existing allocation rather than making a second one the
+      // size of the whole GLB.
+      const ptrdiff_t binaryOffset = binaryChunk.data() - pStorage->data();
+      pStorage->erase(pStorage->begin(), pStorage->begin() + binaryOffset);
+      pStorage->resize(size_t(buffer.byteLength));
+      buffer.cesium.data = std::move(*pStorage);
+    } else {
+      buffer.cesium.data = std::vector<std::byte>(
+          binaryChunk.begin(),
+          binaryChunk.begin() + (ptrdiff_t)buffer.byteLength);
+    }
   }
 
   return result;
 }
 
-void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
-  if (!readGltf.model) {
-    return;
-  }
-
+void beginPostprocess(
+    GltfReaderResult& readGltf,
+    const GltfReaderOptions& options) {
   Model& model = readGltf.model.value();
 
   auto extFeatureMetadataIter = std::find(
@@ -270,86 +283,92 @@ void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
         "constructed on its metadata.");
   }
 
+  if (options.pByteBufferPool) {
+    for (Buffer& buffer : model.buffers) {
+      buffer.cesium.pDataPool = options.pByteBufferPool;
+    }
+  }
+
   if (options.decodeDataUrls) {
     decodeDataUrls(readGltf, options);
   }
+}
 
-  if (options.decodeEmbeddedImages) {
-    CESIUM_TRACE("CesiumGltfReader::decodeEmbeddedImages");
-    for (Image& image : model.images) {
-      // Ignore external images for now.
-      if (image.uri) {
-        continue;
-      }
-
-      // Image has already been decoded
-      if (image.pAsset && !image.pAsset->pixelData.empty()) {
-        continue;
-      }
+/**
+ * @brief An image stored in a buffer of the model, and the result of decoding
+ * it once that has happened.
+ */
+struct EmbeddedImage {
+  Image* pImage;
+  std::span<const std::byte> data;
+  ImageReaderResult decoded;
+};
 
-      const BufferView& bufferView =
-          Model::getSafe(model.bufferViews, image.bufferView);
-      const Buffer& buffer = Model::getSafe(model.buffers, bufferView.buffer);
-
-      if (bufferView.byteOffset + bufferView.byteLength >
-          static_cast<int64_t>(buffer.cesium.data.size())) {
-        readGltf.warnings.emplace_back(
-            "Image bufferView's byte offset is " +
-            std::to_string(bufferView.byteOffset) + " and the byteLength is " +
-            std::to_string(bufferView.byteLength) + ", the result is " +
-            std::to_string(bufferView.byteOffset + bufferView.byteLength) +
-            ", which is more than the available " +
-            std::to_string(buffer.cesium.data.size()) + " bytes.");
-        continue;
-      }
+std::vector<EmbeddedImage> findEmbeddedImages(GltfReaderResult& readGltf) {
+  Model& model = readGltf.model.value();
+  std::vector<EmbeddedImage> result;
 
-      const std::span<const std::byte> bufferSpan(buffer.cesium.data);
-      const std::span<const std::byte> bufferViewSpan = bufferSpan.subspan(
-          static_cast<size_t>(bufferView.byteOffset),
-          static_cast<size_t>(bufferView.byteLength));
-      ImageReaderResult imageResult =
-          ImageDecoder::readImage(bufferViewSpan, options.ktx2TranscodeTargets);
-      readGltf.warnings.insert(
-          readGltf.warnings.end(),
-          imageResult.warnings.begin(),
-          imageResult.warnings.end());
-      readGltf.errors.insert(
-          readGltf.errors.end(),
-          imageResult.errors.begin(),
-          imageResult.errors.end());
-      if (imageResult.pImage) {
-        image.pAsset = imageResult.pImage;
-      } else {
-        if (image.mimeType) {
-          readGltf.errors.emplace_back(
-              "Declared image MIME Type: " + image.mimeType.value());
-        } else {
-          readGltf.errors.emplace_back("Image does not declare a MIME Type");
-        }
-      }
+  for (Image& image : model.images) {
+    // Ignore external images for now.
+    if (image.uri) {
+      continue;
     }
 
-    // Copy the source property in texture extensions to the main Texture. The
-    // image has already been decoded as necessary, so it's more convenient for
-    // clients to not need to worry about the extension.
-    for (Texture& texture : model.textures) {
-      ExtensionTextureWebp* pWebP =
-          texture.getExtension<ExtensionTextureWebp>();
-      if (pWebP) {
-        texture.source = pWebP->source;
-      }
+    // Image has already been decoded
+    if (image.pAsset && !image.pAsset->pixelData.empty()) {
+      continue;
+    }
 
-      ExtensionKhrTextureBasisu* pKtx =
-          texture.getExtension<ExtensionKhrTextureBasisu>();
-      if (pKtx) {
-        texture.source = pKtx->source;
-      }
+    const BufferView& bufferView =
+        Model::getSafe(model.bufferViews, image.bufferView);
+    const Buffer& buffer = Model::getSafe(model.buffers, bufferView.buffer);
+
+    if (bufferView.byteOffset + bufferView.byteLength >
+        static_cast<int64_t>(buffer.cesium.data.size())) {
+      readGltf.warnings.emplace_back(
+          "Image bufferView's byte offset is " +
+          std::to_string(bufferView.byteOffset) + " and the byteLength is " +
+          std::to_string(bufferView.byteLength) + ", the result is " +
+          std::to_string(bufferView.byteOffset + bufferView.byteLength) +
+          ", which is more than the available " +
+          std::to_string(buffer.cesium.data.size()) + " bytes.");
+      continue;
     }
+
+    const std::span<const std::byte> bufferSpan(buffer.cesium.data);
+    result.emplace_back(EmbeddedImage{
+        &image,
+        bufferSpan.subspan(
+            static_cast<size_t>(bufferView.byteOffset),
+            static_cast<size_t>(bufferView.byteLength)),
+        {}});
   }
 
-  if (options.decodeDraco) {
-    decodeDraco(readGltf);
+  return result;
+}
+
+// Copy the source property in texture extensions to the main Texture. The
+// image has already been decoded as necessary, so it's more convenient for
+// clients to not need to worry about the extension.
+void copyTextureSources(Model& model) {
+  for (Texture& texture : model.textures) {
+    ExtensionTextureWebp* pWebP = texture.getExtension<ExtensionTextureWebp>();
+    if (pWebP) {
+      texture.source = pWebP->source;
+    }
+
+    ExtensionKhrTextureBasisu* pKtx =
+        texture.getExtension<ExtensionKhrTextureBasisu>();
+    if (pKtx) {
+      texture.source = pKtx->source;
+    }
   }
+}
+
+void finishPostprocess(
+    GltfReaderResult& readGltf,
+    const GltfReaderOptions& options) {
+  Model& model = readGltf.model.value();
 
   if (options.decodeMeshOptData &&
       std::find(
@@ -376,6 +395,163 @@ void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
   }
 }
 
+void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
+  if (!readGltf.model) {
+    return;
+  }
+
+  beginPostprocess(readGltf, options);
+
+  if (options.decodeEmbeddedImages) {
+    CESIUM_TRACE("CesiumGltfReader::decodeEmbeddedImages");
+    for (EmbeddedImage& image : findEmbeddedImages(readGltf)) {
+      decodeEmbeddedImage(
+          readGltf,
+          *image.pImage,
+          image.data,
+          options.ktx2TranscodeTargets,
+          options.imageCompressionFormat,
+          options.maximumImageDimension,
+          options.pByteBufferPool);
+    }
+
+    copyTextureSources(readGltf.model.value());
+  }
+
+  if (options.decodeDraco) {
+    decodeDraco(readGltf);
+  }
+
+  finishPostprocess(readGltf, options);
+}
+
+/**
+ * @brief The state shared by the jobs of a parallel post-processing step.
+ *
+ * Each job writes only to its own element of `images` or `dracoPrimitives`
+ * and only reads the model, so the jobs need no synchronization. The results
+ * are copied into the model afterward, in the same order that `postprocess`
+ * would produce them.
+ */
+struct ParallelPostprocess {
+  GltfReaderResult result;
+  std::vector<EmbeddedImage> images;
+  std::vector<DracoPrimitive> dracoPrimitives;
+};
+
+void applyParallelPostprocess(
+    ParallelPostprocess& state,
+    const GltfReaderOptions& options) {
+  GltfReaderResult& readGltf = state.result;
+
+  if (options.decodeEmbeddedImages) {
+    for (EmbeddedImage& image : state.images) {
+      setDecodedImage(readGltf, *image.pImage, std::move(image.decoded));
+    }
+
+    copyTextureSources(readGltf.model.value());
+  }
+
+  if (options.decodeDraco) {
+    applyDecodedDracoPrimitives(readGltf, state.dracoPrimitives);
+  }
+
+  finishPostprocess(readGltf, options);
+}
+
+Future<GltfReaderResult> postprocessInParallel(
+    const AsyncSystem& asyncSystem,
+    GltfReaderResult&& readGltf,
+    const GltfReaderOptions& options) {
+  if (!readGltf.model) {
+    return asyncSystem.createResolvedFuture(std::move(readGltf));
+  }
+
+  beginPostprocess(readGltf, options);
+
+  // The jobs hold pointers into the model, so it must not move after they
+  // are found.
+  auto pState = std::make_shared<ParallelPostprocess>(
+      ParallelPostprocess{std::move(readGltf), {}, {}});
+  if (options.decodeEmbeddedImages) {
+    pState->images = findEmbeddedImages(pState->result);
+  }
+  if (options.decodeDraco) {
+    pState->dracoPrimitives = findDracoPrimitives(pState->result.model.value());
+  }
+
+  const Ktx2TranscodeTargets& ktx2TranscodeTargets =
+      options.ktx2TranscodeTargets;
+  const GpuCompressedPixelFormat imageCompressionFormat =
+      options.imageCompressionFormat;
+  const int32_t maximumImageDimension = options.maximumImageDimension;
+  const std::shared_ptr<ByteBufferPool>& pByteBufferPool =
+      options.pByteBufferPool;
+  const Model& model = pState->result.model.value();
+
+  // A single job is not worth the trip through the worker thread pool.
+  if (pState->images.size() + pState->dracoPrimitives.size() < 2) {
+    for (EmbeddedImage& image : pState->images) {
+      image.decoded = decodeImage(
+          image.data,
+          ktx2TranscodeTargets,
+          imageCompressionFormat,
+          maximumImageDimension,
+          pByteBufferPool);
+    }
+    for (DracoPrimitive& primitive : pState->dracoPrimitives) {
+      decodeDracoPrimitive(model, primitive);
+    }
+
+    applyParallelPostprocess(*pState, options);
+    return asyncSystem.createResolvedFuture(std::move(pState->result));
+  }
+
+  std::vector<Future<void>> jobs;
+  jobs.reserve(pState->images.size() + pState->dracoPrimitives.size());
+
+  for (EmbeddedImage& image : pState->images) {
+    jobs.emplace_back(asyncSystem.runInWorkerThread(
+        [pState,
+         &image,
+         ktx2TranscodeTargets,
+         imageCompressionFormat,
+         maximumImageDimension,
+         pByteBufferPool]() {
+          CESIUM_TRACE("CesiumGltfReader::decodeEmbeddedImage");
+          image.decoded = decodeImage(
+              image.data,
+              ktx2TranscodeTargets,
+              imageCompressionFormat,
+              maximumImageDimension,
+              pByteBufferPool);
+        }));
+  }
+
+  for (DracoPrimitive& primitive : pState->dracoPrimitives) {
+    jobs.emplace_back(
+        asyncSystem.runInWorkerThread([pState, &model, &primitive]() {
+          decodeDracoPrimitive(model, primitive);
+        }));
+  }
+
+  // Join with a continuation rather than by waiting, so that no worker thread
+  // is blocked while the jobs run.
+  return asyncSystem.all(std::move(jobs))
+      .thenInWorkerThread([pState, options]() {
+        applyParallelPostprocess(*pState, options);
+        return std::move(pState->result);
+      });
+}
+
+GltfReaderResult readGltfWithoutPostprocessing(
+    const CesiumJsonReader::JsonReaderOptions& context,
+    const std::span<const std::byte>& data,
+    std::vector<std::byte>* pStorage) {
+  return isBinaryGltf(data) ? readBinaryGltf(context, data, pStorage)
+                            : readJsonGltf(context, data);
+}
+
 } // namespace
 
 GltfReader::GltfReader() : _context() {
@@ -394,17 +570,41 @@ GltfReaderResult GltfReader::readGltf(
     const std::span<const std::byte>& data,
     const GltfReaderOptions& options) const {
 
-  const CesiumJsonReader::JsonReaderOptions& context = this->getExtensions();
-  GltfReaderResult result = isBinaryGltf(data) ? readBinaryGltf(context, data)
-                                               : readJsonGltf(context, data);
-
-  if (result.model) {
-    postprocess(result, options);
-  }
+  GltfReaderResult result =
+      readGltfWithoutPostprocessing(this->getExtensions(), data, nullptr);
+  postprocess(result, options);
+  return result;
+}
 
+GltfReaderResult GltfReader::readGltf(
+    std::vector<std::byte>&& data,
+    const GltfReaderOptions& options) const {
+  GltfReaderResult result =
+      readGltfWithoutPostprocessing(this->getExtensions(), data, &data);
+  postprocess(result, options);
   return result;
 }
 
+Future<GltfReaderResult> GltfReader::readGltf(
+    const AsyncSystem& asyncSystem,
+    const std::span<const std::byte>& data,
+    const GltfReaderOptions& options) const {
+  return this->postprocessGltf(
+      asyncSystem,
+      readGltfWithoutPostprocessing(this->getExtensions(), data, nullptr),
+      options);
+}
+
+Future<GltfReaderResult> GltfReader::readGltf(
+    const AsyncSystem& asyncSystem,
+    std::vector<std::byte>&& data,
+    const GltfReaderOptions& options) const {
+  return this->postprocessGltf(
+      asyncSystem,
+      readGltfWithoutPostprocessing(this->getExtensions(), data, &data),
+      options);
+}
+
 CesiumAsync::Future<GltfReaderResult> GltfReader::loadGltf(
     const CesiumAsync::AsyncSystem& asyncSystem,
     const std::string& uri,
@@ -437,10 +637,13 @@ CesiumAsync::Future<GltfReaderResult> GltfReader::loadGltf(
 
             const CesiumJsonReader::JsonReaderOptions& context =
                 this->getExtensions();
-            GltfReaderResult result =
-                isBinaryGltf(pResponse->data())
-                    ? readBinaryGltf(context, pResponse->data())
-                    : readJsonGltf(context, pResponse->data());
+            GltfReaderResult result;
+            if (isBinaryGltf(pResponse->data())) {
+              std::vector<std::byte> data = pRequest->takeResponseData();
+              result = readBinaryGltf(context, data, &data);
+            } else {
+              result = readJsonGltf(context, pResponse->data());
+            }
 
             if (!result.model) {
               return asyncSystem.createResolvedFuture(std::move(result));
@@ -454,18 +657,31 @@ CesiumAsync::Future<GltfReaderResult> GltfReader::loadGltf(
                 options,
                 std::move(result));
           })
-      .thenInWorkerThread([options](GltfReaderResult&& result) {
-        postprocess(result, options);
-        return std::move(result);
-      });
+      .thenInWorkerThread(
+          [this, asyncSystem, options](GltfReaderResult&& result) {
+            return this->postprocessGltf(
+                asyncSystem,
+                std::move(result),
+                options);
+          });
 }
 
 void CesiumGltfReader::GltfReader::postprocessGltf(
     GltfReaderResult& readGltf,
-    const GltfReaderOptions& options) {
-  if (readGltf.model) {
-    postprocess(readGltf, options);
+    const GltfReaderOptions& options) const {
+  postprocess(readGltf, options);
+}
+
+Future<GltfReaderResult> GltfReader::postprocessGltf(
+    const AsyncSystem& asyncSystem,
+    GltfReaderResult&& readGltf,
+    const GltfReaderOptions& options) const {
+  if (options.parallelPostprocessing) {
+    return postprocessInParallel(asyncSystem, std::move(readGltf), options);
   }
+
+  postprocess(readGltf, options);
+  return asyncSystem.createResolvedFuture(std::move(readGltf));
 }
 
 /*static*/ Future<GltfReaderResult> GltfReader::resolveExternalData(
@@ -588,7 +804,9 @@ void CesiumGltfReader::GltfReader::postprocessGltf(
             -> SharedFuture<ResultPointer<ImageAsset>> {
           NetworkImageAssetDescriptor assetKey{
               {uri, headers},
-              options.ktx2TranscodeTargets};
+              options.ktx2TranscodeTargets,
+              options.imageCompressionFormat,
+              options.maximumImageDimension};
 
           if (options.pSharedAssetSystem == nullptr ||
               options.pSharedAssetSystem->pImage == nullptr) {
@@ -0,0 +1,391 @@
+#include "ModelJsonHandler.h"
+#include "decodeEmbeddedImage.h"
+
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/Image.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfReader/GltfReader.h>
+#include <CesiumGltfReader/GltfStreamReader.h>
+#include <CesiumJsonReader/JsonReader.h>
+#include <CesiumUtility/ByteBufferPool.h>
+#include <CesiumUtility/Tracing.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace CesiumGltf;
+
+namespace CesiumGltfReader {
+
+namespace {
+#pragma pack(push, 1)
+struct GlbHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t length;
+};
+
+struct ChunkHeader {
+  uint32_t chunkLength;
+  uint32_t chunkType;
+};
+#pragma pack(pop)
+
+const uint32_t GLB_MAGIC = 0x46546C67;
+const uint32_t JSON_CHUNK_TYPE = 0x4E4F534A;
+const uint32_t BINARY_CHUNK_TYPE = 0x004E4942;
+
+template <typename T> T readStruct(const std::vector<std::byte>& data) {
+  T result;
+  std::memcpy(&result, data.data(), sizeof(T));
+  return result;
+}
+} // namespace
+
+GltfStreamReader::GltfStreamReader(
+    const GltfReader& reader,
+    const GltfReaderOptions& options)
+    : _reader(reader),
+      _options(options),
+      _state(State::Header),
+      _pending(),
+      _bytesReceived(0),
+      _glbLength(0),
+      _chunkStart(0),
+      _chunkLength(0),
+      _chunkBytesRead(0),
+      _result(),
+      _pendingImages() {}
+
+void GltfStreamReader::append(const std::span<const std::byte>& data) {
+  this->_bytesReceived += data.size();
+
+  std::span<const std::byte> remaining = data;
+  for (;;) {
+    switch (this->_state) {
+    case State::Header:
+      if (!this->fill(remaining, sizeof(GlbHeader))) {
+        return;
+      }
+      this->readHeader();
+      break;
+    case State::JsonChunkHeader:
+      if (!this->fill(remaining, sizeof(ChunkHeader))) {
+        return;
+      }
+      this->readJsonChunkHeader();
+      break;
+    case State::JsonChunk:
+      if (!this->fill(remaining, size_t(this->_chunkLength))) {
+        return;
+      }
+      this->readJsonChunk();
+      break;
+    case State::BinaryChunkHeader:
+      if (!this->fill(remaining, sizeof(ChunkHeader))) {
+        return;
+      }
+      this->readBinaryChunkHeader();
+      break;
+    case State::BinaryChunk:
+      if (!this->readBinaryChunk(remaining)) {
+        return;
+      }
+      break;
+    case State::Json:
+      this->_pending.insert(
+          this->_pending.end(),
+          remaining.begin(),
+          remaining.end());
+      return;
+    case State::Done:
+      // Anything after the end of the GLB is ignored.
+      return;
+    }
+  }
+}
+
+GltfReaderResult GltfStreamReader::finish() {
+  // Complete any step that does not need more bytes, such as an empty chunk.
+  this->append(std::span<const std::byte>());
+
+  switch (this->_state) {
+  case State::Header:
+  case State::Json:
+    // This is not a GLB, so read it like any other glTF.
+    return this->_reader.readGltf(std::move(this->_pending), this->_options);
+  case State::Done:
+    break;
+  default:
+    this->fail(
+        "GLB extends past the end of the buffer, header size " +
+        std::to_string(this->_glbLength) + ", data size " +
+        std::to_string(this->_bytesReceived));
+    break;
+  }
+
+  GltfReaderResult result = std::move(this->_result);
+  if (result.model) {
+    this->_reader.postprocessGltf(result, this->_options);
+  }
+  return result;
+}
+
+bool GltfStreamReader::fill(std::span<const std::byte>& data, size_t size) {
+  const size_t count = std::min(size - this->_pending.size(), data.size());
+  this->_pending.insert(
+      this->_pending.end(),
+      data.begin(),
+      data.begin() + ptrdiff_t(count));
+  data = data.subspan(count);
+  return this->_pending.size() == size;
+}
+
+void GltfStreamReader::readHeader() {
+  const GlbHeader header = readStruct<GlbHeader>(this->_pending);
+  if (header.magic != GLB_MAGIC) {
+    // Keep the bytes read so far, and collect the rest for finish.
+    this->_state = State::Json;
+    return;
+  }
+
+  if (header.version != 2) {
+    this->fail(
+        "Only binary glTF version 2 is supported, found version " +
+        std::to_string(header.version));
+    return;
+  }
+
+  if (header.length < sizeof(GlbHeader) + sizeof(ChunkHeader)) {
+    this->fail("Too short to be a valid GLB.");
+    return;
+  }
+
+  this->_glbLength = header.length;
+  this->_pending.clear();
+  this->_state = State::JsonChunkHeader;
+}
+
+void GltfStreamReader::readJsonChunkHeader() {
+  const ChunkHeader chunkHeader = readStruct<ChunkHeader>(this->_pending);
+  this->_pending.clear();
+
+  if (chunkHeader.chunkType != JSON_CHUNK_TYPE) {
+    this->fail("GLB JSON chunk does not have the expected chunkType 'JSON'.");
+    return;
+  }
+
+  const uint64_t jsonStart = sizeof(GlbHeader) + sizeof(ChunkHeader);
+  const uint64_t jsonEnd = jsonStart + chunkHeader.chunkLength;
+  if (jsonEnd > this->_glbLength) {
+    this->fail(
+        "GLB JSON chunk extends past the end of the buffer, JSON end at " +
+        std::to_string(jsonEnd) + ", data size " +
+        std::to_string(this->_glbLength));
+    return;
+  }
+
+  this->_chunkStart = jsonStart;
+  this->_chunkLength = chunkHeader.chunkLength;
+  this->_pending.reserve(chunkHeader.chunkLength);
+  this->_state = State::JsonChunk;
+}
+
+void GltfStreamReader::readJsonChunk() {
+  CESIUM_TRACE("CesiumGltfReader::GltfStreamReader::readJsonChunk");
+
+  ModelJsonHandler modelHandler(this->_reader.getExtensions());
+  CesiumJsonReader::ReadJsonResult<Model> jsonResult =
+      CesiumJsonReader::JsonReader::readJson(this->_pending, modelHandler);
+  this->_result = GltfReaderResult{
+      std::move(jsonResult.value),
+      std::move(jsonResult.errors),
+      std::move(jsonResult.warnings)};
+  this->_pending = std::vector<std::byte>();
+
+  const uint64_t jsonEnd = this->_chunkStart + this->_chunkLength;
+  if (!this->_result.model ||
+      jsonEnd + sizeof(ChunkHeader) > this->_glbLength) {
+    this->_state = State::Done;
+    return;
+  }
+
+  this->_chunkStart = jsonEnd;
+  this->_state = State::BinaryChunkHeader;
+}
+
+void GltfStreamReader::readBinaryChunkHeader() {
+  const ChunkHeader chunkHeader = readStruct<ChunkHeader>(this->_pending);
+  this->_pending.clear();
+
+  if (chunkHeader.chunkType != BINARY_CHUNK_TYPE) {
+    this->fail("GLB binary chunk does not have the expected chunkType 'BIN'.");
+    return;
+  }
+
+  const uint64_t binaryStart = this->_chunkStart + sizeof(ChunkHeader);
+  const uint64_t binaryEnd = binaryStart + chunkHeader.chunkLength;
+  if (binaryEnd > this->_glbLength) {
+    this->fail(
+        "GLB binary chunk extends past the end of the buffer, binary end at " +
+        std::to_string(binaryEnd) + ", data size " +
+        std::to_string(this->_glbLength));
+    return;
+  }
+
+  this->_chunkStart = binaryStart;
+  this->_chunkLength = chunkHeader.chunkLength;
+  this->_chunkBytesRead = 0;
+  this->_state = State::Done;
+
+  if (chunkHeader.chunkLength == 0) {
+    return;
+  }
+
+  Model& model = this->_result.model.value();
+  if (model.buffers.empty()) {
+    this->_result.errors.emplace_back(
+        "GLB has a binary chunk but the JSON does not define any buffers.");
+    return;
+  }
+
+  Buffer& buffer = model.buffers[0];
+  if (buffer.uri) {
+    this->_result.errors.emplace_back(
+        "GLB has a binary chunk but the first buffer in the JSON chunk also "
+        "has a 'uri'.");
+    return;
+  }
+
+  const int64_t binaryChunkSize = int64_t(chunkHeader.chunkLength);
+  if (buffer.byteLength > binaryChunkSize) {
+    this->_result.errors.emplace_back(
+        "The size of the first buffer in the JSON chunk is " +
+        std::to_string(buffer.byteLength) +
+        ", which is larger than the size of the GLB binary chunk (" +
+        std::to_string(binaryChunkSize) + ")");
+    return;
+  }
+
+  if (binaryChunkSize - buffer.byteLength > 3) {
+    this->_result.warnings.emplace_back(
+        "The size of the first buffer in the JSON chunk is " +
+        std::to_string(buffer.byteLength) +
+        ", which is more than 3 bytes smaller than the size of the GLB "
+        "binary chunk (" +
+        std::to_string(binaryChunkSize) + ")");
+  }
+
+  if (this->_options.pByteBufferPool) {
+    buffer.cesium.data =
+        this->_options.pByteBufferPool->acquire(size_t(buffer.byteLength));
+    buffer.cesium.data.clear();
+    buffer.cesium.pDataPool = this->_options.pByteBufferPool;
+  } else {
+    buffer.cesium.data.reserve(size_t(buffer.byteLength));
+  }
+
+  if (this->_options.decodeEmbeddedImages) {
+    for (size_t i = 0; i < model.images.size(); ++i) {
+      const Image& image = model.images[i];
+      if (image.uri || image.pAsset) {
+        continue;
+      }
+
+      const BufferView& bufferView =
+          Model::getSafe(model.bufferViews, image.bufferView);
+      if (bufferView.buffer == 0 &&
+          bufferView.byteOffset + bufferView.byteLength <= buffer.byteLength) {
+        this->_pendingImages.emplace_back(i);
+      }
+    }
+  }
+
+  this->_state = State::BinaryChunk;
+}
+
+bool GltfStreamReader::readBinaryChunk(std::span<const std::byte>& data) {
+  const size_t count = size_t(std::min(
+      uint64_t(data.size()),
+      this->_chunkLength - this->_chunkBytesRead));
+  const std::span<const std::byte> chunkData = data.first(count);
+  data = data.subspan(count);
+  this->_chunkBytesRead += count;
+
+  // Padding at the end of the chunk is not part of the buffer.
+  std::vector<std::byte>& bufferData =
+      this->_result.model->buffers[0].cesium.data;
+  const size_t bufferCount = std::min(
+      size_t(this->_result.model->buffers[0].byteLength) - bufferData.size(),
+      chunkData.size());
+  if (bufferCount > 0) {
+    bufferData.insert(
+        bufferData.end(),
+        chunkData.begin(),
+        chunkData.begin() + ptrdiff_t(bufferCount));
+    this->decodeReadyImages();
+  }
+
+  if (this->_chunkBytesRead < this->_chunkLength) {
+    return false;
+  }
+
+  this->_state = State::Done;
+  return true;
+}
+
+void GltfStreamReader::fail(std::string&& error) {
+  this->_result.model.reset();
+  this->_result.errors.emplace_back(std::move(error));
+  this->_pending = std::vector<std::byte>();
+  this->_pendingImages.clear();
+  this->_state = State::Done;
+}
+
+void GltfStreamReader::decodeReadyImages() {
+  Model& model = this->_result.model.value();
+  const std::span<const std::byte> bufferData(model.buffers[0].cesium.data);
+
+  size_t stillPending = 0;
+  for (const size_t i : this->_pendingImages) {
+    Image& image = model.images[i];
+    const BufferView& bufferView =
+        Model::getSafe(model.bufferViews, image.bufferView);
+    if (bufferView.byteOffset + bufferView.byteLength >
+        int64_t(bufferData.size())) {
+      this->_pendingImages[stillPending++] = i;
+      continue;
+    }
+
+    // If the image can't be decoded, it is left for postprocessing in
+    // finish, which reports the errors.
+    GltfReaderResult imageResult;
+    decodeEmbeddedImage(
+        imageResult,
+        image,
+        bufferData.subspan(
+            size_t(bufferView.byteOffset),
+            size_t(bufferView.byteLength)),
+        this->_options.ktx2TranscodeTargets,
+        this->_options.imageCompressionFormat,
+        this->_options.maximumImageDimension,
+        this->_options.pByteBufferPool);
+    if (image.pAsset) {
+      this->_result.warnings.insert(
+          this->_result.warnings.end(),
+          imageResult.warnings.begin(),
+          imageResult.warnings.end());
+    }
+  }
+
+  this->_pendingImages.resize(stillPending);
+}
+
+} // namespace CesiumGltfReader
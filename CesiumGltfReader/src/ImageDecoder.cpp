@@ -2,18 +2,24 @@
 #include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumGltfReader/ImageDecoder.h>
 #include <CesiumUtility/Assert.h>
+#include <CesiumUtility/ByteBufferPool.h>
 #include <CesiumUtility/Tracing.h>
 
 #include <ktx.h>
 #include <webp/decode.h>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
 #define STBI_FAILURE_USERMSG
 
@@ -27,6 +33,10 @@
 #define STB_IMAGE_RESIZE_STATIC
 #include <stb_image_resize2.h>
 
+#define STB_DXT_IMPLEMENTATION
+#define STB_DXT_STATIC
+#include <stb_dxt.h>
+
 #ifndef CESIUM_DISABLE_LIBJPEG_TURBO
 #include <turbojpeg.h>
 #endif
@@ -34,6 +44,7 @@
 namespace CesiumGltfReader {
 
 using namespace CesiumGltf;
+using namespace CesiumUtility;
 
 namespace {
 
@@ -61,17 +72,294 @@ bool isWebP(const std::span<const std::byte>& data) {
   return magic1 == 0x46464952 && magic2 == 0x50424557;
 }
 
-} // namespace
+#ifndef CESIUM_DISABLE_LIBJPEG_TURBO
+// Finds the largest of the 1, 1/2, 1/4, and 1/8 scales that libjpeg-turbo can
+// apply cheaply while decoding a JPEG, at which neither of its dimensions is
+// larger than maximumDimension. If even 1/8 is too large, returns 1/8.
+tjscalingfactor findJpegScalingFactor(
+    int32_t width,
+    int32_t height,
+    int32_t maximumDimension) {
+  tjscalingfactor factor{1, 1};
+  if (maximumDimension <= 0) {
+    return factor;
+  }
 
-/*static*/
-ImageReaderResult ImageDecoder::readImage(
-    const std::span<const std::byte>& data,
-    const Ktx2TranscodeTargets& ktx2TranscodeTargets) {
-  CESIUM_TRACE("CesiumGltfReader::readImage");
+  while (factor.denom < 8 && (TJSCALED(width, factor) > maximumDimension ||
+                              TJSCALED(height, factor) > maximumDimension)) {
+    factor.denom *= 2;
+  }
+  return factor;
+}
+#endif // !CESIUM_DISABLE_LIBJPEG_TURBO
+
+// Allocates a buffer for an image's pixel data, from its pool if it has one.
+std::vector<std::byte> allocatePixelData(const ImageAsset& image, size_t size) {
+  return image.pPixelDataPool ? image.pPixelDataPool->acquire(size)
+                              : std::vector<std::byte>(size);
+}
+
+// Replaces an image's pixel data, returning the old data to its pool.
+void replacePixelData(ImageAsset& image, std::vector<std::byte>&& pixelData) {
+  if (image.pPixelDataPool) {
+    image.pPixelDataPool->release(std::move(image.pixelData));
+  }
+  image.pixelData = std::move(pixelData);
+}
+
+// Resizes an image's pixel data, using storage from its pool if it has one.
+void resizePixelData(ImageAsset& image, size_t size) {
+  if (image.pPixelDataPool) {
+    image.pPixelDataPool->resize(image.pixelData, size);
+  } else {
+    image.pixelData.resize(size);
+  }
+}
+
+// Halves the size of a decoded 8-bit image until neither of its dimensions is
+// larger than maximumDimension. Compressed images and images with mipmaps are
+// left alone. Returns false if the image could not be resized.
+bool shrinkToMaximumDimension(ImageAsset& image, int32_t maximumDimension) {
+  if (maximumDimension <= 0 ||
+      image.compressedPixelFormat != GpuCompressedPixelFormat::NONE ||
+      !image.mipPositions.empty() || image.bytesPerChannel != 1) {
+    return true;
+  }
+
+  int32_t width = image.width;
+  int32_t height = image.height;
+  while ((width > maximumDimension || height > maximumDimension) &&
+         (width > 1 || height > 1)) {
+    width = std::max(width >> 1, 1);
+    height = std::max(height >> 1, 1);
+  }
+
+  if (width == image.width && height == image.height) {
+    return true;
+  }
+
+  CESIUM_TRACE(
+      "shrink image " + std::to_string(image.width) + "x" +
+      std::to_string(image.height) + " to " + std::to_string(width) + "x" +
+      std::to_string(height));
+
+  std::vector<std::byte> pixelData = allocatePixelData(
+      image,
+      size_t(width) * size_t(height) * size_t(image.channels));
+  if (!ImageDecoder::unsafeResize(
+          image.pixelData.data(),
+          image.width,
+          image.height,
+          0,
+          pixelData.data(),
+          width,
+          height,
+          0,
+          image.channels)) {
+    return false;
+  }
+
+  image.width = width;
+  image.height = height;
+  replacePixelData(image, std::move(pixelData));
+  return true;
+}
+
+// Converts an sRGB-encoded 8-bit value to linear intensity.
+const std::array<float, 256>& getSrgbToLinearTable() {
+  static const std::array<float, 256> table = []() {
+    std::array<float, 256> result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+      const float value = float(i) / 255.0f;
+      result[i] = value <= 0.04045f
+                      ? value / 12.92f
+                      : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+    return result;
+  }();
+  return table;
+}
+
+// Converts linear intensity, quantized to 14 bits so that even the darkest
+// sRGB values round-trip, to an sRGB-encoded 8-bit value.
+constexpr size_t linearToSrgbTableSize = 1 << 14;
+
+const std::array<uint8_t, linearToSrgbTableSize>& getLinearToSrgbTable() {
+  static const std::array<uint8_t, linearToSrgbTableSize> table = []() {
+    std::array<uint8_t, linearToSrgbTableSize> result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+      const float value = float(i) / float(linearToSrgbTableSize - 1);
+      const float encoded =
+          value <= 0.0031308f
+              ? value * 12.92f
+              : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+      result[i] = uint8_t(std::clamp(encoded * 255.0f + 0.5f, 0.0f, 255.0f));
+    }
+    return result;
+  }();
+  return table;
+}
+
+// Builds the next mip level of an 8-bit image by averaging each 2x2 block of
+// pixels. Each dimension of the source must be even, or one, in which case it
+// stays one. For these sizes a 2x2 box filter is exact, so the general
+// resampling filters of stb_image_resize2 aren't needed.
+template <size_t Channels>
+void averageBlocks(
+    const uint8_t* pSource,
+    int32_t sourceWidth,
+    int32_t sourceHeight,
+    uint8_t* pTarget,
+    bool gammaCorrect) {
+  const size_t targetWidth = size_t(std::max(sourceWidth >> 1, 1));
+  const size_t targetHeight = size_t(std::max(sourceHeight >> 1, 1));
+  const size_t sourceRowBytes = size_t(sourceWidth) * Channels;
+
+  // The offsets to the second column and row of each block. When a dimension
+  // is one, the "block" repeats its only column or row.
+  const size_t columnOffset = sourceWidth > 1 ? Channels : 0;
+  const size_t rowOffset = sourceHeight > 1 ? sourceRowBytes : 0;
+
+  // Two- and four-channel images have alpha in their last channel, which is
+  // never gamma encoded.
+  constexpr size_t alphaChannel =
+      Channels == 2 || Channels == 4 ? Channels - 1 : Channels;
+
+  const std::array<float, 256>& toLinear = getSrgbToLinearTable();
+  const std::array<uint8_t, linearToSrgbTableSize>& toSrgb =
+      getLinearToSrgbTable();
+  const float linearScale = 0.25f * float(linearToSrgbTableSize - 1);
+
+  for (size_t y = 0; y < targetHeight; ++y) {
+    const uint8_t* pRow0 = pSource + y * 2 * sourceRowBytes;
+    const uint8_t* pRow1 = pRow0 + rowOffset;
+    uint8_t* pTargetRow = pTarget + y * targetWidth * Channels;
+
+    if (!gammaCorrect) {
+      for (size_t x = 0; x < targetWidth; ++x) {
+        const size_t s = x * 2 * Channels;
+        for (size_t c = 0; c < Channels; ++c) {
+          const uint32_t sum = uint32_t(pRow0[s + c]) +
+                               uint32_t(pRow0[s + columnOffset + c]) +
+                               uint32_t(pRow1[s + c]) +
+                               uint32_t(pRow1[s + columnOffset + c]);
+          pTargetRow[x * Channels + c] = uint8_t((sum + 2) >> 2);
+        }
+      }
+      continue;
+    }
+
+    for (size_t x = 0; x < targetWidth; ++x) {
+      const size_t s = x * 2 * Channels;
+      for (size_t c = 0; c < Channels; ++c) {
+        if (c == alphaChannel) {
+          const uint32_t sum = uint32_t(pRow0[s + c]) +
+                               uint32_t(pRow0[s + columnOffset + c]) +
+                               uint32_t(pRow1[s + c]) +
+                               uint32_t(pRow1[s + columnOffset + c]);
+          pTargetRow[x * Channels + c] = uint8_t((sum + 2) >> 2);
+        } else {
+          const float sum = toLinear[pRow0[s + c]] +
+                            toLinear[pRow0[s + columnOffset + c]] +
+                            toLinear[pRow1[s + c]] +
+                            toLinear[pRow1[s + columnOffset + c]];
+          pTargetRow[x * Channels + c] =
+              toSrgb[size_t(sum * linearScale + 0.5f)];
+        }
+      }
+    }
+  }
+}
+
+// Returns true if the next mip level of an image with the given dimensions
+// can be built with averageBlocks.
+bool canAverageBlocks(const ImageAsset& image, int32_t width, int32_t height) {
+  return image.bytesPerChannel == 1 && image.channels >= 1 &&
+         image.channels <= 4 && (width == 1 || width % 2 == 0) &&
+         (height == 1 || height % 2 == 0);
+}
+
+void averageBlocks(
+    const std::byte* pSource,
+    int32_t sourceWidth,
+    int32_t sourceHeight,
+    std::byte* pTarget,
+    int32_t channels,
+    bool gammaCorrect) {
+  const uint8_t* pSourceBytes = reinterpret_cast<const uint8_t*>(pSource);
+  uint8_t* pTargetBytes = reinterpret_cast<uint8_t*>(pTarget);
+  switch (channels) {
+  case 1:
+    averageBlocks<1>(
+        pSourceBytes,
+        sourceWidth,
+        sourceHeight,
+        pTargetBytes,
+        gammaCorrect);
+    break;
+  case 2:
+    averageBlocks<2>(
+        pSourceBytes,
+        sourceWidth,
+        sourceHeight,
+        pTargetBytes,
+        gammaCorrect);
+    break;
+  case 3:
+    averageBlocks<3>(
+        pSourceBytes,
+        sourceWidth,
+        sourceHeight,
+        pTargetBytes,
+        gammaCorrect);
+    break;
+  case 4:
+    averageBlocks<4>(
+        pSourceBytes,
+        sourceWidth,
+        sourceHeight,
+        pTargetBytes,
+        gammaCorrect);
+    break;
+  default:
+    CESIUM_ASSERT(false);
+    break;
+  }
+}
+
+// Resamples an 8-bit sRGB image with stb_image_resize2, treating the last
+// channel of two- and four-channel images as linear alpha.
+bool resizeSrgb(
+    const std::byte* pInputPixels,
+    int32_t inputWidth,
+    int32_t inputHeight,
+    std::byte* pOutputPixels,
+    int32_t outputWidth,
+    int32_t outputHeight,
+    int32_t channels) {
+  const stbir_pixel_layout layout =
+      channels == 2 ? STBIR_RA : static_cast<stbir_pixel_layout>(channels);
+  return stbir_resize_uint8_srgb(
+             reinterpret_cast<const unsigned char*>(pInputPixels),
+             inputWidth,
+             inputHeight,
+             0,
+             reinterpret_cast<unsigned char*>(pOutputPixels),
+             outputWidth,
+             outputHeight,
+             0,
+             layout) != nullptr;
+}
 
+ImageReaderResult decodeImageData(
+    const std::span<const std::byte>& data,
+    const Ktx2TranscodeTargets& ktx2TranscodeTargets,
+    [[maybe_unused]] int32_t maximumDimension,
+    const std::shared_ptr<ByteBufferPool>& pPixelDataPool) {
   ImageReaderResult result;
 
   CesiumGltf::ImageAsset& image = result.pImage.emplace();
+  image.pPixelDataPool = pPixelDataPool;
 
   if (isKtx(data)) {
     ktxTexture2* pTexture = nullptr;
@@ -246,7 +534,7 @@ ImageReaderResult ImageDecoder::readImage(
           ktx_size_t pixelDataSize =
               ktxTexture_GetDataSize(ktxTexture(pTexture));
 
-          image.pixelData.resize(pixelDataSize);
+          resizePixelData(image, pixelDataSize);
           std::uint8_t* u8Pointer =
               reinterpret_cast<std::uint8_t*>(image.pixelData.data());
           std::copy(pixelData, pixelData + pixelDataSize, u8Pointer);
@@ -274,7 +562,7 @@ ImageReaderResult ImageDecoder::readImage(
       image.bytesPerChannel = 1;
       uint8_t* pImage = nullptr;
       const auto bufferSize = image.width * image.height * image.channels;
-      image.pixelData.resize(static_cast<std::size_t>(bufferSize));
+      resizePixelData(image, static_cast<std::size_t>(bufferSize));
       pImage = WebPDecodeRGBAInto(
           reinterpret_cast<const uint8_t*>(data.data()),
           data.size(),
@@ -302,11 +590,15 @@ ImageReaderResult ImageDecoder::readImage(
             &inSubsamp,
             &inColorspace)) {
       CESIUM_TRACE("Decode JPG");
+      const tjscalingfactor scalingFactor =
+          findJpegScalingFactor(image.width, image.height, maximumDimension);
+      image.width = TJSCALED(image.width, scalingFactor);
+      image.height = TJSCALED(image.height, scalingFactor);
       image.bytesPerChannel = 1;
       image.channels = 4;
       const auto lastByte =
           image.width * image.height * image.channels * image.bytesPerChannel;
-      image.pixelData.resize(static_cast<std::size_t>(lastByte));
+      resizePixelData(image, static_cast<std::size_t>(lastByte));
       if (tjDecompress2(
               tjInstance,
               reinterpret_cast<const unsigned char*>(data.data()),
@@ -345,7 +637,7 @@ ImageReaderResult ImageDecoder::readImage(
         // use reinterpret_cast to (safely) force the conversion.
         const auto lastByte =
             image.width * image.height * image.channels * image.bytesPerChannel;
-        image.pixelData.resize(static_cast<std::size_t>(lastByte));
+        resizePixelData(image, static_cast<std::size_t>(lastByte));
         std::uint8_t* u8Pointer =
             reinterpret_cast<std::uint8_t*>(image.pixelData.data());
         std::copy(pImage, pImage + lastByte, u8Pointer);
@@ -362,8 +654,33 @@ ImageReaderResult ImageDecoder::readImage(
   return result;
 }
 
+} // namespace
+
+/*static*/
+ImageReaderResult ImageDecoder::readImage(
+    const std::span<const std::byte>& data,
+    const Ktx2TranscodeTargets& ktx2TranscodeTargets,
+    int32_t maximumDimension,
+    const std::shared_ptr<ByteBufferPool>& pPixelDataPool) {
+  CESIUM_TRACE("CesiumGltfReader::readImage");
+
+  ImageReaderResult result = decodeImageData(
+      data,
+      ktx2TranscodeTargets,
+      maximumDimension,
+      pPixelDataPool);
+  if (result.pImage &&
+      !shrinkToMaximumDimension(*result.pImage, maximumDimension)) {
+    result.warnings.emplace_back(
+        "Unable to shrink the image to the maximum image dimension, so it was "
+        "kept at its full size.");
+  }
+  return result;
+}
+
 /*static*/
-std::optional<std::string> ImageDecoder::generateMipMaps(ImageAsset& image) {
+std::optional<std::string>
+ImageDecoder::generateMipMaps(ImageAsset& image, bool gammaCorrect) {
   if (!image.mipPositions.empty() ||
       image.compressedPixelFormat != GpuCompressedPixelFormat::NONE) {
     // No error message needed, since this is not technically a failure.
@@ -406,8 +723,10 @@ std::optional<std::string> ImageDecoder::generateMipMaps(ImageAsset& image) {
   image.mipPositions[0].byteOffset = 0;
   image.mipPositions[0].byteSize = imageByteSize;
 
-  image.pixelData.resize(static_cast<size_t>(
-      totalPixelCount * image.channels * image.bytesPerChannel));
+  resizePixelData(
+      image,
+      static_cast<size_t>(
+          totalPixelCount * image.channels * image.bytesPerChannel));
 
   mipWidth = image.width;
   mipHeight = image.height;
@@ -435,16 +754,38 @@ std::optional<std::string> ImageDecoder::generateMipMaps(ImageAsset& image) {
     image.mipPositions[mipIndex].byteOffset = byteOffset;
     image.mipPositions[mipIndex].byteSize = byteSize;
 
-    if (!ImageDecoder::unsafeResize(
-            &image.pixelData[lastByteOffset],
-            lastWidth,
-            lastHeight,
-            0,
-            &image.pixelData[byteOffset],
-            mipWidth,
-            mipHeight,
-            0,
-            image.channels)) {
+    bool succeeded = true;
+    if (canAverageBlocks(image, lastWidth, lastHeight)) {
+      averageBlocks(
+          &image.pixelData[lastByteOffset],
+          lastWidth,
+          lastHeight,
+          &image.pixelData[byteOffset],
+          image.channels,
+          gammaCorrect);
+    } else if (gammaCorrect) {
+      succeeded = resizeSrgb(
+          &image.pixelData[lastByteOffset],
+          lastWidth,
+          lastHeight,
+          &image.pixelData[byteOffset],
+          mipWidth,
+          mipHeight,
+          image.channels);
+    } else {
+      succeeded = ImageDecoder::unsafeResize(
+          &image.pixelData[lastByteOffset],
+          lastWidth,
+          lastHeight,
+          0,
+          &image.pixelData[byteOffset],
+          mipWidth,
+          mipHeight,
+          0,
+          image.channels);
+    }
+
+    if (!succeeded) {
       // Remove any added mipmaps.
       image.mipPositions.clear();
       image.pixelData.resize(imageByteSize);
@@ -455,6 +796,101 @@ std::optional<std::string> ImageDecoder::generateMipMaps(ImageAsset& image) {
   return std::nullopt;
 }
 
+/*static*/ std::optional<std::string> ImageDecoder::compressImage(
+    ImageAsset& image,
+    GpuCompressedPixelFormat format) {
+  if (format == GpuCompressedPixelFormat::NONE ||
+      image.compressedPixelFormat != GpuCompressedPixelFormat::NONE ||
+      image.width % 4 != 0 || image.height % 4 != 0) {
+    return std::nullopt;
+  }
+
+  if (format != GpuCompressedPixelFormat::BC1_RGB &&
+      format != GpuCompressedPixelFormat::BC3_RGBA) {
+    return "Unable to compress image, only BC1 and BC3 compression is "
+           "supported.";
+  }
+
+  if (image.channels != 4 || image.bytesPerChannel != 1) {
+    return "Unable to compress image, only images with four 8-bit channels "
+           "can be compressed.";
+  }
+
+  std::optional<std::string> mipError = ImageDecoder::generateMipMaps(image);
+  if (mipError) {
+    return mipError;
+  }
+
+  CESIUM_TRACE(
+      "compress image " + std::to_string(image.width) + "x" +
+      std::to_string(image.height));
+
+  const int alpha = format == GpuCompressedPixelFormat::BC3_RGBA ? 1 : 0;
+  const size_t blockByteSize = alpha ? size_t(16) : size_t(8);
+
+  std::vector<ImageAssetMipPosition> mipPositions;
+  mipPositions.reserve(image.mipPositions.size());
+  size_t totalByteSize = 0;
+  int32_t mipWidth = image.width;
+  int32_t mipHeight = image.height;
+  for (const ImageAssetMipPosition& mipPosition : image.mipPositions) {
+    const size_t pixelByteSize = size_t(mipWidth) * size_t(mipHeight) * 4;
+    if (mipPosition.byteSize < pixelByteSize ||
+        mipPosition.byteOffset + pixelByteSize > image.pixelData.size()) {
+      return "Unable to compress image, a mip level is smaller than its "
+             "dimensions require.";
+    }
+
+    const size_t blockCount =
+        size_t((mipWidth + 3) / 4) * size_t((mipHeight + 3) / 4);
+    mipPositions.push_back({totalByteSize, blockCount * blockByteSize});
+    totalByteSize += blockCount * blockByteSize;
+
+    mipWidth = std::max(mipWidth >> 1, 1);
+    mipHeight = std::max(mipHeight >> 1, 1);
+  }
+
+  std::vector<std::byte> compressed =
+      allocatePixelData(image, totalByteSize);
+
+  mipWidth = image.width;
+  mipHeight = image.height;
+  for (size_t i = 0; i < mipPositions.size(); ++i) {
+    const unsigned char* pSource = reinterpret_cast<const unsigned char*>(
+        image.pixelData.data() + image.mipPositions[i].byteOffset);
+    unsigned char* pTarget = reinterpret_cast<unsigned char*>(
+        compressed.data() + mipPositions[i].byteOffset);
+
+    unsigned char block[4 * 4 * 4];
+    for (int32_t blockY = 0; blockY < mipHeight; blockY += 4) {
+      for (int32_t blockX = 0; blockX < mipWidth; blockX += 4) {
+        for (int32_t y = 0; y < 4; ++y) {
+          const int32_t sourceY = std::min(blockY + y, mipHeight - 1);
+          for (int32_t x = 0; x < 4; ++x) {
+            const int32_t sourceX = std::min(blockX + x, mipWidth - 1);
+            std::memcpy(
+                &block[(y * 4 + x) * 4],
+                &pSource[size_t(sourceY * mipWidth + sourceX) * 4],
+                4);
+          }
+        }
+
+        stb_compress_dxt_block(pTarget, block, alpha, STB_DXT_NORMAL);
+        pTarget += blockByteSize;
+      }
+    }
+
+    mipWidth = std::max(mipWidth >> 1, 1);
+    mipHeight = std::max(mipHeight >> 1, 1);
+  }
+
+  replacePixelData(image, std::move(compressed));
+  image.mipPositions = std::move(mipPositions);
+  image.compressedPixelFormat = format;
+
+  return std::nullopt;
+}
+
 /*static*/ bool ImageDecoder::unsafeResize(
     const std::byte* pInputPixels,
     int32_t inputWidth,
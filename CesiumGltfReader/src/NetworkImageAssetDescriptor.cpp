@@ -1,3 +1,5 @@
+#include "decodeEmbeddedImage.h"
+
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/NetworkAssetDescriptor.h>
@@ -9,6 +11,7 @@
 #include <CesiumUtility/Result.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -41,21 +44,31 @@ bool NetworkImageAssetDescriptor::operator==(
          this->ktx2TranscodeTargets.UASTC_RGB ==
              rhs.ktx2TranscodeTargets.UASTC_RGB &&
          this->ktx2TranscodeTargets.UASTC_RGBA ==
-             rhs.ktx2TranscodeTargets.UASTC_RGBA;
+             rhs.ktx2TranscodeTargets.UASTC_RGBA &&
+         this->imageCompressionFormat == rhs.imageCompressionFormat &&
+         this->maximumImageDimension == rhs.maximumImageDimension;
 }
 
 Future<ResultPointer<ImageAsset>> NetworkImageAssetDescriptor::load(
     const AsyncSystem& asyncSystem,
     const std::shared_ptr<IAssetAccessor>& pAssetAccessor) const {
   return this->loadBytesFromNetwork(asyncSystem, pAssetAccessor)
-      .thenInWorkerThread([ktx2TranscodeTargets = this->ktx2TranscodeTargets](
+      .thenInWorkerThread([ktx2TranscodeTargets = this->ktx2TranscodeTargets,
+                           imageCompressionFormat =
+                               this->imageCompressionFormat,
+                           maximumImageDimension =
+                               this->maximumImageDimension](
                               Result<std::vector<std::byte>>&& result) {
         if (!result.value) {
           return ResultPointer<ImageAsset>(result.errors);
         }
 
-        ImageReaderResult imageResult =
-            ImageDecoder::readImage(*result.value, ktx2TranscodeTargets);
+        ImageReaderResult imageResult = decodeImage(
+            *result.value,
+            ktx2TranscodeTargets,
+            imageCompressionFormat,
+            maximumImageDimension,
+            nullptr);
 
         result.errors.merge(
             ErrorList{imageResult.errors, imageResult.warnings});
@@ -82,5 +95,9 @@ std::size_t std::hash<NetworkImageAssetDescriptor>::operator()(
   result = Hash::combine(result, ktxHash(key.ktx2TranscodeTargets.UASTC_RG));
   result = Hash::combine(result, ktxHash(key.ktx2TranscodeTargets.UASTC_RGB));
   result = Hash::combine(result, ktxHash(key.ktx2TranscodeTargets.UASTC_RGBA));
+  result = Hash::combine(result, ktxHash(key.imageCompressionFormat));
+  result = Hash::combine(
+      result,
+      std::hash<int32_t>{}(key.maximumImageDimension));
   return result;
 }
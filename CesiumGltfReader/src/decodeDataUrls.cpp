@@ -1,4 +1,5 @@
 #include "decodeDataUrls.h"
+#include "decodeEmbeddedImage.h"
 
 #include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/Image.h>
@@ -143,9 +144,12 @@ void decodeDataUrls(
       continue;
     }
 
-    ImageReaderResult imageResult = ImageDecoder::readImage(
+    ImageReaderResult imageResult = decodeImage(
         decoded.value().data,
-        options.ktx2TranscodeTargets);
+        options.ktx2TranscodeTargets,
+        options.imageCompressionFormat,
+        options.maximumImageDimension,
+        options.pByteBufferPool);
 
     if (!imageResult.pImage) {
       continue;
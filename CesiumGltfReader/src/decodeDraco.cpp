@@ -23,6 +23,7 @@
 #include <span>
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -40,37 +41,33 @@ namespace CesiumGltfReader {
 
 namespace {
 std::unique_ptr<draco::Mesh> decodeBufferViewToDracoMesh(
-    GltfReaderResult& readGltf,
-    CesiumGltf::MeshPrimitive& /* primitive */,
-    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
+    const CesiumGltf::Model& model,
+    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco,
+    std::vector<std::string>& warnings) {
   CESIUM_TRACE("CesiumGltfReader::decodeBufferViewToDracoMesh");
-  CESIUM_ASSERT(readGltf.model.has_value());
-  CesiumGltf::Model& model = readGltf.model.value();
 
-  CesiumGltf::BufferView* pBufferView =
+  const CesiumGltf::BufferView* pBufferView =
       CesiumGltf::Model::getSafe(&model.bufferViews, draco.bufferView);
   if (!pBufferView) {
-    readGltf.warnings.emplace_back("Draco bufferView index is invalid.");
+    warnings.emplace_back("Draco bufferView index is invalid.");
     return nullptr;
   }
 
   const CesiumGltf::BufferView& bufferView = *pBufferView;
 
-  CesiumGltf::Buffer* pBuffer =
+  const CesiumGltf::Buffer* pBuffer =
       CesiumGltf::Model::getSafe(&model.buffers, bufferView.buffer);
   if (!pBuffer) {
-    readGltf.warnings.emplace_back(
-        "Draco bufferView has an invalid buffer index.");
+    warnings.emplace_back("Draco bufferView has an invalid buffer index.");
     return nullptr;
   }
 
-  CesiumGltf::Buffer& buffer = *pBuffer;
+  const CesiumGltf::Buffer& buffer = *pBuffer;
 
   if (bufferView.byteOffset < 0 || bufferView.byteLength < 0 ||
       bufferView.byteOffset + bufferView.byteLength >
           static_cast<int64_t>(buffer.cesium.data.size())) {
-    readGltf.warnings.emplace_back(
-        "Draco bufferView extends beyond its buffer.");
+    warnings.emplace_back("Draco bufferView extends beyond its buffer.");
     return nullptr;
   }
 
@@ -86,7 +83,7 @@ std::unique_ptr<draco::Mesh> decodeBufferViewToDracoMesh(
   draco::StatusOr<std::unique_ptr<draco::Mesh>> result =
       decoder.DecodeMeshFromBuffer(&decodeBuffer);
   if (!result.ok()) {
-    readGltf.warnings.emplace_back(
+    warnings.emplace_back(
         std::string("Draco decoding failed: ") +
         result.status().error_msg_string());
     return nullptr;
@@ -287,21 +284,16 @@ void copyDecodedAttribute(
   }
 }
 
-void decodePrimitive(
+void copyDecodedPrimitive(
     GltfReaderResult& readGltf,
     CesiumGltf::MeshPrimitive& primitive,
-    CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
-  CESIUM_TRACE("CesiumGltfReader::decodePrimitive");
+    CesiumGltf::ExtensionKhrDracoMeshCompression& draco,
+    draco::Mesh* pMesh) {
+  CESIUM_TRACE("CesiumGltfReader::copyDecodedPrimitive");
   CESIUM_ASSERT(readGltf.model.has_value());
   CesiumGltf::Model& model = readGltf.model.value();
 
-  std::unique_ptr<draco::Mesh> pMesh =
-      decodeBufferViewToDracoMesh(readGltf, primitive, draco);
-  if (!pMesh) {
-    return;
-  }
-
-  copyDecodedIndices(readGltf, primitive, pMesh.get());
+  copyDecodedIndices(readGltf, primitive, pMesh);
 
   for (const std::pair<const std::string, int32_t>& attribute :
        draco.attributes) {
@@ -334,12 +326,7 @@ void decodePrimitive(
       continue;
     }
 
-    copyDecodedAttribute(
-        readGltf,
-        primitive,
-        pAccessor,
-        pMesh.get(),
-        pAttribute);
+    copyDecodedAttribute(readGltf, primitive, pAccessor, pMesh, pAttribute);
   }
 }
 } // namespace
@@ -352,6 +339,9 @@ void decodeDraco(CesiumGltfReader::GltfReaderResult& readGltf) {
 
   CesiumGltf::Model& model = readGltf.model.value();
 
+  // Decode and copy one primitive at a time, so that only one decoded mesh is
+  // held in memory at once. Parallel post-processing instead uses
+  // findDracoPrimitives, decodeDracoPrimitive and applyDecodedDracoPrimitives.
   for (CesiumGltf::Mesh& mesh : model.meshes) {
     for (CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
       CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco =
@@ -361,7 +351,11 @@ void decodeDraco(CesiumGltfReader::GltfReaderResult& readGltf) {
         continue;
       }
 
-      decodePrimitive(readGltf, primitive, *pDraco);
+      std::unique_ptr<draco::Mesh> pMesh =
+          decodeBufferViewToDracoMesh(model, *pDraco, readGltf.warnings);
+      if (pMesh) {
+        copyDecodedPrimitive(readGltf, primitive, *pDraco, pMesh.get());
+      }
 
       // Remove the Draco extension as it no longer applies.
       primitive.extensions.erase(
@@ -373,4 +367,57 @@ void decodeDraco(CesiumGltfReader::GltfReaderResult& readGltf) {
       CesiumGltf::ExtensionKhrDracoMeshCompression::ExtensionName);
 }
 
+std::vector<DracoPrimitive> findDracoPrimitives(CesiumGltf::Model& model) {
+  std::vector<DracoPrimitive> result;
+
+  for (CesiumGltf::Mesh& mesh : model.meshes) {
+    for (CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+      CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco =
+          primitive
+              .getExtension<CesiumGltf::ExtensionKhrDracoMeshCompression>();
+      if (pDraco) {
+        result.emplace_back(DracoPrimitive{&primitive, pDraco, nullptr, {}});
+      }
+    }
+  }
+
+  return result;
+}
+
+void decodeDracoPrimitive(
+    const CesiumGltf::Model& model,
+    DracoPrimitive& primitive) {
+  primitive.pMesh =
+      decodeBufferViewToDracoMesh(model, *primitive.pDraco, primitive.warnings);
+}
+
+void applyDecodedDracoPrimitives(
+    GltfReaderResult& readGltf,
+    std::vector<DracoPrimitive>& primitives) {
+  CESIUM_ASSERT(readGltf.model.has_value());
+  CesiumGltf::Model& model = readGltf.model.value();
+
+  for (DracoPrimitive& primitive : primitives) {
+    readGltf.warnings.insert(
+        readGltf.warnings.end(),
+        primitive.warnings.begin(),
+        primitive.warnings.end());
+
+    if (primitive.pMesh) {
+      copyDecodedPrimitive(
+          readGltf,
+          *primitive.pPrimitive,
+          *primitive.pDraco,
+          primitive.pMesh.get());
+    }
+
+    // Remove the Draco extension as it no longer applies.
+    primitive.pPrimitive->extensions.erase(
+        CesiumGltf::ExtensionKhrDracoMeshCompression::ExtensionName);
+  }
+
+  model.removeExtensionRequired(
+      CesiumGltf::ExtensionKhrDracoMeshCompression::ExtensionName);
+}
+
 } // namespace CesiumGltfReader
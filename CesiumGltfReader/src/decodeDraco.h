@@ -1,7 +1,55 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace draco {
+class Mesh;
+}
+
+namespace CesiumGltf {
+struct ExtensionKhrDracoMeshCompression;
+struct MeshPrimitive;
+struct Model;
+} // namespace CesiumGltf
+
 namespace CesiumGltfReader {
 struct GltfReaderResult;
 
 void decodeDraco(GltfReaderResult& readGltf);
+
+/**
+ * @brief A primitive that is compressed with `KHR_draco_mesh_compression`,
+ * and its decoded mesh once {@link decodeDracoPrimitive} has been called.
+ */
+struct DracoPrimitive {
+  CesiumGltf::MeshPrimitive* pPrimitive;
+  CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco;
+  std::shared_ptr<draco::Mesh> pMesh;
+  std::vector<std::string> warnings;
+};
+
+/**
+ * @brief Finds the primitives in the model that are compressed with Draco.
+ */
+std::vector<DracoPrimitive> findDracoPrimitives(CesiumGltf::Model& model);
+
+/**
+ * @brief Decodes the Draco data of one primitive.
+ *
+ * The model is only read, so this may be called for different primitives of
+ * the same model from multiple threads at once.
+ */
+void decodeDracoPrimitive(
+    const CesiumGltf::Model& model,
+    DracoPrimitive& primitive);
+
+/**
+ * @brief Copies the decoded meshes into the model, and removes the Draco
+ * extension from it.
+ */
+void applyDecodedDracoPrimitives(
+    GltfReaderResult& readGltf,
+    std::vector<DracoPrimitive>& primitives);
 } // namespace CesiumGltfReader
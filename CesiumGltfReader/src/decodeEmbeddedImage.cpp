@@ -0,0 +1,87 @@
+#include "decodeEmbeddedImage.h"
+
+#include <CesiumGltf/Image.h>
+#include <CesiumGltf/Ktx2TranscodeTargets.h>
+#include <CesiumGltfReader/GltfReader.h>
+#include <CesiumGltfReader/ImageDecoder.h>
+#include <CesiumUtility/ByteBufferPool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+using namespace CesiumGltf;
+using namespace CesiumUtility;
+
+namespace CesiumGltfReader {
+
+ImageReaderResult decodeImage(
+    const std::span<const std::byte>& data,
+    const Ktx2TranscodeTargets& ktx2TranscodeTargets,
+    GpuCompressedPixelFormat imageCompressionFormat,
+    int32_t maximumImageDimension,
+    const std::shared_ptr<ByteBufferPool>& pPixelDataPool) {
+  ImageReaderResult result = ImageDecoder::readImage(
+      data,
+      ktx2TranscodeTargets,
+      maximumImageDimension,
+      pPixelDataPool);
+  if (result.pImage &&
+      imageCompressionFormat != GpuCompressedPixelFormat::NONE) {
+    std::optional<std::string> error =
+        ImageDecoder::compressImage(*result.pImage, imageCompressionFormat);
+    if (error) {
+      result.warnings.emplace_back(std::move(*error));
+    }
+  }
+  return result;
+}
+
+void decodeEmbeddedImage(
+    GltfReaderResult& readGltf,
+    Image& image,
+    const std::span<const std::byte>& data,
+    const Ktx2TranscodeTargets& ktx2TranscodeTargets,
+    GpuCompressedPixelFormat imageCompressionFormat,
+    int32_t maximumImageDimension,
+    const std::shared_ptr<ByteBufferPool>& pPixelDataPool) {
+  setDecodedImage(
+      readGltf,
+      image,
+      decodeImage(
+          data,
+          ktx2TranscodeTargets,
+          imageCompressionFormat,
+          maximumImageDimension,
+          pPixelDataPool));
+}
+
+void setDecodedImage(
+    GltfReaderResult& readGltf,
+    Image& image,
+    ImageReaderResult&& imageResult) {
+  readGltf.warnings.insert(
+      readGltf.warnings.end(),
+      imageResult.warnings.begin(),
+      imageResult.warnings.end());
+  readGltf.errors.insert(
+      readGltf.errors.end(),
+      imageResult.errors.begin(),
+      imageResult.errors.end());
+  if (imageResult.pImage) {
+    image.pAsset = std::move(imageResult.pImage);
+  } else {
+    if (image.mimeType) {
+      readGltf.errors.emplace_back(
+          "Declared image MIME Type: " + image.mimeType.value());
+    } else {
+      readGltf.errors.emplace_back("Image does not declare a MIME Type");
+    }
+  }
+}
+
+} // namespace CesiumGltfReader
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <CesiumGltf/Ktx2TranscodeTargets.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace CesiumGltf {
+struct Image;
+} // namespace CesiumGltf
+
+namespace CesiumUtility {
+class ByteBufferPool;
+} // namespace CesiumUtility
+
+namespace CesiumGltfReader {
+struct GltfReaderResult;
+struct ImageReaderResult;
+
+/**
+ * @brief Reads an image with {@link ImageDecoder::readImage}, then compresses
+ * it with {@link ImageDecoder::compressImage} unless `imageCompressionFormat`
+ * is `NONE`. A failure to compress is reported as a warning.
+ */
+ImageReaderResult decodeImage(
+    const std::span<const std::byte>& data,
+    const CesiumGltf::Ktx2TranscodeTargets& ktx2TranscodeTargets,
+    CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat,
+    int32_t maximumImageDimension,
+    const std::shared_ptr<CesiumUtility::ByteBufferPool>& pPixelDataPool);
+
+/**
+ * @brief Decodes an image from the bytes of its buffer view, and reports any
+ * problems in the given result.
+ */
+void decodeEmbeddedImage(
+    GltfReaderResult& readGltf,
+    CesiumGltf::Image& image,
+    const std::span<const std::byte>& data,
+    const CesiumGltf::Ktx2TranscodeTargets& ktx2TranscodeTargets,
+    CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat,
+    int32_t maximumImageDimension,
+    const std::shared_ptr<CesiumUtility::ByteBufferPool>& pPixelDataPool);
+
+/**
+ * @brief Sets an image from the result of decoding it, and reports any
+ * problems in the given result.
+ */
+void setDecodedImage(
+    GltfReaderResult& readGltf,
+    CesiumGltf::Image& image,
+    ImageReaderResult&& imageResult);
+} // namespace CesiumGltfReader
@@ -273,6 +273,27 @@ TEST_CASE("Read TriangleWithPaddingInGlbBin") {
   REQUIRE(result.warnings.size() == 1);
 }
 
+TEST_CASE("Adopts the binary chunk of a GLB that is moved in") {
+  std::filesystem::path glbFile = CesiumGltfReader_TEST_DATA_DIR;
+  glbFile /= "TriangleWithPaddingInGlbBin/TriangleWithPaddingInGlbBin.glb";
+  std::vector<std::byte> data = readFile(glbFile);
+
+  GltfReader reader;
+  GltfReaderResult copied = reader.readGltf(data);
+  REQUIRE(copied.model);
+
+  const std::byte* pOriginal = data.data();
+  GltfReaderResult adopted = reader.readGltf(std::move(data));
+  REQUIRE(adopted.model);
+  CHECK(adopted.warnings == copied.warnings);
+
+  REQUIRE(adopted.model->buffers.size() == 1);
+  const std::vector<std::byte>& bufferData =
+      adopted.model->buffers[0].cesium.data;
+  CHECK(bufferData == copied.model->buffers[0].cesium.data);
+  CHECK(bufferData.data() == pOriginal);
+}
+
 TEST_CASE("Nested extras deserializes properly") {
   const std::string s = R"(
     {
@@ -662,6 +683,25 @@ TEST_CASE("Decodes images with data uris") {
   CHECK(size_t(buffer.byteLength) == buffer.cesium.data.size());
 }
 
+TEST_CASE("Decodes images no larger than maximumImageDimension") {
+  GltfReader reader;
+  GltfReaderOptions options;
+  options.maximumImageDimension = 100;
+  GltfReaderResult result = reader.readGltf(
+      readFile(
+          CesiumGltfReader_TEST_DATA_DIR + std::string("/BoxTextured.gltf")),
+      options);
+
+  REQUIRE(result.errors.empty());
+  REQUIRE(result.model);
+  REQUIRE(result.model->images.size() == 1);
+
+  const ImageAsset& image = *result.model->images.front().pAsset;
+  CHECK(image.width == 64);
+  CHECK(image.height == 64);
+  CHECK(image.pixelData.size() == size_t(64 * 64 * 4));
+}
+
 TEST_CASE("Decode buffer with data URI whose length does match the buffer's "
           "byteLength") {
   std::vector<std::byte> gltfBytes = readFile(
@@ -775,6 +815,67 @@ TEST_CASE("GltfReader::loadGltf") {
     CHECK(image.uri.has_value());
     CHECK(!image.pAsset);
   }
+
+  SUBCASE("decodes Draco primitives in parallel") {
+    GltfReader reader{};
+    GltfReaderResult expected = waitForFuture(
+        asyncSystem,
+        reader.loadGltf(asyncSystem, uri, {}, pMockAssetAccessor));
+    REQUIRE(expected.model);
+
+    GltfReaderOptions options;
+    options.parallelPostprocessing = true;
+    GltfReaderResult result = waitForFuture(
+        asyncSystem,
+        reader.loadGltf(asyncSystem, uri, {}, pMockAssetAccessor, options));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+    CHECK(result.warnings == expected.warnings);
+
+    for (const CesiumGltf::Mesh& mesh : result.model->meshes) {
+      for (const CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+        CHECK(!primitive.hasExtension<ExtensionKhrDracoMeshCompression>());
+      }
+    }
+    REQUIRE(result.model->buffers.size() == expected.model->buffers.size());
+    for (size_t i = 0; i < result.model->buffers.size(); ++i) {
+      CHECK(
+          result.model->buffers[i].cesium.data ==
+          expected.model->buffers[i].cesium.data);
+    }
+  }
+}
+
+TEST_CASE("GltfReader::readGltf with an AsyncSystem") {
+  auto pMockTaskProcessor = std::make_shared<SimpleTaskProcessor>();
+  CesiumAsync::AsyncSystem asyncSystem{pMockTaskProcessor};
+
+  std::filesystem::path glbFile = CesiumGltfReader_TEST_DATA_DIR;
+  glbFile /= "CesiumBalloon.glb";
+  const std::vector<std::byte> data = readFile(glbFile);
+
+  GltfReader reader;
+  const GltfReaderResult expected = reader.readGltf(data);
+  REQUIRE(expected.model);
+
+  for (const bool parallel : {false, true}) {
+    GltfReaderOptions options;
+    options.parallelPostprocessing = parallel;
+    GltfReaderResult result = waitForFuture(
+        asyncSystem,
+        reader.readGltf(asyncSystem, std::span(data), options));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+    CHECK(result.warnings == expected.warnings);
+
+    REQUIRE(result.model->images.size() == expected.model->images.size());
+    for (size_t i = 0; i < result.model->images.size(); ++i) {
+      const CesiumGltf::Image& image = result.model->images[i];
+      const CesiumGltf::Image& expectedImage = expected.model->images[i];
+      REQUIRE(image.pAsset);
+      CHECK(image.pAsset->pixelData == expectedImage.pAsset->pixelData);
+    }
+  }
 }
 
 TEST_CASE("GltfReader::postprocessGltf") {
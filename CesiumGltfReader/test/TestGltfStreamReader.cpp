@@ -0,0 +1,97 @@
+#include <CesiumGltf/Image.h>
+#include <CesiumGltf/ImageAsset.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfReader/GltfReader.h>
+#include <CesiumGltfReader/GltfStreamReader.h>
+#include <CesiumNativeTests/readFile.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+using namespace CesiumGltf;
+using namespace CesiumGltfReader;
+using namespace CesiumNativeTests;
+
+namespace {
+
+GltfReaderResult readInChunks(
+    const GltfReader& reader,
+    const std::vector<std::byte>& data,
+    size_t chunkSize) {
+  GltfStreamReader streamReader(reader);
+  const std::span<const std::byte> dataSpan(data);
+  for (size_t i = 0; i < data.size(); i += chunkSize) {
+    streamReader.append(
+        dataSpan.subspan(i, std::min(chunkSize, data.size() - i)));
+  }
+  CHECK(streamReader.getBytesReceived() == data.size());
+  return streamReader.finish();
+}
+
+} // namespace
+
+TEST_CASE("GltfStreamReader") {
+  GltfReader reader;
+
+  SUBCASE("reads a GLB in chunks of any size") {
+    std::filesystem::path glbFile = CesiumGltfReader_TEST_DATA_DIR;
+    glbFile /= "CesiumBalloon.glb";
+    const std::vector<std::byte> data = readFile(glbFile);
+
+    const GltfReaderResult expected = reader.readGltf(data);
+    REQUIRE(expected.model);
+    REQUIRE(expected.model->images.size() == 3);
+
+    for (size_t chunkSize : {size_t(1), size_t(1000), data.size()}) {
+      const GltfReaderResult result = readInChunks(reader, data, chunkSize);
+      REQUIRE(result.model);
+      CHECK(result.errors.empty());
+      CHECK(result.warnings == expected.warnings);
+
+      REQUIRE(result.model->buffers.size() == 1);
+      CHECK(
+          result.model->buffers[0].cesium.data ==
+          expected.model->buffers[0].cesium.data);
+
+      REQUIRE(result.model->images.size() == expected.model->images.size());
+      for (size_t i = 0; i < result.model->images.size(); ++i) {
+        const Image& image = result.model->images[i];
+        const Image& expectedImage = expected.model->images[i];
+        REQUIRE(image.pAsset);
+        CHECK(image.pAsset->width == expectedImage.pAsset->width);
+        CHECK(image.pAsset->height == expectedImage.pAsset->height);
+        CHECK(image.pAsset->pixelData == expectedImage.pAsset->pixelData);
+      }
+    }
+  }
+
+  SUBCASE("reads a JSON glTF") {
+    std::filesystem::path gltfFile = CesiumGltfReader_TEST_DATA_DIR;
+    gltfFile /=
+        "TriangleWithoutIndices/glTF-Embedded/TriangleWithoutIndices.gltf";
+    const std::vector<std::byte> data = readFile(gltfFile);
+
+    const GltfReaderResult result = readInChunks(reader, data, 5);
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+    CHECK(result.model->meshes.size() == 1);
+    REQUIRE(result.model->buffers.size() == 1);
+    CHECK(!result.model->buffers[0].cesium.data.empty());
+  }
+
+  SUBCASE("reports a truncated GLB") {
+    std::filesystem::path glbFile = CesiumGltfReader_TEST_DATA_DIR;
+    glbFile /= "TriangleWithPaddingInGlbBin/TriangleWithPaddingInGlbBin.glb";
+    std::vector<std::byte> data = readFile(glbFile);
+    data.resize(data.size() - 10);
+
+    const GltfReaderResult result = readInChunks(reader, data, 16);
+    CHECK(!result.model);
+    CHECK(!result.errors.empty());
+  }
+}
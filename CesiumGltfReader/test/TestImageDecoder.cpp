@@ -1,15 +1,21 @@
 #include <CesiumGltf/ImageAsset.h>
 #include <CesiumGltfReader/ImageDecoder.h>
 #include <CesiumNativeTests/readFile.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <doctest/doctest.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 using namespace CesiumGltf;
 using namespace CesiumGltfReader;
+using namespace CesiumUtility;
 
 TEST_CASE("CesiumGltfReader::ImageDecoder") {
   SUBCASE("Can correctly interpret mipmaps in KTX2 files") {
@@ -72,4 +78,151 @@ TEST_CASE("CesiumGltfReader::ImageDecoder") {
       }
     }
   }
+  SUBCASE("Can decode images at a reduced size") {
+    std::filesystem::path jpegFile = CesiumGltfReader_TEST_DATA_DIR;
+    jpegFile /= "ktx2/kota.jpg";
+    std::vector<std::byte> data = readFile(jpegFile.string());
+
+    ImageReaderResult full = ImageDecoder::readImage(data, {});
+    REQUIRE(full.pImage);
+    CHECK(full.pImage->width == 256);
+    CHECK(full.pImage->height == 192);
+
+    // Within the range of scales that JPEG decoding supports directly.
+    ImageReaderResult quarter = ImageDecoder::readImage(data, {}, 100);
+    REQUIRE(quarter.pImage);
+    CHECK(quarter.warnings.empty());
+    CHECK(quarter.pImage->width == 64);
+    CHECK(quarter.pImage->height == 48);
+    CHECK(quarter.pImage->pixelData.size() == size_t(64 * 48 * 4));
+
+    // Smaller than 1/8, so the decoded image must be resized further.
+    ImageReaderResult tiny = ImageDecoder::readImage(data, {}, 20);
+    REQUIRE(tiny.pImage);
+    CHECK(tiny.warnings.empty());
+    CHECK(tiny.pImage->width == 16);
+    CHECK(tiny.pImage->height == 12);
+    CHECK(tiny.pImage->pixelData.size() == size_t(16 * 12 * 4));
+  }
+  SUBCASE("Allocates pixel data from a pool") {
+    std::filesystem::path jpegFile = CesiumGltfReader_TEST_DATA_DIR;
+    jpegFile /= "ktx2/kota.jpg";
+    std::vector<std::byte> data = readFile(jpegFile.string());
+
+    auto pPool = std::make_shared<ByteBufferPool>(1024 * 1024);
+
+    ImageReaderResult first = ImageDecoder::readImage(data, {}, 0, pPool);
+    REQUIRE(first.pImage);
+    CHECK(first.pImage->pPixelDataPool == pPool);
+    first.pImage.reset();
+    CHECK(pPool->getStatistics().released == 1);
+    CHECK(pPool->getStatistics().pooledBytes > 0);
+
+    // The second image of the same size reuses the first one's pixel data.
+    ImageReaderResult second = ImageDecoder::readImage(data, {}, 0, pPool);
+    REQUIRE(second.pImage);
+    CHECK(second.pImage->pixelData.size() == size_t(256 * 192 * 4));
+    CHECK(pPool->getStatistics().reused == 1);
+  }
+
+  SUBCASE("Generates mipmaps by averaging 2x2 blocks") {
+    ImageAsset image;
+    image.width = 4;
+    image.height = 2;
+    image.channels = 2;
+    image.bytesPerChannel = 1;
+    // Each pixel alternates between black and white, and between transparent
+    // and opaque.
+    for (int32_t i = 0; i < image.width * image.height; ++i) {
+      const std::byte value = i % 2 == 0 ? std::byte(0) : std::byte(255);
+      image.pixelData.push_back(value);
+      image.pixelData.push_back(value);
+    }
+
+    SUBCASE("in gamma space") {
+      CHECK(!ImageDecoder::generateMipMaps(image));
+      REQUIRE(image.mipPositions.size() == 3);
+      CHECK(image.mipPositions[1].byteSize == 2 * 1 * 2);
+      CHECK(image.mipPositions[2].byteSize == 1 * 1 * 2);
+      for (size_t i = image.mipPositions[1].byteOffset;
+           i < image.pixelData.size();
+           ++i) {
+        CHECK(image.pixelData[i] == std::byte(128));
+      }
+    }
+
+    SUBCASE("in linear space") {
+      CHECK(!ImageDecoder::generateMipMaps(image, true));
+      REQUIRE(image.mipPositions.size() == 3);
+      for (size_t i = image.mipPositions[1].byteOffset;
+           i < image.pixelData.size();
+           i += 2) {
+        // Half of full intensity in linear space, encoded as sRGB.
+        CHECK(image.pixelData[i] == std::byte(188));
+        // Alpha is not gamma encoded.
+        CHECK(image.pixelData[i + 1] == std::byte(128));
+      }
+    }
+  }
+
+  SUBCASE("Can compress images with mipmaps") {
+    ImageAsset image;
+    image.width = 8;
+    image.height = 4;
+    image.channels = 4;
+    image.bytesPerChannel = 1;
+    image.pixelData.resize(8 * 4 * 4);
+    for (size_t i = 0; i < image.pixelData.size(); ++i) {
+      image.pixelData[i] = std::byte(i * 7 % 256);
+    }
+
+    SUBCASE("BC1") {
+      std::optional<std::string> error =
+          ImageDecoder::compressImage(image, GpuCompressedPixelFormat::BC1_RGB);
+      CHECK(!error);
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::BC1_RGB);
+
+      // 8x4, 4x2, 2x1, and 1x1 mips, each padded to whole 4x4 blocks of 8
+      // bytes.
+      REQUIRE(image.mipPositions.size() == 4);
+      const size_t expectedSizes[] = {16, 8, 8, 8};
+      size_t byteOffset = 0;
+      for (size_t i = 0; i < image.mipPositions.size(); ++i) {
+        CHECK(image.mipPositions[i].byteOffset == byteOffset);
+        CHECK(image.mipPositions[i].byteSize == expectedSizes[i]);
+        byteOffset += expectedSizes[i];
+      }
+      CHECK(image.pixelData.size() == byteOffset);
+    }
+
+    SUBCASE("BC3") {
+      std::optional<std::string> error = ImageDecoder::compressImage(
+          image,
+          GpuCompressedPixelFormat::BC3_RGBA);
+      CHECK(!error);
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::BC3_RGBA);
+      REQUIRE(image.mipPositions.size() == 4);
+      CHECK(image.mipPositions[0].byteSize == 32);
+      CHECK(image.pixelData.size() == 32 + 16 + 16 + 16);
+    }
+
+    SUBCASE("unsupported formats are reported") {
+      std::optional<std::string> error = ImageDecoder::compressImage(
+          image,
+          GpuCompressedPixelFormat::BC7_RGBA);
+      CHECK(error);
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+    }
+
+    SUBCASE("sizes that aren't a multiple of four are left uncompressed") {
+      image.width = 6;
+      image.pixelData.resize(6 * 4 * 4);
+      std::optional<std::string> error =
+          ImageDecoder::compressImage(image, GpuCompressedPixelFormat::BC1_RGB);
+      CHECK(!error);
+      CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+      CHECK(image.mipPositions.empty());
+      CHECK(image.pixelData.size() == 6 * 4 * 4);
+    }
+  }
 }
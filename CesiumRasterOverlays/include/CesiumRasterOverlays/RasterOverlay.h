@@ -6,6 +6,7 @@
 #include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumRasterOverlays/Library.h>
 #include <CesiumRasterOverlays/RasterOverlayLoadFailureDetails.h>
+#include <CesiumUtility/ByteBufferPool.h>
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumUtility/ReferenceCounted.h>
 
@@ -83,6 +84,29 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayOptions {
    */
   CesiumGltf::Ktx2TranscodeTargets ktx2TranscodeTargets;
 
+  /**
+   * @brief The gpu-compressed pixel format to compress raster overlay images
+   * into, or GpuCompressedPixelFormat::NONE to leave them uncompressed.
+   *
+   * Each image is compressed, along with a full chain of mipmaps, in a worker
+   * thread just before it is passed to
+   * {@link IPrepareRasterOverlayRendererResources::prepareRasterInLoadThread}.
+   * See {@link CesiumGltfReader::ImageDecoder::compressImage}.
+   */
+  CesiumGltf::GpuCompressedPixelFormat imageCompressionFormat =
+      CesiumGltf::GpuCompressedPixelFormat::NONE;
+
+  /**
+   * @brief The pool to allocate the pixel data of raster overlay images from,
+   * or nullptr to allocate it normally.
+   *
+   * Overlay tiles are loaded and freed continuously as the camera moves, and
+   * most of them have the same size, so recycling their pixel data avoids a
+   * large allocation for nearly every tile. The pool may be shared with
+   * {@link CesiumGltfReader::GltfReaderOptions::pByteBufferPool}.
+   */
+  std::shared_ptr<CesiumUtility::ByteBufferPool> pPixelDataPool;
+
   /**
    * @brief A callback function that is invoked when a raster overlay resource
    * fails to load.
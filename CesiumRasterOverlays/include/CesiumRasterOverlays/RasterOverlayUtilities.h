@@ -5,9 +5,11 @@
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumRasterOverlays/Library.h>
 #include <CesiumRasterOverlays/RasterOverlayDetails.h>
+#include <CesiumUtility/ByteBufferPool.h>
 
 #include <glm/fwd.hpp>
 
+#include <memory>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -79,6 +81,8 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
    * {@link DEFAULT_TEXTURE_COORDINATE_BASE_NAME}.
    * @param firstTextureCoordinateID The texture coordinate ID of the first
    * projection.
+   * @param pBufferPool The pool to allocate the data of the new texture
+   * coordinate buffers from, or nullptr to allocate it normally.
    * @return The details of the generated texture coordinates.
    */
   static std::optional<RasterOverlayDetails>
@@ -90,7 +94,9 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
       bool invertVCoordinate = false,
       const std::string_view& textureCoordinateAttributeBaseName =
           DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
-      int32_t firstTextureCoordinateID = 0);
+      int32_t firstTextureCoordinateID = 0,
+      const std::shared_ptr<CesiumUtility::ByteBufferPool>& pBufferPool =
+          nullptr);
 
   /**
    * @brief Creates a new glTF model from one of the quadtree children of the
@@ -117,6 +123,8 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
    * `_CESIUMOVERLAY_` and this parameter is 0 (the defaults), then the texture
    * coordinates are read from a vertex attribute named `_CESIUMOVERLAY_0`.
    * @param ellipsoid The {@link CesiumGeospatial::Ellipsoid}.
+   * @param pBufferPool The pool to allocate the data of the upsampled vertex
+   * and index buffers from, or nullptr to allocate it normally.
    * @return The upsampled model.
    */
   static std::optional<CesiumGltf::Model> upsampleGltfForRasterOverlays(
@@ -127,7 +135,9 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
           DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
       int32_t textureCoordinateIndex = 0,
       const CesiumGeospatial::Ellipsoid& ellipsoid =
-          CesiumGeospatial::Ellipsoid::WGS84);
+          CesiumGeospatial::Ellipsoid::WGS84,
+      const std::shared_ptr<CesiumUtility::ByteBufferPool>& pBufferPool =
+          nullptr);
 
   /**
    * @brief Computes the desired screen pixels for a raster overlay texture.
@@ -2,6 +2,7 @@
 
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumRasterOverlays/Library.h>
@@ -39,6 +40,9 @@ public:
    * @param projection The projection that this RasterOverlay is being generated
    * for.
    * @param overlayOptions Options to use for this RasterOverlay.
+   * @param antiAliasing If true, pixels on the edges of the polygons are
+   * shaded according to how much of the pixel is covered by the polygons,
+   * instead of being entirely inside or outside.
    */
   RasterizedPolygonsOverlay(
       const std::string& name,
@@ -46,7 +50,8 @@ public:
       bool invertSelection,
       const CesiumGeospatial::Ellipsoid& ellipsoid,
       const CesiumGeospatial::Projection& projection,
-      const RasterOverlayOptions& overlayOptions = {});
+      const RasterOverlayOptions& overlayOptions = {},
+      bool antiAliasing = false);
   virtual ~RasterizedPolygonsOverlay() override;
 
   virtual CesiumAsync::Future<CreateTileProviderResult> createTileProvider(
@@ -64,7 +69,17 @@ public:
    */
   const std::vector<CesiumGeospatial::CartographicPolygon>&
   getPolygons() const noexcept {
-    return this->_polygons;
+    return this->_pPolygonIndex->getPolygons();
+  }
+
+  /**
+   * @brief Gets the spatial index over the polygons that are being rasterized
+   * to create this overlay. It is built once, when this overlay is
+   * constructed.
+   */
+  const CesiumGeospatial::CartographicPolygonIndex&
+  getPolygonIndex() const noexcept {
+    return *this->_pPolygonIndex;
   }
 
   /**
@@ -73,6 +88,12 @@ public:
    */
   bool getInvertSelection() const noexcept { return this->_invertSelection; }
 
+  /**
+   * @brief Gets the value of the `antiAliasing` value passed to the
+   * constructor.
+   */
+  bool getAntiAliasing() const noexcept { return this->_antiAliasing; }
+
   /**
    * @brief Gets the ellipsoid that this overlay is being generated for.
    */
@@ -81,9 +102,11 @@ public:
   }
 
 private:
-  std::vector<CesiumGeospatial::CartographicPolygon> _polygons;
+  std::shared_ptr<const CesiumGeospatial::CartographicPolygonIndex>
+      _pPolygonIndex;
   bool _invertSelection;
   CesiumGeospatial::Ellipsoid _ellipsoid;
   CesiumGeospatial::Projection _projection;
+  bool _antiAliasing;
 };
 } // namespace CesiumRasterOverlays
@@ -3,6 +3,8 @@
 #include <CesiumGeometry/Rectangle.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGltf/ImageAsset.h>
+#include <CesiumGltf/Ktx2TranscodeTargets.h>
+#include <CesiumGltfReader/ImageDecoder.h>
 #include <CesiumRasterOverlays/ActivatedRasterOverlay.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
 #include <CesiumRasterOverlays/RasterOverlayExternals.h>
@@ -14,12 +16,15 @@
 
 #include <glm/ext/vector_double2.hpp>
 #include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
 
 #include <any>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -179,7 +184,8 @@ struct LoadResult {
  * `LoadResult` with the state `RasterOverlayTile::LoadState::Failed` will be
  * returned.
  *
- * Otherwise, the image data will be passed to
+ * Otherwise, the image data will be compressed into `imageCompressionFormat`
+ * and passed to
  * `IPrepareRasterOverlayRendererResources::prepareRasterInLoadThread`, and the
  * function will return a `LoadResult` with the image, the prepared renderer
  * resources, and the state `RasterOverlayTile::LoadState::Loaded`.
@@ -189,6 +195,7 @@ struct LoadResult {
  * @param pLogger The logger
  * @param loadedImage The `LoadedRasterOverlayImage`
  * @param rendererOptions Renderer options
+ * @param imageCompressionFormat The format to compress the image into
  * @return The `LoadResult`
  */
 LoadResult createLoadResultFromLoadedImage(
@@ -196,7 +203,8 @@ LoadResult createLoadResultFromLoadedImage(
         pPrepareRendererResources,
     const std::shared_ptr<spdlog::logger>& pLogger,
     LoadedRasterOverlayImage&& loadedImage,
-    const std::any& rendererOptions) {
+    const std::any& rendererOptions,
+    GpuCompressedPixelFormat imageCompressionFormat) {
   if (!loadedImage.pImage) {
     loadedImage.errorList.logError(pLogger, "Failed to load image for tile");
     LoadResult result;
@@ -228,6 +236,17 @@ LoadResult createLoadResultFromLoadedImage(
         std::to_string(image.height) + "x" + std::to_string(image.channels) +
         "x" + std::to_string(image.bytesPerChannel));
 
+    std::optional<std::string> compressionError =
+        CesiumGltfReader::ImageDecoder::compressImage(
+            image,
+            imageCompressionFormat);
+    if (compressionError) {
+      SPDLOG_LOGGER_WARN(
+          pLogger,
+          "Unable to compress raster overlay image: {}",
+          *compressionError);
+    }
+
     void* pRendererResources = nullptr;
     if (pPrepareRendererResources) {
       pRendererResources = pPrepareRendererResources->prepareRasterInLoadThread(
@@ -277,13 +296,16 @@ ActivatedRasterOverlay::doLoad(RasterOverlayTile& tile, bool isThrottledLoad) {
           [pPrepareRendererResources =
                this->_pTileProvider->getPrepareRendererResources(),
            pLogger = this->_pTileProvider->getLogger(),
-           rendererOptions = this->_pOverlay->getOptions().rendererOptions](
+           rendererOptions = this->_pOverlay->getOptions().rendererOptions,
+           imageCompressionFormat =
+               this->_pOverlay->getOptions().imageCompressionFormat](
               LoadedRasterOverlayImage&& loadedImage) {
             return createLoadResultFromLoadedImage(
                 pPrepareRendererResources,
                 pLogger,
                 std::move(loadedImage),
-                rendererOptions);
+                rendererOptions,
+                imageCompressionFormat);
           })
       .thenInMainThread(
           [thiz, pTile, isThrottledLoad](LoadResult&& result) noexcept {
@@ -162,7 +162,8 @@ RasterOverlayTileProvider::loadTileImageFromUrl(
       .thenInWorkerThread(
           [options = std::move(options),
            Ktx2TranscodeTargets =
-               this->getOwner().getOptions().ktx2TranscodeTargets](
+               this->getOwner().getOptions().ktx2TranscodeTargets,
+           pPixelDataPool = this->getOwner().getOptions().pPixelDataPool](
               std::shared_ptr<IAssetRequest>&& pRequest) mutable {
             CESIUM_TRACE("load image");
             const IAssetResponse* pResponse = pRequest->response();
@@ -219,7 +220,11 @@ RasterOverlayTileProvider::loadTileImageFromUrl(
             const std::span<const std::byte> data = pResponse->data();
 
             CesiumGltfReader::ImageReaderResult loadedImage =
-                ImageDecoder::readImage(data, Ktx2TranscodeTargets);
+                ImageDecoder::readImage(
+                    data,
+                    Ktx2TranscodeTargets,
+                    0,
+                    pPixelDataPool);
 
             if (!loadedImage.errors.empty()) {
               loadedImage.errors.push_back("Image url: " + pRequest->url());
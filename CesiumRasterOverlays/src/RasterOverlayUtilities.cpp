@@ -8,7 +8,7 @@
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumGltf/Accessor.h>
 #include <CesiumGltf/AccessorView.h>
-#include <CesiumGltf/AccessorWriter.h>
+#include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/BufferView.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Image.h>
@@ -21,12 +21,14 @@
 #include <CesiumRasterOverlays/RasterOverlayDetails.h>
 #include <CesiumRasterOverlays/RasterOverlayUtilities.h>
 #include <CesiumUtility/Assert.h>
+#include <CesiumUtility/ByteBufferPool.h>
 #include <CesiumUtility/Math.h>
 #include <CesiumUtility/Tracing.h>
 
 #include <glm/common.hpp>
 #include <glm/detail/setup.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_double2.hpp>
 #include <glm/ext/vector_double3.hpp>
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float3.hpp>
@@ -36,7 +38,9 @@
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -48,9 +52,28 @@ using namespace CesiumGltf;
 using namespace CesiumGltfContent;
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
+using namespace CesiumUtility;
 
 namespace CesiumRasterOverlays {
 
+namespace {
+
+// Sizes the data of a new buffer. If there is a pool, the storage comes from
+// it, and the buffer returns the storage to it when destroyed.
+void allocateBufferData(
+    Buffer& buffer,
+    size_t size,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool) {
+  if (pBufferPool) {
+    buffer.cesium.data = pBufferPool->acquire(size);
+    buffer.cesium.pDataPool = pBufferPool;
+  } else {
+    buffer.cesium.data.resize(size);
+  }
+}
+
+} // namespace
+
 /*static*/ std::optional<RasterOverlayDetails>
 RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
     CesiumGltf::Model& model,
@@ -59,7 +82,8 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
     std::vector<CesiumGeospatial::Projection>&& projections,
     bool invertVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
-    int32_t firstTextureCoordinateID) {
+    int32_t firstTextureCoordinateID,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool) {
   if (projections.empty()) {
     return std::nullopt;
   }
@@ -109,6 +133,31 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
   CesiumGeospatial::BoundingRegionBuilder computedBounds;
   computedBounds.setPoleTolerance(0.001 * bounds.computeHeight());
 
+  // Projections that are the same produce the same texture coordinates, so
+  // they share them. The texture coordinates of the distinct projections are
+  // interleaved in a single buffer, which is written in one pass over the
+  // positions.
+  std::vector<size_t> projectionToDistinct(projections.size());
+  std::vector<size_t> distinctProjections;
+  for (size_t i = 0; i < projections.size(); ++i) {
+    auto it = std::find_if(
+        distinctProjections.begin(),
+        distinctProjections.end(),
+        [&projections, i](size_t j) {
+          return projections[j] == projections[i];
+        });
+    projectionToDistinct[i] = size_t(it - distinctProjections.begin());
+    if (it == distinctProjections.end()) {
+      distinctProjections.emplace_back(i);
+    }
+  }
+
+  std::vector<std::string> attributeNames(projections.size());
+  for (size_t i = 0; i < projections.size(); ++i) {
+    attributeNames[i] = std::string(textureCoordinateAttributeBaseName) +
+                        std::to_string(firstTextureCoordinateID + int32_t(i));
+  }
+
   auto createTextureCoordinatesForPrimitive =
       [&](CesiumGltf::Model& gltf,
           CesiumGltf::Node& /*node*/,
@@ -133,39 +182,12 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           // Already created texture coordinates for this projection, so use
           // them.
           for (size_t i = 0; i < projections.size(); ++i) {
-            std::string attributeName =
-                std::string(textureCoordinateAttributeBaseName) +
-                std::to_string(firstTextureCoordinateID + int32_t(i));
-            primitive.attributes[attributeName] =
+            primitive.attributes[attributeNames[i]] =
                 firstTextureCoordinateAccessorIndex + int32_t(i);
           }
           return;
         }
 
-        const glm::dmat4 fullTransform = rootTransform * nodeTransform;
-
-        std::vector<CesiumGltf::Buffer>& buffers = gltf.buffers;
-        std::vector<CesiumGltf::BufferView>& bufferViews = gltf.bufferViews;
-        std::vector<CesiumGltf::Accessor>& accessors = gltf.accessors;
-
-        positionAccessorsToTextureCoordinateAccessor[size_t(
-            positionAccessorIndex)] = int32_t(gltf.accessors.size());
-
-        // Create a buffer, bufferView, accessor, and writer for each set of
-        // coordinates. Reserve space for them to avoid unnecessary
-        // reallocations and to prevent earlier buffers from becoming invalid
-        // after we've created an AccessorWriter for it and then add _another_
-        // buffer.
-        std::vector<CesiumGltf::AccessorWriter<glm::vec2>> uvWriters;
-        std::vector<std::vector<double>*> mins;
-        std::vector<std::vector<double>*> maxs;
-        uvWriters.reserve(projections.size());
-        mins.reserve(projections.size());
-        maxs.reserve(projections.size());
-        buffers.reserve(buffers.size() + projections.size());
-        bufferViews.reserve(bufferViews.size() + projections.size());
-        accessors.reserve(accessors.size() + projections.size());
-
         const CesiumGltf::AccessorView<glm::vec3> positionView(
             gltf,
             positionAccessorIndex);
@@ -173,6 +195,8 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           return;
         }
 
+        const glm::dmat4 fullTransform = rootTransform * nodeTransform;
+
         std::optional<SkirtMeshMetadata> skirtMeshMetadata =
             SkirtMeshMetadata::parseFromGltfExtras(primitive.extras);
         int64_t vertexBegin, vertexEnd;
@@ -185,68 +209,85 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           vertexEnd = positionView.size();
         }
 
-        for (size_t i = 0; i < projections.size(); ++i) {
-          const int uvBufferId = static_cast<int>(buffers.size());
-          CesiumGltf::Buffer& uvBuffer = buffers.emplace_back();
-
-          const int uvBufferViewId = static_cast<int>(bufferViews.size());
-          bufferViews.emplace_back();
-
-          const int uvAccessorId = static_cast<int>(accessors.size());
-          accessors.emplace_back();
-
-          uvBuffer.cesium.data.resize(
-              size_t(positionView.size()) * 2 * sizeof(float));
-
-          uvBuffer.byteLength = int64_t(uvBuffer.cesium.data.size());
-
-          CesiumGltf::BufferView& uvBufferView =
-              gltf.bufferViews[static_cast<size_t>(uvBufferViewId)];
-          uvBufferView.buffer = uvBufferId;
-          uvBufferView.byteOffset = 0;
-          uvBufferView.byteStride = 2 * sizeof(float);
-          uvBufferView.byteLength = int64_t(uvBuffer.cesium.data.size());
-          uvBufferView.target = CesiumGltf::BufferView::Target::ARRAY_BUFFER;
+        // Create one buffer and bufferView for the texture coordinates of all
+        // of the distinct projections. Each vertex has one vec2 per distinct
+        // projection. Only Geographic and Web Mercator projections exist, so
+        // the stride stays well within the glTF limit.
+        const size_t distinctCount = distinctProjections.size();
+        const size_t vertexCount = size_t(positionView.size());
+
+        const int uvBufferId = static_cast<int>(gltf.buffers.size());
+        CesiumGltf::Buffer& uvBuffer = gltf.buffers.emplace_back();
+        allocateBufferData(
+            uvBuffer,
+            vertexCount * distinctCount * sizeof(glm::vec2),
+            pBufferPool);
+        uvBuffer.byteLength = int64_t(uvBuffer.cesium.data.size());
+
+        const int uvBufferViewId = static_cast<int>(gltf.bufferViews.size());
+        CesiumGltf::BufferView& uvBufferView = gltf.bufferViews.emplace_back();
+        uvBufferView.buffer = uvBufferId;
+        uvBufferView.byteOffset = 0;
+        uvBufferView.byteStride = int64_t(distinctCount * sizeof(glm::vec2));
+        uvBufferView.byteLength = int64_t(uvBuffer.cesium.data.size());
+        uvBufferView.target = CesiumGltf::BufferView::Target::ARRAY_BUFFER;
+
+        // Create an accessor for each projection, in order, so that the
+        // accessor of projection `i` can be found from the first one.
+        positionAccessorsToTextureCoordinateAccessor[size_t(
+            positionAccessorIndex)] = int32_t(gltf.accessors.size());
 
-          CesiumGltf::Accessor& uvAccessor =
-              gltf.accessors[static_cast<size_t>(uvAccessorId)];
+        for (size_t i = 0; i < projections.size(); ++i) {
+          const int uvAccessorId = static_cast<int>(gltf.accessors.size());
+          CesiumGltf::Accessor& uvAccessor = gltf.accessors.emplace_back();
           uvAccessor.bufferView = uvBufferViewId;
-          uvAccessor.byteOffset = 0;
+          uvAccessor.byteOffset =
+              int64_t(projectionToDistinct[i] * sizeof(glm::vec2));
           uvAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
-          uvAccessor.count = int64_t(positionView.size());
+          uvAccessor.count = int64_t(vertexCount);
           uvAccessor.type = CesiumGltf::Accessor::Type::VEC2;
-          uvAccessor.min = {1.0, 1.0};
-          uvAccessor.max = {0.0, 0.0};
 
-          [[maybe_unused]] CesiumGltf::AccessorWriter<glm::vec2>& uvWriter =
-              uvWriters.emplace_back(gltf, uvAccessorId);
-          CESIUM_ASSERT(
-              uvWriter.status() == CesiumGltf::AccessorViewStatus::Valid);
+          primitive.attributes[attributeNames[i]] = uvAccessorId;
+        }
 
-          std::string attributeName =
-              std::string(textureCoordinateAttributeBaseName) +
-              std::to_string(firstTextureCoordinateID + int32_t(i));
-          primitive.attributes[attributeName] = uvAccessorId;
+        glm::vec2* pUvs =
+            reinterpret_cast<glm::vec2*>(uvBuffer.cesium.data.data());
+        std::vector<glm::dvec2> mins(distinctCount, glm::dvec2(1.0, 1.0));
+        std::vector<glm::dvec2> maxs(distinctCount, glm::dvec2(0.0, 0.0));
 
-          mins.emplace_back(&uvAccessor.min);
-          maxs.emplace_back(&uvAccessor.max);
-        }
+        // Positions are converted to cartographic a chunk at a time, which is
+        // much faster than converting them one by one.
+        const int64_t chunkSize = 256;
+        std::vector<glm::dvec3> positionsEcef(size_t(chunkSize));
+        std::vector<std::optional<CesiumGeospatial::Cartographic>>
+            cartographics(size_t(chunkSize));
 
         // Generate texture coordinates for each position.
         for (int64_t positionIndex = 0; positionIndex < positionView.size();
              ++positionIndex) {
-          // Get the ECEF position
-          const glm::vec3 position = positionView[positionIndex];
-          const glm::dvec3 positionEcef =
-              glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
-
-          // Convert it to cartographic
-          const std::optional<CesiumGeospatial::Cartographic> cartographic =
-              ellipsoid.cartesianToCartographic(positionEcef);
-          if (!cartographic) {
-            for (CesiumGltf::AccessorWriter<glm::vec2>& uvWriter : uvWriters) {
-              uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
+          const size_t chunkIndex = size_t(positionIndex % chunkSize);
+          if (chunkIndex == 0) {
+            // Get the ECEF positions of the next chunk
+            const int64_t chunkEnd =
+                std::min(positionIndex + chunkSize, positionView.size());
+            for (int64_t i = positionIndex; i < chunkEnd; ++i) {
+              const glm::vec3 position = positionView[i];
+              positionsEcef[size_t(i - positionIndex)] =
+                  glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
             }
+
+            // Convert them to cartographic
+            ellipsoid.cartesianToCartographic(
+                std::span<const glm::dvec3>(positionsEcef)
+                    .first(size_t(chunkEnd - positionIndex)),
+                cartographics);
+          }
+
+          // Positions that can't be converted keep the texture coordinates
+          // (0.0, 0.0) that the buffer was initialized with.
+          const std::optional<CesiumGeospatial::Cartographic>& cartographic =
+              cartographics[chunkIndex];
+          if (!cartographic) {
             continue;
           }
 
@@ -255,9 +296,13 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
             computedBounds.expandToIncludePosition(*cartographic);
           }
 
-          // Generate texture coordinates at this position for each projection
-          for (size_t projectionIndex = 0; projectionIndex < projections.size();
-               ++projectionIndex) {
+          glm::vec2* pVertexUvs = pUvs + size_t(positionIndex) * distinctCount;
+
+          // Generate texture coordinates at this position for each distinct
+          // projection
+          for (size_t distinctIndex = 0; distinctIndex < distinctCount;
+               ++distinctIndex) {
+            const size_t projectionIndex = distinctProjections[distinctIndex];
             const CesiumGeospatial::Projection& projection =
                 projections[projectionIndex];
             const CesiumGeometry::Rectangle& rectangle =
@@ -324,17 +369,22 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
               uv.y = 1.0f - uv.y;
             }
 
-            mins[projectionIndex]->at(0) =
-                glm::min(mins[projectionIndex]->at(0), double(uv.x));
-            mins[projectionIndex]->at(1) =
-                glm::min(mins[projectionIndex]->at(1), double(uv.y));
-            maxs[projectionIndex]->at(0) =
-                glm::max(maxs[projectionIndex]->at(0), double(uv.x));
-            maxs[projectionIndex]->at(1) =
-                glm::max(maxs[projectionIndex]->at(1), double(uv.y));
-            uvWriters[projectionIndex][positionIndex] = uv;
+            mins[distinctIndex] = glm::min(mins[distinctIndex], glm::dvec2(uv));
+            maxs[distinctIndex] = glm::max(maxs[distinctIndex], glm::dvec2(uv));
+            pVertexUvs[distinctIndex] = uv;
           }
         }
+
+        const int32_t firstAccessorIndex =
+            positionAccessorsToTextureCoordinateAccessor[size_t(
+                positionAccessorIndex)];
+        for (size_t i = 0; i < projections.size(); ++i) {
+          CesiumGltf::Accessor& uvAccessor =
+              gltf.accessors[size_t(firstAccessorIndex) + i];
+          const size_t distinctIndex = projectionToDistinct[i];
+          uvAccessor.min = {mins[distinctIndex].x, mins[distinctIndex].y};
+          uvAccessor.max = {maxs[distinctIndex].x, maxs[distinctIndex].y};
+        }
       };
 
   model.forEachPrimitiveInScene(-1, createTextureCoordinatesForPrimitive);
@@ -367,7 +417,8 @@ bool upsamplePrimitiveForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid);
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool);
 
 struct FloatVertexAttribute {
   const std::vector<std::byte>& buffer;
@@ -524,7 +575,8 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool) {
   CESIUM_TRACE("upsampleGltfForRasterOverlays");
   Model result;
 
@@ -586,7 +638,8 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
-          ellipsoid);
+          ellipsoid,
+          pBufferPool);
 
       // We're assuming here that nothing references primitives by index, so we
       // can remove them without any drama.
@@ -945,7 +998,8 @@ bool upsamplePointsPrimitiveForRasterOverlays(
     CesiumGeometry::UpsampledQuadtreeNode childID,
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
-    int32_t textureCoordinateIndex) {
+    int32_t textureCoordinateIndex,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool) {
   CESIUM_TRACE("upsamplePointsPrimitiveForRasterOverlays");
 
   // Add up the per-vertex size of all attributes and create buffers,
@@ -1101,7 +1155,10 @@ bool upsamplePointsPrimitiveForRasterOverlays(
 
   // Populate the buffers
   Buffer& vertexBuffer = model.buffers[vertexBufferIndex];
-  vertexBuffer.cesium.data.resize(newVertexFloats.size() * sizeof(float));
+  allocateBufferData(
+      vertexBuffer,
+      newVertexFloats.size() * sizeof(float),
+      pBufferPool);
   float* pAsFloats = reinterpret_cast<float*>(vertexBuffer.cesium.data.data());
   std::copy(newVertexFloats.begin(), newVertexFloats.end(), pAsFloats);
   vertexBuffer.byteLength = vertexBufferView.byteLength =
@@ -1123,7 +1180,8 @@ bool upsampleTrianglesPrimitiveForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool) {
   CESIUM_TRACE("upsampleTrianglesPrimitiveForRasterOverlays");
 
   // Add up the per-vertex size of all attributes and create buffers,
@@ -1451,7 +1509,10 @@ bool upsampleTrianglesPrimitiveForRasterOverlays(
 
   // Populate the buffers
   Buffer& vertexBuffer = model.buffers[vertexBufferIndex];
-  vertexBuffer.cesium.data.resize(newVertexFloats.size() * sizeof(float));
+  allocateBufferData(
+      vertexBuffer,
+      newVertexFloats.size() * sizeof(float),
+      pBufferPool);
   float* pAsFloats = reinterpret_cast<float*>(vertexBuffer.cesium.data.data());
   std::copy(newVertexFloats.begin(), newVertexFloats.end(), pAsFloats);
   vertexBuffer.byteLength = vertexBufferView.byteLength =
@@ -1459,7 +1520,10 @@ bool upsampleTrianglesPrimitiveForRasterOverlays(
   vertexBufferView.byteStride = vertexSizeFloats * int64_t(sizeof(float));
 
   Buffer& indexBuffer = model.buffers[indexBufferIndex];
-  indexBuffer.cesium.data.resize(indices.size() * sizeof(uint32_t));
+  allocateBufferData(
+      indexBuffer,
+      indices.size() * sizeof(uint32_t),
+      pBufferPool);
   uint32_t* pAsUint32s =
       reinterpret_cast<uint32_t*>(indexBuffer.cesium.data.data());
   std::copy(indices.begin(), indices.end(), pAsUint32s);
@@ -1874,7 +1938,8 @@ bool upsamplePrimitiveForRasterOverlays(
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const std::shared_ptr<ByteBufferPool>& pBufferPool) {
   if (primitive.mode == MeshPrimitive::Mode::POINTS) {
     return upsamplePointsPrimitiveForRasterOverlays(
         parentModel,
@@ -1883,7 +1948,8 @@ bool upsamplePrimitiveForRasterOverlays(
         childID,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
-        textureCoordinateIndex);
+        textureCoordinateIndex,
+        pBufferPool);
   } else if (
       primitive.mode != MeshPrimitive::Mode::TRIANGLES &&
       primitive.mode != MeshPrimitive::Mode::TRIANGLE_FAN &&
@@ -1918,7 +1984,8 @@ bool upsamplePrimitiveForRasterOverlays(
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
-          ellipsoid);
+          ellipsoid,
+          pBufferPool);
     } else if (accessor.count < 0xffff) {
       return upsampleTrianglesPrimitiveForRasterOverlays<uint16_t>(
           parentModel,
@@ -1929,7 +1996,8 @@ bool upsamplePrimitiveForRasterOverlays(
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
-          ellipsoid);
+          ellipsoid,
+          pBufferPool);
     } else {
       return upsampleTrianglesPrimitiveForRasterOverlays<uint32_t>(
           parentModel,
@@ -1940,7 +2008,8 @@ bool upsamplePrimitiveForRasterOverlays(
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
-          ellipsoid);
+          ellipsoid,
+          pBufferPool);
     }
   }
 
@@ -1957,7 +2026,8 @@ bool upsamplePrimitiveForRasterOverlays(
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
-        ellipsoid);
+        ellipsoid,
+        pBufferPool);
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_SHORT) {
@@ -1970,7 +2040,8 @@ bool upsamplePrimitiveForRasterOverlays(
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
-        ellipsoid);
+        ellipsoid,
+        pBufferPool);
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_INT) {
@@ -1983,7 +2054,8 @@ bool upsamplePrimitiveForRasterOverlays(
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
-        ellipsoid);
+        ellipsoid,
+        pBufferPool);
   }
 
   return false;
@@ -1,6 +1,9 @@
+#include "rasterizePolygons.h"
+
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/Projection.h>
@@ -15,7 +18,6 @@
 
 #include <glm/common.hpp>
 #include <glm/ext/vector_double2.hpp>
-#include <glm/geometric.hpp>
 #include <spdlog/fwd.h>
 
 #include <cstddef>
@@ -31,12 +33,13 @@ using namespace CesiumUtility;
 
 namespace CesiumRasterOverlays {
 namespace {
-void rasterizePolygons(
+void createPolygonMask(
     LoadedRasterOverlayImage& loaded,
     const CesiumGeospatial::GlobeRectangle& rectangle,
     const glm::dvec2& textureSize,
-    const std::vector<CartographicPolygon>& cartographicPolygons,
-    bool invertSelection) {
+    const CartographicPolygonIndex& polygonIndex,
+    bool invertSelection,
+    bool antiAliasing) {
 
   CesiumGltf::ImageAsset& image = loaded.pImage.emplace();
 
@@ -51,10 +54,12 @@ void rasterizePolygons(
     outsideColor = static_cast<std::byte>(0);
   }
 
+  // Only the polygons whose bounding rectangles overlap this tile matter.
+  std::vector<const CartographicPolygon*> candidates;
+  polygonIndex.findPolygonsOverlapping(rectangle, candidates);
+
   // create a 1x1 mask if the rectangle is completely inside a polygon
-  if (CartographicPolygon::rectangleIsWithinPolygons(
-          rectangle,
-          cartographicPolygons)) {
+  if (CartographicPolygon::rectangleIsWithinPolygons(rectangle, candidates)) {
     loaded.moreDetailAvailable = false;
     image.width = 1;
     image.height = 1;
@@ -64,20 +69,8 @@ void rasterizePolygons(
     return;
   }
 
-  bool completelyOutsidePolygons = true;
-  for (const CartographicPolygon& selection : cartographicPolygons) {
-    const std::optional<CesiumGeospatial::GlobeRectangle>& boundingRectangle =
-        selection.getBoundingRectangle();
-
-    if (boundingRectangle &&
-        rectangle.computeIntersection(*boundingRectangle)) {
-      completelyOutsidePolygons = false;
-      break;
-    }
-  }
-
   // create a 1x1 mask if the rectangle is completely outside all polygons
-  if (completelyOutsidePolygons) {
+  if (candidates.empty()) {
     loaded.moreDetailAvailable = false;
     image.width = 1;
     image.height = 1;
@@ -87,84 +80,23 @@ void rasterizePolygons(
     return;
   }
 
-  const double rectangleWidth = rectangle.computeWidth();
-  const double rectangleHeight = rectangle.computeHeight();
-
   // create source image
   loaded.moreDetailAvailable = true;
   image.width = int32_t(glm::round(textureSize.x));
   image.height = int32_t(glm::round(textureSize.y));
   image.channels = 1;
   image.bytesPerChannel = 1;
-  image.pixelData.resize(size_t(image.width * image.height), outsideColor);
-
-  // TODO: this is naive approach, use line-triangle
-  // intersections to rasterize one row at a time
-  // NOTE: also completely ignores antimeridian (really these
-  // calculations should be normalized to the first vertex)
-  for (const CartographicPolygon& polygon : cartographicPolygons) {
-    const std::vector<glm::dvec2>& vertices = polygon.getVertices();
-    const std::vector<uint32_t>& indices = polygon.getIndices();
-    for (size_t triangle = 0; triangle < indices.size() / 3; ++triangle) {
-      const glm::dvec2& a = vertices[indices[3 * triangle]];
-      const glm::dvec2& b = vertices[indices[3 * triangle + 1]];
-      const glm::dvec2& c = vertices[indices[3 * triangle + 2]];
-
-      // TODO: deal with the corner cases here
-      const double minX = glm::min(a.x, glm::min(b.x, c.x));
-      const double minY = glm::min(a.y, glm::min(b.y, c.y));
-      const double maxX = glm::max(a.x, glm::max(b.x, c.x));
-      const double maxY = glm::max(a.y, glm::max(b.y, c.y));
-
-      const CesiumGeospatial::GlobeRectangle triangleBounds(
-          minX,
-          minY,
-          maxX,
-          maxY);
-
-      // skip this triangle if it is entirely outside the tile bounds
-      if (!rectangle.computeIntersection(triangleBounds)) {
-        continue;
-      }
-
-      const glm::dvec2 ab = b - a;
-      const glm::dvec2 ab_perp(-ab.y, ab.x);
-      const glm::dvec2 bc = c - b;
-      const glm::dvec2 bc_perp(-bc.y, bc.x);
-      const glm::dvec2 ca = a - c;
-      const glm::dvec2 ca_perp(-ca.y, ca.x);
-
-      size_t width = size_t(image.width);
-      size_t height = size_t(image.height);
-
-      for (size_t j = 0; j < height; ++j) {
-        const double pixelY =
-            rectangle.getSouth() +
-            rectangleHeight * (1.0 - (double(j) + 0.5) / double(height));
-        for (size_t i = 0; i < width; ++i) {
-          const double pixelX = rectangle.getWest() + rectangleWidth *
-                                                          (double(i) + 0.5) /
-                                                          double(width);
-          const glm::dvec2 v(pixelX, pixelY);
-
-          const glm::dvec2 av = v - a;
-          const glm::dvec2 cv = v - c;
-
-          const double v_proj_ab_perp = glm::dot(av, ab_perp);
-          const double v_proj_bc_perp = glm::dot(cv, bc_perp);
-          const double v_proj_ca_perp = glm::dot(cv, ca_perp);
-
-          // will determine in or out, irrespective of winding
-          if ((v_proj_ab_perp >= 0.0 && v_proj_ca_perp >= 0.0 &&
-               v_proj_bc_perp >= 0.0) ||
-              (v_proj_ab_perp <= 0.0 && v_proj_ca_perp <= 0.0 &&
-               v_proj_bc_perp <= 0.0)) {
-            image.pixelData[width * j + i] = insideColor;
-          }
-        }
-      }
-    }
-  }
+  image.pixelData.resize(size_t(image.width * image.height));
+
+  rasterizePolygons(
+      image.pixelData,
+      image.width,
+      image.height,
+      rectangle,
+      candidates,
+      insideColor,
+      outsideColor,
+      antiAliasing);
 }
 } // namespace
 
@@ -172,8 +104,9 @@ class CESIUMRASTEROVERLAYS_API RasterizedPolygonsTileProvider final
     : public RasterOverlayTileProvider {
 
 private:
-  std::vector<CartographicPolygon> _polygons;
+  std::shared_ptr<const CartographicPolygonIndex> _pPolygonIndex;
   bool _invertSelection;
+  bool _antiAliasing;
 
 public:
   RasterizedPolygonsTileProvider(
@@ -184,8 +117,9 @@ public:
           pPrepareRendererResources,
       const std::shared_ptr<spdlog::logger>& pLogger,
       const CesiumGeospatial::Projection& projection,
-      const std::vector<CartographicPolygon>& polygons,
-      bool invertSelection)
+      const std::shared_ptr<const CartographicPolygonIndex>& pPolygonIndex,
+      bool invertSelection,
+      bool antiAliasing)
       : RasterOverlayTileProvider(
             pOwner,
             asyncSystem,
@@ -199,8 +133,9 @@ public:
             projectRectangleSimple(
                 projection,
                 CesiumGeospatial::GlobeRectangle::MAXIMUM)),
-        _polygons(polygons),
-        _invertSelection(invertSelection) {}
+        _pPolygonIndex(pPolygonIndex),
+        _invertSelection(invertSelection),
+        _antiAliasing(antiAliasing) {}
 
   virtual CesiumAsync::Future<LoadedRasterOverlayImage>
   loadTileImage(const RasterOverlayTile& overlayTile) override {
@@ -212,8 +147,9 @@ public:
         glm::dvec2(options.maximumTextureSize));
 
     return this->getAsyncSystem().runInWorkerThread(
-        [&polygons = this->_polygons,
+        [pPolygonIndex = this->_pPolygonIndex,
          invertSelection = this->_invertSelection,
+         antiAliasing = this->_antiAliasing,
          projection = this->getProjection(),
          rectangle = overlayTile.getRectangle(),
          textureSize]() -> LoadedRasterOverlayImage {
@@ -223,12 +159,13 @@ public:
           LoadedRasterOverlayImage result;
           result.rectangle = rectangle;
 
-          rasterizePolygons(
+          createPolygonMask(
               result,
               tileRectangle,
               textureSize,
-              polygons,
-              invertSelection);
+              *pPolygonIndex,
+              invertSelection,
+              antiAliasing);
 
           return result;
         });
@@ -241,12 +178,15 @@ RasterizedPolygonsOverlay::RasterizedPolygonsOverlay(
     bool invertSelection,
     const CesiumGeospatial::Ellipsoid& ellipsoid,
     const CesiumGeospatial::Projection& projection,
-    const RasterOverlayOptions& overlayOptions)
+    const RasterOverlayOptions& overlayOptions,
+    bool antiAliasing)
     : RasterOverlay(name, overlayOptions),
-      _polygons(polygons),
+      _pPolygonIndex(
+          std::make_shared<const CartographicPolygonIndex>(polygons)),
       _invertSelection(invertSelection),
       _ellipsoid(ellipsoid),
-      _projection(projection) {}
+      _projection(projection),
+      _antiAliasing(antiAliasing) {}
 
 RasterizedPolygonsOverlay::~RasterizedPolygonsOverlay() = default;
 
@@ -271,8 +211,9 @@ RasterizedPolygonsOverlay::createTileProvider(
               pPrepareRendererResources,
               pLogger,
               this->_projection,
-              this->_polygons,
-              this->_invertSelection)));
+              this->_pPolygonIndex,
+              this->_invertSelection,
+              this->_antiAliasing)));
 }
 
 } // namespace CesiumRasterOverlays
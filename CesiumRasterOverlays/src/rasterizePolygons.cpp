@@ -0,0 +1,331 @@
+#include "rasterizePolygons.h"
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Assert.h>
+#include <CesiumUtility/Math.h>
+
+#include <glm/common.hpp>
+#include <glm/ext/vector_double2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace CesiumRasterOverlays {
+
+namespace {
+
+// The number of sub-scanlines sampled per pixel row when anti-aliasing.
+constexpr int32_t ANTI_ALIASING_SUBSAMPLES = 4;
+
+struct Edge {
+  // The top (smallest y) of the edge, in pixels.
+  double yTop;
+  // The bottom (largest y) of the edge, in pixels.
+  double yBottom;
+  // The x coordinate of the edge at yTop, in pixels.
+  double xTop;
+  // The change in x for each unit of y.
+  double dxdy;
+};
+
+/**
+ * @brief Scratch storage reused across polygons and copies of polygons, so
+ * that rasterizing a tile only allocates a handful of times.
+ */
+struct ScanlineContext {
+  int32_t height;
+  std::vector<Edge> edgeTable;
+  std::vector<const Edge*> activeEdges;
+  std::vector<double> crossings;
+};
+
+/**
+ * @brief Builds the edge table for a polygon in pixel space and visits every
+ * filled span on every scanline. The scanlines are at `firstRow + (s + 0.5) /
+ * subsamples` for each sub-sample `s` of each row. The callback receives the
+ * row index, the weight of a single sub-scanline, and the span's start and end
+ * x coordinates (in pixels, not clamped to the image).
+ */
+template <typename SpanCallback>
+void scanPolygon(
+    ScanlineContext& context,
+    std::span<const glm::dvec2> pixelVertices,
+    int32_t subsamples,
+    SpanCallback&& callback) {
+  std::vector<Edge>& edgeTable = context.edgeTable;
+  edgeTable.clear();
+
+  double minY = pixelVertices[0].y;
+  double maxY = pixelVertices[0].y;
+
+  for (size_t i = 0; i < pixelVertices.size(); ++i) {
+    const glm::dvec2& a = pixelVertices[i];
+    const glm::dvec2& b = pixelVertices[(i + 1) % pixelVertices.size()];
+
+    minY = glm::min(minY, a.y);
+    maxY = glm::max(maxY, a.y);
+
+    // Horizontal edges never cross a scanline.
+    if (a.y == b.y) {
+      continue;
+    }
+
+    const glm::dvec2& top = a.y < b.y ? a : b;
+    const glm::dvec2& bottom = a.y < b.y ? b : a;
+    edgeTable.emplace_back(Edge{
+        top.y,
+        bottom.y,
+        top.x,
+        (bottom.x - top.x) / (bottom.y - top.y)});
+  }
+
+  if (edgeTable.empty()) {
+    return;
+  }
+
+  std::sort(
+      edgeTable.begin(),
+      edgeTable.end(),
+      [](const Edge& a, const Edge& b) { return a.yTop < b.yTop; });
+
+  const double subsampleHeight = 1.0 / double(subsamples);
+  const double subsampleOffset = 0.5 * subsampleHeight;
+
+  // Only visit the rows that overlap the polygon.
+  const int32_t firstRow = int32_t(
+      glm::clamp(std::floor(minY), 0.0, double(context.height)));
+  const int32_t lastRow =
+      int32_t(glm::clamp(std::ceil(maxY), 0.0, double(context.height)));
+
+  std::vector<const Edge*>& activeEdges = context.activeEdges;
+  std::vector<double>& crossings = context.crossings;
+  activeEdges.clear();
+
+  size_t nextEdge = 0;
+
+  for (int32_t row = firstRow; row < lastRow; ++row) {
+    for (int32_t subsample = 0; subsample < subsamples; ++subsample) {
+      const double y = double(row) + double(subsample) * subsampleHeight +
+                       subsampleOffset;
+
+      // Edges cover the half-open interval [yTop, yBottom), so a vertex lying
+      // exactly on a scanline is only counted once.
+      while (nextEdge < edgeTable.size() && edgeTable[nextEdge].yTop <= y) {
+        activeEdges.emplace_back(&edgeTable[nextEdge]);
+        ++nextEdge;
+      }
+
+      activeEdges.erase(
+          std::remove_if(
+              activeEdges.begin(),
+              activeEdges.end(),
+              [y](const Edge* pEdge) { return pEdge->yBottom <= y; }),
+          activeEdges.end());
+
+      if (activeEdges.empty()) {
+        continue;
+      }
+
+      crossings.clear();
+      for (const Edge* pEdge : activeEdges) {
+        crossings.emplace_back(pEdge->xTop + (y - pEdge->yTop) * pEdge->dxdy);
+      }
+
+      std::sort(crossings.begin(), crossings.end());
+
+      CESIUM_ASSERT(crossings.size() % 2 == 0);
+      for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+        callback(row, subsampleHeight, crossings[i], crossings[i + 1]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Converts the polygon's vertices to pixel space, unwrapping the
+ * longitudes relative to the first vertex so that a polygon crossing the
+ * antimeridian is continuous. The x coordinates are relative to the
+ * rectangle's west edge and are not yet shifted by any multiple of two pi.
+ */
+void computePixelVertices(
+    const CartographicPolygon& polygon,
+    const GlobeRectangle& rectangle,
+    double pixelsPerRadianX,
+    double pixelsPerRadianY,
+    std::vector<glm::dvec2>& pixelVertices,
+    double& minLongitude,
+    double& maxLongitude) {
+  const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+  pixelVertices.resize(vertices.size());
+
+  const double firstLongitude = vertices[0].x;
+  minLongitude = firstLongitude;
+  maxLongitude = firstLongitude;
+
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    double longitude = vertices[i].x;
+    const double difference = longitude - firstLongitude;
+
+    // Check if the difference crosses the antipole, exactly as is done when
+    // the polygon is triangulated.
+    if (glm::abs(difference) > Math::OnePi) {
+      longitude += difference > 0.0 ? -Math::TwoPi : Math::TwoPi;
+    }
+
+    minLongitude = glm::min(minLongitude, longitude);
+    maxLongitude = glm::max(maxLongitude, longitude);
+
+    pixelVertices[i] = glm::dvec2(
+        (longitude - rectangle.getWest()) * pixelsPerRadianX,
+        (rectangle.getNorth() - vertices[i].y) * pixelsPerRadianY);
+  }
+}
+
+} // namespace
+
+void rasterizePolygons(
+    std::span<std::byte> pixels,
+    int32_t width,
+    int32_t height,
+    const GlobeRectangle& rectangle,
+    std::span<const CartographicPolygon* const> polygons,
+    std::byte insideColor,
+    std::byte outsideColor,
+    bool antiAliasing) {
+  CESIUM_ASSERT(pixels.size() == size_t(width) * size_t(height));
+
+  std::fill(pixels.begin(), pixels.end(), outsideColor);
+
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+
+  // computeWidth accounts for rectangles that cross the antimeridian.
+  const double rectangleWidth = rectangle.computeWidth();
+  const double rectangleHeight = rectangle.computeHeight();
+  if (rectangleWidth <= 0.0 || rectangleHeight <= 0.0) {
+    return;
+  }
+
+  const double pixelsPerRadianX = double(width) / rectangleWidth;
+  const double pixelsPerRadianY = double(height) / rectangleHeight;
+
+  ScanlineContext context{height, {}, {}, {}};
+
+  // When anti-aliasing, coverage is accumulated for every pixel and converted
+  // to colors at the end. Coverage from polygons that share an edge adds up,
+  // so there is no visible seam between them.
+  std::vector<float> coverage;
+  if (antiAliasing) {
+    coverage.resize(pixels.size(), 0.0f);
+  }
+
+  const int32_t subsamples = antiAliasing ? ANTI_ALIASING_SUBSAMPLES : 1;
+  const double imageWidth = double(width);
+
+  auto fillSpan = [&](int32_t row, double weight, double x0, double x1) {
+    if (antiAliasing) {
+      x0 = glm::clamp(x0, 0.0, imageWidth);
+      x1 = glm::clamp(x1, 0.0, imageWidth);
+      if (x1 <= x0) {
+        return;
+      }
+
+      float* pRow = coverage.data() + size_t(row) * size_t(width);
+      const int32_t first = int32_t(x0);
+      const int32_t last = glm::min(int32_t(x1), width - 1);
+
+      if (first == last) {
+        pRow[first] += float((x1 - x0) * weight);
+        return;
+      }
+
+      pRow[first] += float((double(first + 1) - x0) * weight);
+      for (int32_t i = first + 1; i < last; ++i) {
+        pRow[i] += float(weight);
+      }
+      pRow[last] += float((x1 - double(last)) * weight);
+    } else {
+      // Fill the pixels whose centers are in [x0, x1).
+      const int32_t first =
+          int32_t(glm::clamp(std::ceil(x0 - 0.5), 0.0, imageWidth));
+      const int32_t last =
+          int32_t(glm::clamp(std::ceil(x1 - 0.5), 0.0, imageWidth));
+      if (last <= first) {
+        return;
+      }
+
+      std::byte* pRow = pixels.data() + size_t(row) * size_t(width);
+      std::fill(pRow + first, pRow + last, insideColor);
+    }
+  };
+
+  std::vector<glm::dvec2> pixelVertices;
+  std::vector<glm::dvec2> shiftedVertices;
+
+  for (const CartographicPolygon* pPolygon : polygons) {
+    const CartographicPolygon& polygon = *pPolygon;
+    const std::optional<GlobeRectangle>& boundingRectangle =
+        polygon.getBoundingRectangle();
+    if (!boundingRectangle ||
+        !rectangle.computeIntersection(*boundingRectangle)) {
+      continue;
+    }
+
+    double minLongitude;
+    double maxLongitude;
+    computePixelVertices(
+        polygon,
+        rectangle,
+        pixelsPerRadianX,
+        pixelsPerRadianY,
+        pixelVertices,
+        minLongitude,
+        maxLongitude);
+
+    // Rasterize every copy of the polygon, shifted by a multiple of two pi,
+    // that overlaps the rectangle. There are at most a few of these.
+    const double minOffset = minLongitude - rectangle.getWest();
+    const double maxOffset = maxLongitude - rectangle.getWest();
+    const int32_t firstCopy = int32_t(std::ceil(-maxOffset / Math::TwoPi));
+    const int32_t lastCopy =
+        int32_t(std::floor((rectangleWidth - minOffset) / Math::TwoPi));
+
+    for (int32_t copy = firstCopy; copy <= lastCopy; ++copy) {
+      if (copy == 0) {
+        scanPolygon(context, pixelVertices, subsamples, fillSpan);
+        continue;
+      }
+
+      const double shift = double(copy) * Math::TwoPi * pixelsPerRadianX;
+      shiftedVertices.resize(pixelVertices.size());
+      for (size_t i = 0; i < pixelVertices.size(); ++i) {
+        shiftedVertices[i] =
+            glm::dvec2(pixelVertices[i].x + shift, pixelVertices[i].y);
+      }
+
+      scanPolygon(context, shiftedVertices, subsamples, fillSpan);
+    }
+  }
+
+  if (antiAliasing) {
+    const float inside = float(std::to_integer<uint8_t>(insideColor));
+    const float outside = float(std::to_integer<uint8_t>(outsideColor));
+    for (size_t i = 0; i < pixels.size(); ++i) {
+      const float value = glm::min(coverage[i], 1.0f);
+      pixels[i] = std::byte(
+          uint8_t(std::lround(outside + (inside - outside) * value)));
+    }
+  }
+}
+
+} // namespace CesiumRasterOverlays
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace CesiumGeospatial {
+class CartographicPolygon;
+class GlobeRectangle;
+} // namespace CesiumGeospatial
+
+namespace CesiumRasterOverlays {
+
+/**
+ * @brief Rasterizes a set of polygons into a single-channel, 8-bit mask using
+ * an edge-table scanline algorithm.
+ *
+ * Each polygon's perimeter is converted into an edge table in pixel space, and
+ * every row of the image is filled one span at a time between pairs of edge
+ * crossings (even-odd rule). Polygons and rectangles that cross the
+ * antimeridian are handled by unwrapping the polygon's longitudes relative to
+ * its first vertex and then rasterizing every copy of it, shifted by a
+ * multiple of two pi, that overlaps the rectangle.
+ *
+ * Pixel (0, 0) is at the north-west corner of the rectangle. A pixel is
+ * considered inside a polygon when its center is inside. When `antiAliasing`
+ * is true, the pixel instead receives a value interpolated between
+ * `outsideColor` and `insideColor` according to the fraction of its area that
+ * is covered by the polygons.
+ *
+ * @param pixels The pixels to write, which must contain `width * height`
+ * bytes. Every pixel is written.
+ * @param width The width of the image in pixels.
+ * @param height The height of the image in pixels.
+ * @param rectangle The rectangle covered by the image.
+ * @param polygons The polygons to rasterize.
+ * @param insideColor The value of pixels inside the polygons.
+ * @param outsideColor The value of pixels outside the polygons.
+ * @param antiAliasing Whether to compute partial coverage of edge pixels.
+ */
+void rasterizePolygons(
+    std::span<std::byte> pixels,
+    int32_t width,
+    int32_t height,
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    std::span<const CesiumGeospatial::CartographicPolygon* const> polygons,
+    std::byte insideColor,
+    std::byte outsideColor,
+    bool antiAliasing);
+
+} // namespace CesiumRasterOverlays
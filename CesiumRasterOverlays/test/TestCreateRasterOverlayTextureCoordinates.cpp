@@ -0,0 +1,124 @@
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeTransforms.h>
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumGeospatial/WebMercatorProjection.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Mesh.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfReader/GltfReader.h>
+#include <CesiumNativeTests/readFile.h>
+#include <CesiumRasterOverlays/RasterOverlayDetails.h>
+#include <CesiumRasterOverlays/RasterOverlayUtilities.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_float2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumGltfReader;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+
+TEST_CASE("RasterOverlayUtilities::createRasterOverlayTextureCoordinates") {
+  std::filesystem::path dataDir(CesiumRasterOverlays_TEST_DATA_DIR);
+  GltfReader reader;
+  GltfReaderResult result =
+      reader.readGltf(readFile(dataDir / "Shadow_Tester.glb"));
+  REQUIRE(result.model);
+
+  glm::dmat4 enuToFixed = GlobeTransforms::eastNorthUpToFixedFrame(
+      Ellipsoid::WGS84.cartographicToCartesian(
+          Cartographic::fromDegrees(-75.14777, 39.95021, 200.0)),
+      Ellipsoid::WGS84);
+  glm::dmat4 modelToEcef =
+      enuToFixed * glm::scale(glm::dmat4(1.0), glm::dvec3(100000.0));
+
+  const std::vector<Projection> projections{
+      GeographicProjection(Ellipsoid::WGS84),
+      WebMercatorProjection(Ellipsoid::WGS84),
+      GeographicProjection(Ellipsoid::WGS84)};
+
+  Model combined = *result.model;
+  std::optional<RasterOverlayDetails> details =
+      RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          combined,
+          modelToEcef,
+          std::nullopt,
+          std::vector<Projection>(projections),
+          false,
+          "_CESIUMOVERLAY_",
+          0);
+  REQUIRE(details);
+  REQUIRE(details->rasterOverlayProjections.size() == projections.size());
+
+  // Each projection's texture coordinates must be the same as those created
+  // for that projection on its own.
+  for (size_t i = 0; i < projections.size(); ++i) {
+    Model single = *result.model;
+    std::optional<RasterOverlayDetails> singleDetails =
+        RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+            single,
+            modelToEcef,
+            std::nullopt,
+            {projections[i]},
+            false,
+            "_CESIUMOVERLAY_",
+            0);
+    REQUIRE(singleDetails);
+
+    const std::string attributeName = "_CESIUMOVERLAY_" + std::to_string(i);
+    for (size_t meshIndex = 0; meshIndex < combined.meshes.size();
+         ++meshIndex) {
+      const Mesh& mesh = combined.meshes[meshIndex];
+      for (size_t primitiveIndex = 0; primitiveIndex < mesh.primitives.size();
+           ++primitiveIndex) {
+        const MeshPrimitive& primitive = mesh.primitives[primitiveIndex];
+        const MeshPrimitive& singlePrimitive =
+            single.meshes[meshIndex].primitives[primitiveIndex];
+
+        auto it = primitive.attributes.find(attributeName);
+        auto singleIt = singlePrimitive.attributes.find("_CESIUMOVERLAY_0");
+        REQUIRE(it != primitive.attributes.end());
+        REQUIRE(singleIt != singlePrimitive.attributes.end());
+
+        const AccessorView<glm::vec2> uvs(combined, it->second);
+        const AccessorView<glm::vec2> singleUvs(single, singleIt->second);
+        REQUIRE(uvs.status() == AccessorViewStatus::Valid);
+        REQUIRE(singleUvs.status() == AccessorViewStatus::Valid);
+        REQUIRE(uvs.size() == singleUvs.size());
+        for (int64_t j = 0; j < uvs.size(); ++j) {
+          CHECK(uvs[j] == singleUvs[j]);
+        }
+
+        const Accessor& accessor = combined.accessors[size_t(it->second)];
+        const Accessor& singleAccessor =
+            single.accessors[size_t(singleIt->second)];
+        CHECK(accessor.min == singleAccessor.min);
+        CHECK(accessor.max == singleAccessor.max);
+      }
+    }
+  }
+
+  // The two geographic projections share their texture coordinates.
+  const MeshPrimitive& primitive = combined.meshes[0].primitives[0];
+  const Accessor& first =
+      combined.accessors[size_t(primitive.attributes.at("_CESIUMOVERLAY_0"))];
+  const Accessor& third =
+      combined.accessors[size_t(primitive.attributes.at("_CESIUMOVERLAY_2"))];
+  CHECK(first.bufferView == third.bufferView);
+  CHECK(first.byteOffset == third.byteOffset);
+}
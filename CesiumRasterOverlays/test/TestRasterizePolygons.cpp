@@ -0,0 +1,339 @@
+#include "rasterizePolygons.h"
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/common.hpp>
+#include <glm/ext/vector_double2.hpp>
+#include <glm/geometric.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumRasterOverlays;
+using namespace CesiumUtility;
+
+namespace {
+
+constexpr std::byte inside{0xff};
+constexpr std::byte outside{0};
+
+std::vector<std::byte> rasterize(
+    int32_t width,
+    int32_t height,
+    const GlobeRectangle& rectangle,
+    const std::vector<CartographicPolygon>& polygons,
+    bool antiAliasing = false) {
+  std::vector<const CartographicPolygon*> pointers;
+  for (const CartographicPolygon& polygon : polygons) {
+    pointers.emplace_back(&polygon);
+  }
+
+  std::vector<std::byte> pixels(size_t(width) * size_t(height));
+  rasterizePolygons(
+      pixels,
+      width,
+      height,
+      rectangle,
+      pointers,
+      inside,
+      outside,
+      antiAliasing);
+  return pixels;
+}
+
+size_t countPixels(const std::vector<std::byte>& pixels, std::byte value) {
+  size_t count = 0;
+  for (std::byte pixel : pixels) {
+    if (pixel == value) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// The per-pixel, per-triangle rasterizer that the scanline rasterizer
+// replaced. It is kept here as a reference for the benchmark.
+void rasterizeTrianglesNaive(
+    std::vector<std::byte>& pixels,
+    int32_t width,
+    int32_t height,
+    const GlobeRectangle& rectangle,
+    const std::vector<CartographicPolygon>& polygons) {
+  const double rectangleWidth = rectangle.computeWidth();
+  const double rectangleHeight = rectangle.computeHeight();
+
+  std::fill(pixels.begin(), pixels.end(), outside);
+
+  for (const CartographicPolygon& polygon : polygons) {
+    const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+    const std::vector<uint32_t>& indices = polygon.getIndices();
+    for (size_t triangle = 0; triangle < indices.size() / 3; ++triangle) {
+      const glm::dvec2& a = vertices[indices[3 * triangle]];
+      const glm::dvec2& b = vertices[indices[3 * triangle + 1]];
+      const glm::dvec2& c = vertices[indices[3 * triangle + 2]];
+
+      const GlobeRectangle triangleBounds(
+          glm::min(a.x, glm::min(b.x, c.x)),
+          glm::min(a.y, glm::min(b.y, c.y)),
+          glm::max(a.x, glm::max(b.x, c.x)),
+          glm::max(a.y, glm::max(b.y, c.y)));
+      if (!rectangle.computeIntersection(triangleBounds)) {
+        continue;
+      }
+
+      const glm::dvec2 ab = b - a;
+      const glm::dvec2 ab_perp(-ab.y, ab.x);
+      const glm::dvec2 bc = c - b;
+      const glm::dvec2 bc_perp(-bc.y, bc.x);
+      const glm::dvec2 ca = a - c;
+      const glm::dvec2 ca_perp(-ca.y, ca.x);
+
+      for (int32_t j = 0; j < height; ++j) {
+        const double pixelY =
+            rectangle.getSouth() +
+            rectangleHeight * (1.0 - (double(j) + 0.5) / double(height));
+        for (int32_t i = 0; i < width; ++i) {
+          const double pixelX =
+              rectangle.getWest() +
+              rectangleWidth * (double(i) + 0.5) / double(width);
+          const glm::dvec2 v(pixelX, pixelY);
+
+          const double abSide = glm::dot(v - a, ab_perp);
+          const double bcSide = glm::dot(v - c, bc_perp);
+          const double caSide = glm::dot(v - c, ca_perp);
+
+          if ((abSide >= 0.0 && caSide >= 0.0 && bcSide >= 0.0) ||
+              (abSide <= 0.0 && caSide <= 0.0 && bcSide <= 0.0)) {
+            pixels[size_t(width) * size_t(j) + size_t(i)] = inside;
+          }
+        }
+      }
+    }
+  }
+}
+
+std::vector<CartographicPolygon>
+createRandomPolygons(size_t count, const GlobeRectangle& rectangle) {
+  // Use a constant seed so the results are the same every run.
+  std::default_random_engine rand(0xabcdabcd);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  std::vector<CartographicPolygon> polygons;
+  polygons.reserve(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const glm::dvec2 center(
+        rectangle.getWest() + unit(rand) * rectangle.computeWidth(),
+        rectangle.getSouth() + unit(rand) * rectangle.computeHeight());
+    const double radius = 0.05 * unit(rand) * rectangle.computeHeight();
+
+    // A star-shaped polygon, which is concave but never self-intersecting.
+    std::vector<glm::dvec2> vertices;
+    constexpr size_t vertexCount = 16;
+    for (size_t j = 0; j < vertexCount; ++j) {
+      const double angle = Math::TwoPi * double(j) / double(vertexCount);
+      const double r = j % 2 == 0 ? radius : 0.5 * radius;
+      vertices.emplace_back(
+          center.x + r * glm::cos(angle),
+          center.y + r * glm::sin(angle));
+    }
+
+    polygons.emplace_back(vertices);
+  }
+
+  return polygons;
+}
+
+} // namespace
+
+TEST_CASE("rasterizePolygons") {
+  const GlobeRectangle rectangle =
+      GlobeRectangle::fromDegrees(0.0, 0.0, 10.0, 10.0);
+
+  SUBCASE("fills nothing when there are no polygons") {
+    std::vector<std::byte> pixels = rasterize(10, 10, rectangle, {});
+    CHECK(countPixels(pixels, outside) == 100);
+  }
+
+  SUBCASE("fills the pixels whose centers are inside a polygon") {
+    // Covers the western half of the rectangle.
+    std::vector<CartographicPolygon> polygons{CartographicPolygon(
+        {glm::dvec2(Math::degreesToRadians(-1.0), Math::degreesToRadians(-1.0)),
+         glm::dvec2(Math::degreesToRadians(5.0), Math::degreesToRadians(-1.0)),
+         glm::dvec2(Math::degreesToRadians(5.0), Math::degreesToRadians(11.0)),
+         glm::dvec2(
+             Math::degreesToRadians(-1.0),
+             Math::degreesToRadians(11.0))})};
+
+    std::vector<std::byte> pixels = rasterize(10, 10, rectangle, polygons);
+    for (size_t j = 0; j < 10; ++j) {
+      for (size_t i = 0; i < 10; ++i) {
+        CHECK(pixels[j * 10 + i] == (i < 5 ? inside : outside));
+      }
+    }
+  }
+
+  SUBCASE("puts the north edge of the rectangle in the first row") {
+    // Covers the northern fifth of the rectangle.
+    std::vector<CartographicPolygon> polygons{CartographicPolygon(
+        {glm::dvec2(Math::degreesToRadians(-1.0), Math::degreesToRadians(8.0)),
+         glm::dvec2(Math::degreesToRadians(11.0), Math::degreesToRadians(8.0)),
+         glm::dvec2(Math::degreesToRadians(11.0), Math::degreesToRadians(11.0)),
+         glm::dvec2(
+             Math::degreesToRadians(-1.0),
+             Math::degreesToRadians(11.0))})};
+
+    std::vector<std::byte> pixels = rasterize(10, 10, rectangle, polygons);
+    for (size_t j = 0; j < 10; ++j) {
+      for (size_t i = 0; i < 10; ++i) {
+        CHECK(pixels[j * 10 + i] == (j < 2 ? inside : outside));
+      }
+    }
+  }
+
+  SUBCASE("handles polygons that cross the antimeridian") {
+    // A polygon from 170 degrees east to 170 degrees west.
+    std::vector<CartographicPolygon> polygons{CartographicPolygon(
+        {glm::dvec2(Math::degreesToRadians(170.0), Math::degreesToRadians(0.0)),
+         glm::dvec2(
+             Math::degreesToRadians(-170.0),
+             Math::degreesToRadians(0.0)),
+         glm::dvec2(
+             Math::degreesToRadians(-170.0),
+             Math::degreesToRadians(10.0)),
+         glm::dvec2(
+             Math::degreesToRadians(170.0),
+             Math::degreesToRadians(10.0))})};
+
+    // A rectangle entirely on the western side of the antimeridian.
+    const GlobeRectangle west =
+        GlobeRectangle::fromDegrees(-175.0, 0.0, -165.0, 10.0);
+    std::vector<std::byte> westPixels = rasterize(10, 10, west, polygons);
+    for (size_t j = 0; j < 10; ++j) {
+      for (size_t i = 0; i < 10; ++i) {
+        CHECK(westPixels[j * 10 + i] == (i < 5 ? inside : outside));
+      }
+    }
+
+    // A rectangle that itself crosses the antimeridian.
+    const GlobeRectangle crossing =
+        GlobeRectangle::fromDegrees(160.0, 0.0, -160.0, 10.0);
+    std::vector<std::byte> crossingPixels =
+        rasterize(40, 10, crossing, polygons);
+    for (size_t j = 0; j < 10; ++j) {
+      for (size_t i = 0; i < 40; ++i) {
+        CHECK(
+            crossingPixels[j * 40 + i] ==
+            (i >= 10 && i < 30 ? inside : outside));
+      }
+    }
+  }
+
+  SUBCASE("computes partial coverage when anti-aliasing") {
+    // Covers the western 4.5 pixels of the rectangle.
+    std::vector<CartographicPolygon> polygons{CartographicPolygon(
+        {glm::dvec2(Math::degreesToRadians(-1.0), Math::degreesToRadians(-1.0)),
+         glm::dvec2(Math::degreesToRadians(4.5), Math::degreesToRadians(-1.0)),
+         glm::dvec2(Math::degreesToRadians(4.5), Math::degreesToRadians(11.0)),
+         glm::dvec2(
+             Math::degreesToRadians(-1.0),
+             Math::degreesToRadians(11.0))})};
+
+    std::vector<std::byte> pixels =
+        rasterize(10, 10, rectangle, polygons, true);
+    for (size_t j = 0; j < 10; ++j) {
+      for (size_t i = 0; i < 4; ++i) {
+        CHECK(pixels[j * 10 + i] == inside);
+      }
+      CHECK(pixels[j * 10 + 4] == std::byte(128));
+      for (size_t i = 5; i < 10; ++i) {
+        CHECK(pixels[j * 10 + i] == outside);
+      }
+    }
+  }
+
+  SUBCASE("matches the per-triangle rasterizer") {
+    const std::vector<CartographicPolygon> polygons =
+        createRandomPolygons(50, rectangle);
+
+    std::vector<std::byte> expected(256 * 256);
+    rasterizeTrianglesNaive(expected, 256, 256, rectangle, polygons);
+    std::vector<std::byte> actual = rasterize(256, 256, rectangle, polygons);
+
+    // Pixel centers that lie exactly on an edge may be classified differently,
+    // but these are exceedingly rare with random polygons.
+    size_t differences = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+      if (expected[i] != actual[i]) {
+        ++differences;
+      }
+    }
+    CHECK(differences <= 4);
+  }
+}
+
+TEST_CASE("rasterizePolygons benchmark" * doctest::skip()) {
+  const GlobeRectangle rectangle =
+      GlobeRectangle::fromDegrees(0.0, 0.0, 1.0, 1.0);
+  const std::vector<CartographicPolygon> polygons =
+      createRandomPolygons(5000, rectangle);
+  std::vector<const CartographicPolygon*> pointers;
+  for (const CartographicPolygon& polygon : polygons) {
+    pointers.emplace_back(&polygon);
+  }
+
+  constexpr int32_t size = 256;
+  constexpr size_t iterations = 10;
+  std::vector<std::byte> pixels(size_t(size) * size_t(size));
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    rasterizeTrianglesNaive(pixels, size, size, rectangle, polygons);
+  }
+  auto naiveTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    rasterizePolygons(
+        pixels,
+        size,
+        size,
+        rectangle,
+        pointers,
+        inside,
+        outside,
+        false);
+  }
+  auto scanlineTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    rasterizePolygons(
+        pixels,
+        size,
+        size,
+        rectangle,
+        pointers,
+        inside,
+        outside,
+        true);
+  }
+  auto antiAliasedTime = std::chrono::steady_clock::now() - start;
+
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+  MESSAGE(
+      "naive: " << duration_cast<milliseconds>(naiveTime).count()
+                << "ms, scanline: "
+                << duration_cast<milliseconds>(scanlineTime).count()
+                << "ms, scanline anti-aliased: "
+                << duration_cast<milliseconds>(antiAliasedTime).count()
+                << "ms");
+}
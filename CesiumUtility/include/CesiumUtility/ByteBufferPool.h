@@ -0,0 +1,137 @@
+#pragma once
+
+#include <CesiumUtility/Library.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace CesiumUtility {
+
+/**
+ * @brief A thread-safe pool of large byte buffers, such as image pixel data
+ * and glTF buffer data, that are recycled instead of being freed and
+ * reallocated.
+ *
+ * Buffers are grouped into size classes, a quarter of a power of two apart,
+ * so that a released buffer can satisfy later requests of a similar size. Only
+ * buffers of at least {@link ByteBufferPool::MinimumPooledSize} bytes are
+ * pooled, since smaller ones are cheap for the system allocator. The total
+ * capacity of the buffers waiting in the pool never exceeds its byte budget;
+ * buffers released beyond that are freed.
+ */
+class CESIUMUTILITY_API ByteBufferPool final {
+public:
+  /**
+   * @brief The smallest buffer, in bytes, that is worth pooling.
+   */
+  static constexpr size_t MinimumPooledSize = 64 * 1024;
+
+  /**
+   * @brief Statistics about the use of a {@link ByteBufferPool}.
+   */
+  struct Statistics {
+    /**
+     * @brief The number of buffers that were acquired from the pool.
+     */
+    int64_t acquired = 0;
+
+    /**
+     * @brief The number of acquired buffers that reused a pooled buffer
+     * instead of allocating a new one.
+     */
+    int64_t reused = 0;
+
+    /**
+     * @brief The number of buffers that were released to the pool.
+     */
+    int64_t released = 0;
+
+    /**
+     * @brief The number of released buffers that were freed instead of
+     * pooled, because they were too small or the pool was full.
+     */
+    int64_t discarded = 0;
+
+    /**
+     * @brief The total capacity, in bytes, of the buffers currently waiting
+     * in the pool.
+     */
+    int64_t pooledBytes = 0;
+  };
+
+  /**
+   * @brief Constructs a new instance.
+   *
+   * @param maximumPooledBytes The most bytes of buffer capacity to hold in the
+   * pool while the buffers are not in use.
+   */
+  explicit ByteBufferPool(int64_t maximumPooledBytes) noexcept;
+
+  /**
+   * @brief Gets a buffer with the given size.
+   *
+   * The buffer's contents are zero-initialized, as if it were a new
+   * `std::vector` of this size.
+   *
+   * @param size The size of the buffer in bytes.
+   * @return The buffer.
+   */
+  std::vector<std::byte> acquire(size_t size);
+
+  /**
+   * @brief Resizes a buffer, moving its contents into a pooled buffer if its
+   * capacity is too small.
+   *
+   * This is equivalent to `buffer.resize(size)`, except that the new storage
+   * comes from the pool and the old storage is released to it.
+   *
+   * @param buffer The buffer to resize.
+   * @param size The new size of the buffer in bytes.
+   */
+  void resize(std::vector<std::byte>& buffer, size_t size);
+
+  /**
+   * @brief Returns a buffer to the pool so that its storage can be reused.
+   *
+   * The buffer does not need to have been acquired from this pool. It is left
+   * empty. If the pool can't hold it, including when the pool fails to
+   * allocate room for it, the buffer is freed.
+   *
+   * @param buffer The buffer to release.
+   */
+  void release(std::vector<std::byte>&& buffer) noexcept;
+
+  /**
+   * @brief Frees every buffer waiting in the pool.
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Gets the most bytes of buffer capacity to hold in the pool.
+   */
+  int64_t getMaximumPooledBytes() const noexcept;
+
+  /**
+   * @brief Sets the most bytes of buffer capacity to hold in the pool. If the
+   * pool holds more than this, the largest buffers are freed.
+   */
+  void setMaximumPooledBytes(int64_t maximumPooledBytes);
+
+  /**
+   * @brief Gets statistics about the use of this pool.
+   */
+  Statistics getStatistics() const noexcept;
+
+private:
+  mutable std::mutex _mutex;
+  int64_t _maximumPooledBytes;
+  Statistics _statistics;
+  // Pooled buffers, keyed by size class. Every buffer's capacity is at least
+  // the size class it is stored under.
+  std::map<size_t, std::vector<std::vector<std::byte>>> _buffers;
+};
+
+} // namespace CesiumUtility
@@ -0,0 +1,165 @@
+#include <CesiumUtility/ByteBufferPool.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CesiumUtility {
+
+namespace {
+
+// The distance between the size classes from one power of two to the next.
+size_t getSizeClassStep(size_t size) {
+  return std::max(std::bit_floor(size) / 4, size_t(1));
+}
+
+// The smallest size class that can hold a buffer of the given size.
+size_t roundUpToSizeClass(size_t size) {
+  const size_t step = getSizeClassStep(size);
+  return (size + step - 1) / step * step;
+}
+
+// The largest size class that a buffer with the given capacity can serve.
+size_t roundDownToSizeClass(size_t capacity) {
+  const size_t step = getSizeClassStep(capacity);
+  return capacity / step * step;
+}
+
+} // namespace
+
+ByteBufferPool::ByteBufferPool(int64_t maximumPooledBytes) noexcept
+    : _mutex(),
+      _maximumPooledBytes(maximumPooledBytes),
+      _statistics(),
+      _buffers() {}
+
+std::vector<std::byte> ByteBufferPool::acquire(size_t size) {
+  std::vector<std::byte> buffer;
+
+  if (size < MinimumPooledSize) {
+    std::scoped_lock lock(this->_mutex);
+    ++this->_statistics.acquired;
+  } else {
+    const size_t sizeClass = roundUpToSizeClass(size);
+
+    {
+      std::scoped_lock lock(this->_mutex);
+      ++this->_statistics.acquired;
+
+      auto it = this->_buffers.find(sizeClass);
+      if (it != this->_buffers.end()) {
+        buffer = std::move(it->second.back());
+        it->second.pop_back();
+        if (it->second.empty()) {
+          this->_buffers.erase(it);
+        }
+        this->_statistics.pooledBytes -= int64_t(buffer.capacity());
+        ++this->_statistics.reused;
+      }
+    }
+
+    // Allocate new buffers with the capacity of their whole size class, so
+    // that they can be reused for any size in it.
+    buffer.reserve(sizeClass);
+  }
+
+  buffer.resize(size);
+  return buffer;
+}
+
+void ByteBufferPool::resize(std::vector<std::byte>& buffer, size_t size) {
+  if (size <= buffer.capacity()) {
+    buffer.resize(size);
+    return;
+  }
+
+  std::vector<std::byte> larger = this->acquire(size);
+  if (buffer.capacity() > 0) {
+    std::copy(buffer.begin(), buffer.end(), larger.begin());
+    this->release(std::move(buffer));
+  }
+  buffer = std::move(larger);
+}
+
+void ByteBufferPool::release(std::vector<std::byte>&& buffer) noexcept {
+  const size_t capacity = buffer.capacity();
+
+  {
+    std::scoped_lock lock(this->_mutex);
+    ++this->_statistics.released;
+
+    if (capacity >= MinimumPooledSize &&
+        this->_statistics.pooledBytes + int64_t(capacity) <=
+            this->_maximumPooledBytes) {
+      const size_t sizeClass = roundDownToSizeClass(capacity);
+      buffer.clear();
+      try {
+        this->_buffers[sizeClass].emplace_back(std::move(buffer));
+        this->_statistics.pooledBytes += int64_t(capacity);
+        return;
+      } catch (...) {
+        // The buffer is unchanged when the pool can't allocate room for it, so
+        // free it instead. Don't leave an empty size class behind, because
+        // acquire expects every size class to hold a buffer.
+        auto it = this->_buffers.find(sizeClass);
+        if (it != this->_buffers.end() && it->second.empty()) {
+          this->_buffers.erase(it);
+        }
+      }
+    }
+
+    ++this->_statistics.discarded;
+  }
+
+  // Free the buffer outside the lock, since freeing a large buffer can take
+  // a while.
+  std::vector<std::byte>().swap(buffer);
+}
+
+void ByteBufferPool::clear() noexcept {
+  std::map<size_t, std::vector<std::vector<std::byte>>> buffers;
+
+  {
+    std::scoped_lock lock(this->_mutex);
+    buffers.swap(this->_buffers);
+    this->_statistics.pooledBytes = 0;
+  }
+}
+
+int64_t ByteBufferPool::getMaximumPooledBytes() const noexcept {
+  std::scoped_lock lock(this->_mutex);
+  return this->_maximumPooledBytes;
+}
+
+void ByteBufferPool::setMaximumPooledBytes(int64_t maximumPooledBytes) {
+  std::vector<std::vector<std::byte>> freed;
+
+  {
+    std::scoped_lock lock(this->_mutex);
+    this->_maximumPooledBytes = maximumPooledBytes;
+
+    // Free the largest buffers first, since they free the most memory each.
+    while (this->_statistics.pooledBytes > this->_maximumPooledBytes) {
+      auto it = std::prev(this->_buffers.end());
+      this->_statistics.pooledBytes -= int64_t(it->second.back().capacity());
+      freed.emplace_back(std::move(it->second.back()));
+      it->second.pop_back();
+      if (it->second.empty()) {
+        this->_buffers.erase(it);
+      }
+    }
+  }
+}
+
+ByteBufferPool::Statistics ByteBufferPool::getStatistics() const noexcept {
+  std::scoped_lock lock(this->_mutex);
+  return this->_statistics;
+}
+
+} // namespace CesiumUtility
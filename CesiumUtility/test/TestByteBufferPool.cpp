@@ -0,0 +1,88 @@
+#include <CesiumUtility/ByteBufferPool.h>
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace CesiumUtility;
+
+TEST_CASE("ByteBufferPool") {
+  const size_t size = 100000;
+
+  SUBCASE("reuses released buffers of a similar size") {
+    ByteBufferPool pool(1024 * 1024);
+
+    std::vector<std::byte> buffer = pool.acquire(size);
+    CHECK(buffer.size() == size);
+    const std::byte* pData = buffer.data();
+    buffer[0] = std::byte(42);
+    pool.release(std::move(buffer));
+
+    std::vector<std::byte> reused = pool.acquire(size + 10);
+    CHECK(reused.data() == pData);
+    CHECK(reused.size() == size + 10);
+    CHECK(reused[0] == std::byte(0));
+
+    const ByteBufferPool::Statistics statistics = pool.getStatistics();
+    CHECK(statistics.acquired == 2);
+    CHECK(statistics.reused == 1);
+    CHECK(statistics.released == 1);
+    CHECK(statistics.discarded == 0);
+    CHECK(statistics.pooledBytes == 0);
+  }
+
+  SUBCASE("does not pool small buffers") {
+    ByteBufferPool pool(1024 * 1024);
+
+    const size_t smallSize = ByteBufferPool::MinimumPooledSize - 1;
+    pool.release(std::vector<std::byte>(smallSize));
+
+    const ByteBufferPool::Statistics statistics = pool.getStatistics();
+    CHECK(statistics.released == 1);
+    CHECK(statistics.discarded == 1);
+    CHECK(statistics.pooledBytes == 0);
+  }
+
+  SUBCASE("frees buffers beyond its budget") {
+    ByteBufferPool pool(int64_t(size) * 3 / 2);
+
+    std::vector<std::byte> first = pool.acquire(size);
+    std::vector<std::byte> second = pool.acquire(size);
+    pool.release(std::move(first));
+    pool.release(std::move(second));
+
+    ByteBufferPool::Statistics statistics = pool.getStatistics();
+    CHECK(statistics.released == 2);
+    CHECK(statistics.discarded == 1);
+    CHECK(statistics.pooledBytes > 0);
+    CHECK(statistics.pooledBytes <= pool.getMaximumPooledBytes());
+
+    pool.setMaximumPooledBytes(0);
+    statistics = pool.getStatistics();
+    CHECK(statistics.pooledBytes == 0);
+
+    CHECK(pool.acquire(size).size() == size);
+    CHECK(pool.getStatistics().reused == 0);
+  }
+
+  SUBCASE("resize keeps the contents") {
+    ByteBufferPool pool(1024 * 1024);
+
+    std::vector<std::byte> buffer = pool.acquire(size);
+    buffer[size - 1] = std::byte(7);
+    pool.resize(buffer, size * 4);
+    REQUIRE(buffer.size() == size * 4);
+    CHECK(buffer[size - 1] == std::byte(7));
+    CHECK(buffer[size] == std::byte(0));
+
+    // The smaller buffer went back into the pool.
+    CHECK(pool.getStatistics().released == 1);
+    CHECK(pool.getStatistics().pooledBytes > 0);
+
+    pool.clear();
+    CHECK(pool.getStatistics().pooledBytes == 0);
+  }
+}